@@ -15,7 +15,6 @@
 #include "SampleUtils.h"
 
 #include "utils/ComboRenderPipelineDescriptor.h"
-#include "utils/SystemUtils.h"
 #include "utils/WGPUHelpers.h"
 
 #include <cstdlib>
@@ -153,8 +152,11 @@ void frame() {
     ubo.SetSubData(0, kNumTriangles * sizeof(ShaderData), shaderData.data());
 
     utils::ComboRenderPassDescriptor renderPass({backbufferView});
-    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::CommandEncoder encoder;
     {
+        ScopedFramePhase encodePhase(FramePhase::Encode);
+        encoder = device.CreateCommandEncoder();
+
         wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass);
         pass.SetPipeline(pipeline);
 
@@ -167,11 +169,21 @@ void frame() {
         pass.EndPass();
     }
 
-    wgpu::CommandBuffer commands = encoder.Finish();
-    queue.Submit(1, &commands);
-    swapchain.Present();
+    wgpu::CommandBuffer commands;
+    {
+        ScopedFramePhase validatePhase(FramePhase::Validate);
+        commands = encoder.Finish();
+    }
+    {
+        ScopedFramePhase submitPhase(FramePhase::Submit);
+        queue.Submit(1, &commands);
+        swapchain.Present();
+    }
     DoFlush();
-    fprintf(stderr, "frame %i\n", f);
+
+    if (!IsBenchmarking()) {
+        fprintf(stderr, "frame %i\n", f);
+    }
 }
 
 int main(int argc, const char* argv[]) {
@@ -182,7 +194,7 @@ int main(int argc, const char* argv[]) {
 
     while (!ShouldQuit()) {
         frame();
-        utils::USleep(16000);
+        WaitForNextFrame();
     }
 
     // TODO release stuff
@@ -15,7 +15,6 @@
 #include "SampleUtils.h"
 
 #include "utils/ComboRenderPipelineDescriptor.h"
-#include "utils/SystemUtils.h"
 #include "utils/WGPUHelpers.h"
 
 #include <array>
@@ -263,9 +262,12 @@ void initSim() {
 
 wgpu::CommandBuffer createCommandBuffer(const wgpu::TextureView backbufferView, size_t i) {
     auto& bufferDst = particleBuffers[(i + 1) % 2];
-    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::CommandEncoder encoder;
 
     {
+        ScopedFramePhase encodePhase(FramePhase::Encode);
+        encoder = device.CreateCommandEncoder();
+
         wgpu::ComputePassEncoder pass = encoder.BeginComputePass();
         pass.SetPipeline(updatePipeline);
         pass.SetBindGroup(0, updateBGs[i]);
@@ -274,6 +276,7 @@ wgpu::CommandBuffer createCommandBuffer(const wgpu::TextureView backbufferView,
     }
 
     {
+        ScopedFramePhase encodePhase(FramePhase::Encode);
         utils::ComboRenderPassDescriptor renderPass({backbufferView}, depthStencilView);
         wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass);
         pass.SetPipeline(renderPipeline);
@@ -283,6 +286,7 @@ wgpu::CommandBuffer createCommandBuffer(const wgpu::TextureView backbufferView,
         pass.EndPass();
     }
 
+    ScopedFramePhase validatePhase(FramePhase::Validate);
     return encoder.Finish();
 }
 
@@ -303,8 +307,11 @@ void frame() {
     wgpu::TextureView backbufferView = swapchain.GetCurrentTextureView();
 
     wgpu::CommandBuffer commandBuffer = createCommandBuffer(backbufferView, pingpong);
-    queue.Submit(1, &commandBuffer);
-    swapchain.Present();
+    {
+        ScopedFramePhase submitPhase(FramePhase::Submit);
+        queue.Submit(1, &commandBuffer);
+        swapchain.Present();
+    }
     DoFlush();
 
     pingpong = (pingpong + 1) % 2;
@@ -318,7 +325,7 @@ int main(int argc, const char* argv[]) {
 
     while (!ShouldQuit()) {
         frame();
-        utils::USleep(16000);
+        WaitForNextFrame();
     }
 
     // TODO release stuff
@@ -15,7 +15,6 @@
 #include "SampleUtils.h"
 
 #include "utils/ComboRenderPipelineDescriptor.h"
-#include "utils/SystemUtils.h"
 #include "utils/WGPUHelpers.h"
 
 #include <vector>
@@ -267,8 +266,11 @@ void frame() {
     wgpu::TextureView backbufferView = swapchain.GetCurrentTextureView();
     utils::ComboRenderPassDescriptor renderPass({backbufferView}, depthStencilView);
 
-    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::CommandEncoder encoder;
     {
+        ScopedFramePhase encodePhase(FramePhase::Encode);
+        encoder = device.CreateCommandEncoder();
+
         wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass);
         pass.SetPipeline(pipeline);
         pass.SetBindGroup(0, bindGroup[0]);
@@ -290,9 +292,16 @@ void frame() {
         pass.EndPass();
     }
 
-    wgpu::CommandBuffer commands = encoder.Finish();
-    queue.Submit(1, &commands);
-    swapchain.Present();
+    wgpu::CommandBuffer commands;
+    {
+        ScopedFramePhase validatePhase(FramePhase::Validate);
+        commands = encoder.Finish();
+    }
+    {
+        ScopedFramePhase submitPhase(FramePhase::Submit);
+        queue.Submit(1, &commands);
+        swapchain.Present();
+    }
     DoFlush();
 }
 
@@ -304,7 +313,7 @@ int main(int argc, const char* argv[]) {
 
     while (!ShouldQuit()) {
         frame();
-        utils::USleep(16000);
+        WaitForNextFrame();
     }
 
     // TODO release stuff
@@ -0,0 +1,63 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SampleUtils.h"
+
+#include <cstdlib>
+#include <new>
+
+// This file is only linked in the samples that can be run as benchmarks because it replaces the
+// global allocation functions. Only the allocations of the thread that enabled counting are
+// counted, and only while it is enabled, so that the rest of the program isn't affected.
+// Allocations made by Dawn are only counted when it is linked statically or the platform has
+// symbol interposition.
+namespace {
+    thread_local bool tCountAllocations = false;
+    thread_local uint64_t tAllocationCount = 0;
+
+    void SetAllocationCounting(bool enabled) {
+        tCountAllocations = enabled;
+    }
+
+    uint64_t GetAllocationCount() {
+        return tAllocationCount;
+    }
+
+    // Registers the counter during static initialization so that SampleUtils, which is shared
+    // with the samples that don't link this file, can use it when benchmarking.
+    struct CounterRegistration {
+        CounterRegistration() {
+            SetBenchmarkAllocationCounter(SetAllocationCounting, GetAllocationCount);
+        }
+    } counterRegistration;
+}  // anonymous namespace
+
+void* operator new(size_t size) {
+    if (tCountAllocations) {
+        tAllocationCount++;
+    }
+    void* pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
@@ -20,6 +20,8 @@
 #include "utils/BackendBinding.h"
 #include "utils/GLFWUtils.h"
 #include "utils/TerribleCommandBuffer.h"
+#include "utils/SystemUtils.h"
+#include "utils/Timer.h"
 
 #include <dawn/dawn_proc.h>
 #include <dawn/dawn_wsi.h>
@@ -29,7 +31,12 @@
 #include "GLFW/glfw3.h"
 
 #include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <string>
+#include <vector>
 
 void PrintDeviceError(WGPUErrorType errorType, const char* message, void*) {
     const char* errorTypeName = "";
@@ -83,12 +90,82 @@ static utils::BackendBinding* binding = nullptr;
 
 static GLFWwindow* window = nullptr;
 
+// Benchmark state. A frame ends each time ShouldQuit is called.
+static const char* sampleName = "";
+static uint32_t benchmarkFrameCount = 0;
+static const char* benchmarkOutputPath = nullptr;
+static std::unique_ptr<utils::Timer> benchmarkTimer;
+static double frameStartTime = 0;
+static uint64_t frameStartAllocationCount = 0;
+static std::array<double, 3> currentFramePhaseTimes = {};
+
+struct FrameTimes {
+    double total;
+    std::array<double, 3> phases;
+    uint64_t allocations;
+};
+static std::vector<FrameTimes> benchmarkFrames;
+
+// Set by SampleAllocationCounter.cpp during static initialization in the samples that link it.
+static void (*setAllocationCounting)(bool enabled) = nullptr;
+static uint64_t (*getAllocationCount)() = nullptr;
+
+static uint64_t GetBenchmarkAllocationCount() {
+    return getAllocationCount != nullptr ? getAllocationCount() : 0;
+}
+
 static dawn_wire::WireServer* wireServer = nullptr;
 static dawn_wire::WireClient* wireClient = nullptr;
 static utils::TerribleCommandBuffer* c2sBuf = nullptr;
 static utils::TerribleCommandBuffer* s2cBuf = nullptr;
 
+// Creates a device without any window or swap chain binding. OpenGL still needs a GLFW context to
+// discover its adapter so it uses a hidden window.
+static WGPUDevice CreateHeadlessBackendDevice() {
+    if (backendType == wgpu::BackendType::OpenGL) {
+        glfwSetErrorCallback(PrintGLFWError);
+        if (!glfwInit()) {
+            return nullptr;
+        }
+        utils::SetupGLFWWindowHintsForBackend(backendType);
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        window = glfwCreateWindow(640, 480, "Dawn window", nullptr, nullptr);
+        if (!window) {
+            return nullptr;
+        }
+    }
+
+    instance = std::make_unique<dawn_native::Instance>();
+    utils::DiscoverAdapter(instance.get(), window, backendType);
+
+    std::vector<dawn_native::Adapter> adapters = instance->GetAdapters();
+    auto adapterIt = std::find_if(adapters.begin(), adapters.end(),
+                                  [](const dawn_native::Adapter adapter) -> bool {
+                                      wgpu::AdapterProperties properties;
+                                      adapter.GetProperties(&properties);
+                                      return properties.backendType == backendType;
+                                  });
+    if (adapterIt == adapters.end()) {
+        dawn::ErrorLog() << "No adapter found for the requested backend";
+        return nullptr;
+    }
+    return adapterIt->CreateDevice();
+}
+
 wgpu::Device CreateCppDawnDevice() {
+    // Benchmarks run without the wire because the headless swap chain only exists in dawn_native.
+    if (IsBenchmarking()) {
+        WGPUDevice backendDevice = CreateHeadlessBackendDevice();
+        if (backendDevice == nullptr) {
+            return wgpu::Device();
+        }
+
+        DawnProcTable backendProcs = dawn_native::GetProcs();
+        dawnProcSetProcs(&backendProcs);
+        backendProcs.deviceSetUncapturedErrorCallback(backendDevice, PrintDeviceError, nullptr);
+        return wgpu::Device::Acquire(backendDevice);
+    }
+
     glfwSetErrorCallback(PrintGLFWError);
     if (!glfwInit()) {
         return wgpu::Device();
@@ -173,11 +250,27 @@ uint64_t GetSwapChainImplementation() {
 }
 
 wgpu::TextureFormat GetPreferredSwapChainTextureFormat() {
+    if (IsBenchmarking()) {
+        return wgpu::TextureFormat::BGRA8Unorm;
+    }
+
     DoFlush();
     return static_cast<wgpu::TextureFormat>(binding->GetPreferredSwapChainTextureFormat());
 }
 
+static void DiscardHeadlessFrame(uint64_t, const void*, uint64_t, uint32_t, void*) {
+}
+
 wgpu::SwapChain GetSwapChain(const wgpu::Device& device) {
+    // Benchmarks present into a headless swap chain so that reading the frames back is accounted
+    // for like presenting to a window would be, but the frames are discarded.
+    if (IsBenchmarking()) {
+        dawn_native::HeadlessSwapChainDescriptor descriptor;
+        descriptor.callback = DiscardHeadlessFrame;
+        return wgpu::SwapChain::Acquire(
+            dawn_native::CreateHeadlessSwapChain(device.Get(), &descriptor));
+    }
+
     wgpu::SwapChainDescriptor swapChainDesc;
     swapChainDesc.implementation = GetSwapChainImplementation();
     return device.CreateSwapChain(&swapChainDesc);
@@ -199,7 +292,28 @@ wgpu::TextureView CreateDefaultDepthStencilView(const wgpu::Device& device) {
 }
 
 bool InitSample(int argc, const char** argv) {
+    sampleName = argv[0];
+    bool commandBufferSpecified = false;
+
     for (int i = 1; i < argc; i++) {
+        if (std::string("--benchmark") == argv[i]) {
+            i++;
+            if (i < argc && atoi(argv[i]) > 0) {
+                benchmarkFrameCount = static_cast<uint32_t>(atoi(argv[i]));
+                continue;
+            }
+            fprintf(stderr, "--benchmark expects a number of frames\n");
+            return false;
+        }
+        if (std::string("--benchmark-output") == argv[i]) {
+            i++;
+            if (i < argc) {
+                benchmarkOutputPath = argv[i];
+                continue;
+            }
+            fprintf(stderr, "--benchmark-output expects a file name\n");
+            return false;
+        }
         if (std::string("-b") == argv[i] || std::string("--backend") == argv[i]) {
             i++;
             if (i < argc && std::string("d3d12") == argv[i]) {
@@ -229,21 +343,37 @@ bool InitSample(int argc, const char** argv) {
             i++;
             if (i < argc && std::string("none") == argv[i]) {
                 cmdBufType = CmdBufType::None;
+                commandBufferSpecified = true;
                 continue;
             }
             if (i < argc && std::string("terrible") == argv[i]) {
                 cmdBufType = CmdBufType::Terrible;
+                commandBufferSpecified = true;
                 continue;
             }
             fprintf(stderr, "--command-buffer expects a command buffer name (none, terrible)\n");
             return false;
         }
         if (std::string("-h") == argv[i] || std::string("--help") == argv[i]) {
-            printf("Usage: %s [-b BACKEND] [-c COMMAND_BUFFER]\n", argv[0]);
+            printf(
+                "Usage: %s [-b BACKEND] [-c COMMAND_BUFFER] [--benchmark FRAMES "
+                "[--benchmark-output FILE]]\n",
+                argv[0]);
             printf("  BACKEND is one of: d3d12, metal, null, opengl, vulkan\n");
             printf("  COMMAND_BUFFER is one of: none, terrible\n");
+            printf("  FRAMES frames are rendered headlessly and their timings written as JSON\n");
+            printf("  to FILE, or to stdout by default\n");
+            return false;
+        }
+    }
+
+    // Benchmarks run without the wire so they can't use the terrible command buffer.
+    if (IsBenchmarking()) {
+        if (commandBufferSpecified && cmdBufType == CmdBufType::Terrible) {
+            fprintf(stderr, "--benchmark can't be used with the terrible command buffer\n");
             return false;
         }
+        cmdBufType = CmdBufType::None;
     }
     return true;
 }
@@ -255,11 +385,135 @@ void DoFlush() {
 
         ASSERT(c2sSuccess && s2cSuccess);
     }
-    glfwPollEvents();
+    if (!IsBenchmarking()) {
+        glfwPollEvents();
+    }
+}
+
+// Nearest-rank percentile of sorted values.
+static double Percentile(const std::vector<double>& sortedValues, double percentile) {
+    size_t rank = static_cast<size_t>(percentile / 100.0 * sortedValues.size() + 0.5);
+    rank = std::min(std::max(rank, size_t(1)), sortedValues.size());
+    return sortedValues[rank - 1];
+}
+
+static void WriteDistribution(FILE* file, const char* name, std::vector<double> milliseconds) {
+    std::sort(milliseconds.begin(), milliseconds.end());
+    double sum = 0;
+    for (double value : milliseconds) {
+        sum += value;
+    }
+    fprintf(file,
+            "  \"%s\": {\"mean\": %f, \"p50\": %f, \"p90\": %f, \"p99\": %f, \"max\": %f},\n",
+            name, sum / milliseconds.size(), Percentile(milliseconds, 50),
+            Percentile(milliseconds, 90), Percentile(milliseconds, 99), milliseconds.back());
+}
+
+static void WriteBenchmarkResults() {
+    FILE* file = stdout;
+    if (benchmarkOutputPath != nullptr) {
+        file = fopen(benchmarkOutputPath, "w");
+        if (file == nullptr) {
+            dawn::ErrorLog() << "Couldn't open " << benchmarkOutputPath;
+            return;
+        }
+    }
+
+    static constexpr const char* kBackendNames[] = {"null",  "d3d11", "d3d12", "metal",
+                                                    "vulkan", "opengl", "opengles"};
+    const char* backendName = kBackendNames[static_cast<uint32_t>(backendType)];
+
+    std::vector<double> frameTimes;
+    std::array<std::vector<double>, 3> phaseTimes;
+    uint64_t allocations = 0;
+    for (const FrameTimes& frame : benchmarkFrames) {
+        frameTimes.push_back(frame.total * 1e3);
+        for (size_t i = 0; i < phaseTimes.size(); ++i) {
+            phaseTimes[i].push_back(frame.phases[i] * 1e3);
+        }
+        allocations += frame.allocations;
+    }
+
+    fprintf(file, "{\n");
+    fprintf(file, "  \"sample\": \"%s\",\n", sampleName);
+    fprintf(file, "  \"backend\": \"%s\",\n", backendName);
+    WriteDistribution(file, "frameTimeMs", frameTimes);
+    WriteDistribution(file, "encodeTimeMs", phaseTimes[static_cast<size_t>(FramePhase::Encode)]);
+    WriteDistribution(file, "validateTimeMs",
+                      phaseTimes[static_cast<size_t>(FramePhase::Validate)]);
+    WriteDistribution(file, "submitTimeMs", phaseTimes[static_cast<size_t>(FramePhase::Submit)]);
+    if (getAllocationCount != nullptr) {
+        fprintf(file, "  \"allocations\": %llu,\n", static_cast<unsigned long long>(allocations));
+        fprintf(file, "  \"allocationsPerFrame\": %f,\n",
+                static_cast<double>(allocations) / benchmarkFrames.size());
+    }
+    fprintf(file, "  \"frames\": %zu\n", benchmarkFrames.size());
+    fprintf(file, "}\n");
+
+    if (file != stdout) {
+        fclose(file);
+    }
 }
 
 bool ShouldQuit() {
-    return glfwWindowShouldClose(window);
+    if (!IsBenchmarking()) {
+        return glfwWindowShouldClose(window);
+    }
+
+    // The first call starts the first frame.
+    if (benchmarkTimer == nullptr) {
+        benchmarkTimer.reset(utils::CreateTimer());
+        benchmarkTimer->Start();
+        benchmarkFrames.reserve(benchmarkFrameCount);
+        // Only the allocations of the thread rendering the frames are counted.
+        if (setAllocationCounting != nullptr) {
+            setAllocationCounting(true);
+        }
+    } else {
+        double now = benchmarkTimer->GetElapsedTime();
+        benchmarkFrames.push_back({now - frameStartTime, currentFramePhaseTimes,
+                                   GetBenchmarkAllocationCount() - frameStartAllocationCount});
+    }
+
+    if (benchmarkFrames.size() == benchmarkFrameCount) {
+        if (setAllocationCounting != nullptr) {
+            setAllocationCounting(false);
+        }
+        WriteBenchmarkResults();
+        return true;
+    }
+
+    currentFramePhaseTimes = {};
+    frameStartAllocationCount = GetBenchmarkAllocationCount();
+    frameStartTime = benchmarkTimer->GetElapsedTime();
+    return false;
+}
+
+void SetBenchmarkAllocationCounter(void (*setCounting)(bool enabled), uint64_t (*getCount)()) {
+    setAllocationCounting = setCounting;
+    getAllocationCount = getCount;
+}
+
+bool IsBenchmarking() {
+    return benchmarkFrameCount != 0;
+}
+
+void WaitForNextFrame() {
+    if (!IsBenchmarking()) {
+        utils::USleep(16000);
+    }
+}
+
+// The benchmark timer only exists once the first frame started.
+ScopedFramePhase::ScopedFramePhase(FramePhase phase)
+    : mPhase(phase), mStartTime(benchmarkTimer != nullptr ? benchmarkTimer->GetElapsedTime() : 0) {
+}
+
+ScopedFramePhase::~ScopedFramePhase() {
+    if (benchmarkTimer != nullptr) {
+        currentFramePhaseTimes[static_cast<size_t>(mPhase)] +=
+            benchmarkTimer->GetElapsedTime() - mStartTime;
+    }
 }
 
 GLFWwindow* GetGLFWWindow() {
@@ -27,3 +27,32 @@ uint64_t GetSwapChainImplementation();
 wgpu::TextureFormat GetPreferredSwapChainTextureFormat();
 wgpu::SwapChain GetSwapChain(const wgpu::Device& device);
 wgpu::TextureView CreateDefaultDepthStencilView(const wgpu::Device& device);
+
+// Benchmark mode: when the sample is run with --benchmark FRAME_COUNT it renders that many frames
+// headlessly, as fast as possible, then ShouldQuit() prints the CPU timings of the frames as JSON.
+bool IsBenchmarking();
+
+// Lets the samples that can be benchmarked count their allocations, see
+// SampleAllocationCounter.cpp. Without a counter the results don't include allocation counts.
+void SetBenchmarkAllocationCounter(void (*setCounting)(bool enabled), uint64_t (*getCount)());
+
+// Waits until it is time to render the next frame, doesn't wait when benchmarking.
+void WaitForNextFrame();
+
+// The parts of a frame that are timed separately when benchmarking: recording the commands,
+// validating them in CommandEncoder::Finish and submitting / presenting them.
+enum class FramePhase {
+    Encode,
+    Validate,
+    Submit,
+};
+
+class ScopedFramePhase {
+  public:
+    explicit ScopedFramePhase(FramePhase phase);
+    ~ScopedFramePhase();
+
+  private:
+    FramePhase mPhase;
+    double mStartTime;
+};
@@ -489,7 +489,7 @@ class MultiGeneratorFromDawnJSON(Generator):
         return 'Generates code for various target from Dawn.json.'
 
     def add_commandline_arguments(self, parser):
-        allowed_targets = ['dawn_headers', 'dawncpp_headers', 'dawncpp', 'dawn_proc', 'mock_webgpu', 'dawn_wire', "dawn_native_utils"]
+        allowed_targets = ['dawn_headers', 'dawncpp_headers', 'dawncpp', 'dawn_proc', 'mock_webgpu', 'dawn_wire', "dawn_native_utils", "dawn_native_direct_procs"]
 
         parser.add_argument('--dawn-json', required=True, type=str, help ='The DAWN JSON definition to use.')
         parser.add_argument('--wire-json', default=None, type=str, help='The DAWN WIRE JSON definition to use.')
@@ -556,22 +556,26 @@ class MultiGeneratorFromDawnJSON(Generator):
             renders.append(FileRender('mock_webgpu.h', 'src/dawn/mock_webgpu.h', mock_params))
             renders.append(FileRender('mock_webgpu.cpp', 'src/dawn/mock_webgpu.cpp', mock_params))
 
-        if 'dawn_native_utils' in targets:
-            frontend_params = [
-                base_params,
-                api_params,
-                {
-                    'as_frontendType': lambda typ: as_frontendType(typ), # TODO as_frontendType and friends take a Type and not a Name :(
-                    'as_annotated_frontendType': lambda arg: annotated(as_frontendType(arg.type), arg)
-                }
-            ]
+        frontend_params = [
+            base_params,
+            api_params,
+            {
+                'as_frontendType': lambda typ: as_frontendType(typ), # TODO as_frontendType and friends take a Type and not a Name :(
+                'as_annotated_frontendType': lambda arg: annotated(as_frontendType(arg.type), arg)
+            }
+        ]
 
+        if 'dawn_native_utils' in targets:
             renders.append(FileRender('dawn_native/ValidationUtils.h', 'src/dawn_native/ValidationUtils_autogen.h', frontend_params))
             renders.append(FileRender('dawn_native/ValidationUtils.cpp', 'src/dawn_native/ValidationUtils_autogen.cpp', frontend_params))
             renders.append(FileRender('dawn_native/wgpu_structs.h', 'src/dawn_native/wgpu_structs_autogen.h', frontend_params))
             renders.append(FileRender('dawn_native/wgpu_structs.cpp', 'src/dawn_native/wgpu_structs_autogen.cpp', frontend_params))
+            renders.append(FileRender('dawn_native/NativeProcs.h', 'src/dawn_native/NativeProcs_autogen.h', frontend_params))
             renders.append(FileRender('dawn_native/ProcTable.cpp', 'src/dawn_native/ProcTable.cpp', frontend_params))
 
+        if 'dawn_native_direct_procs' in targets:
+            renders.append(FileRender('dawn_native/DirectProcs.cpp', 'src/dawn_native/DirectProcs_autogen.cpp', frontend_params))
+
         if 'dawn_wire' in targets:
             additional_params = compute_wire_params(api_params, wire_json)
 
@@ -0,0 +1,57 @@
+//* Copyright 2020 The Dawn Authors
+//*
+//* Licensed under the Apache License, Version 2.0 (the "License");
+//* you may not use this file except in compliance with the License.
+//* You may obtain a copy of the License at
+//*
+//*     http://www.apache.org/licenses/LICENSE-2.0
+//*
+//* Unless required by applicable law or agreed to in writing, software
+//* distributed under the License is distributed on an "AS IS" BASIS,
+//* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//* See the License for the specific language governing permissions and
+//* limitations under the License.
+
+//* Implements the wgpu* C entry points directly on top of dawn_native instead of going through the
+//* DawnProcTable of libdawn_proc. Linking this instead of libdawn_proc makes each call of the C++
+//* wrappers a direct call into an inline frontend function that the compiler / linker can fold.
+
+#include "dawn/dawn_proc.h"
+
+#include "common/Assert.h"
+#include "dawn_native/NativeProcs_autogen.h"
+
+extern "C" {
+
+    // There is no proc table to set: only dawn_native's procs can be used in this configuration.
+    void dawnProcSetProcs(const DawnProcTable* procs) {
+        ASSERT(procs == nullptr || procs->createInstance == dawn_native::NativeCreateInstance);
+    }
+
+    WGPUInstance wgpuCreateInstance(WGPUInstanceDescriptor const * descriptor) {
+        return dawn_native::NativeCreateInstance(descriptor);
+    }
+
+    WGPUProc wgpuGetProcAddress(WGPUDevice device, const char* procName) {
+        return dawn_native::NativeGetProcAddress(device, procName);
+    }
+
+    {% for type in by_category["object"] %}
+        {% for method in c_methods(type) %}
+            {{as_cType(method.return_type.name)}} {{as_cMethod(type.name, method.name)}}(
+                {{-as_cType(type.name)}} {{as_varName(type.name)}}
+                {%- for arg in method.arguments -%}
+                    , {{as_annotated_cType(arg)}}
+                {%- endfor -%}
+            ) {
+                {% if method.return_type.name.canonical_case() != "void" %}return {% endif %}
+                dawn_native::Native{{as_MethodSuffix(type.name, method.name)}}({{as_varName(type.name)}}
+                    {%- for arg in method.arguments -%}
+                        , {{as_varName(arg.name)}}
+                    {%- endfor -%}
+                );
+            }
+        {% endfor %}
+
+    {% endfor %}
+}
@@ -12,76 +12,16 @@
 //* See the License for the specific language governing permissions and
 //* limitations under the License.
 
-#include "dawn_native/dawn_platform.h"
-#include "dawn_native/DawnNative.h"
+#include "dawn_native/NativeProcs_autogen.h"
 
 #include <algorithm>
+#include <cstring>
 #include <vector>
 
-{% for type in by_category["object"] %}
-    {% if type.name.canonical_case() not in ["texture view"] %}
-        #include "dawn_native/{{type.name.CamelCase()}}.h"
-    {% endif %}
-{% endfor %}
-
 namespace dawn_native {
 
-    // Type aliases to make all frontend types appear as if they have "Base" at the end when some
-    // of them are actually pure-frontend and don't have the Base.
-    using CommandEncoderBase = CommandEncoder;
-    using ComputePassEncoderBase = ComputePassEncoder;
-    using RayTracingPassEncoderBase = RayTracingPassEncoder;
-    using FenceBase = Fence;
-    using RenderPassEncoderBase = RenderPassEncoder;
-    using RenderBundleEncoderBase = RenderBundleEncoder;
-    using SurfaceBase = Surface;
-
     namespace {
 
-        {% for type in by_category["object"] %}
-            {% for method in c_methods(type) %}
-                {% set suffix = as_MethodSuffix(type.name, method.name) %}
-
-                {{as_cType(method.return_type.name)}} Native{{suffix}}(
-                    {{-as_cType(type.name)}} cSelf
-                    {%- for arg in method.arguments -%}
-                        , {{as_annotated_cType(arg)}}
-                    {%- endfor -%}
-                ) {
-                    //* Perform conversion between C types and frontend types
-                    auto self = reinterpret_cast<{{as_frontendType(type)}}>(cSelf);
-
-                    {% for arg in method.arguments %}
-                        {% set varName = as_varName(arg.name) %}
-                        {% if arg.type.category in ["enum", "bitmask"] %}
-                            auto {{varName}}_ = static_cast<{{as_frontendType(arg.type)}}>({{varName}});
-                        {% elif arg.annotation != "value" or arg.type.category == "object" %}
-                            auto {{varName}}_ = reinterpret_cast<{{decorate("", as_frontendType(arg.type), arg)}}>({{varName}});
-                        {% else %}
-                            auto {{varName}}_ = {{as_varName(arg.name)}};
-                        {% endif %}
-                    {%- endfor-%}
-
-                    {% if method.return_type.name.canonical_case() != "void" %}
-                        auto result =
-                    {%- endif %}
-                    self->{{method.name.CamelCase()}}(
-                        {%- for arg in method.arguments -%}
-                            {%- if not loop.first %}, {% endif -%}
-                            {{as_varName(arg.name)}}_
-                        {%- endfor -%}
-                    );
-                    {% if method.return_type.name.canonical_case() != "void" %}
-                        {% if method.return_type.category == "object" %}
-                            return reinterpret_cast<{{as_cType(method.return_type.name)}}>(result);
-                        {% else %}
-                            return result;
-                        {% endif %}
-                    {% endif %}
-                }
-            {% endfor %}
-        {% endfor %}
-
         struct ProcEntry {
             WGPUProc proc;
             const char* name;
@@ -94,12 +34,6 @@ namespace dawn_native {
         static constexpr size_t sProcMapSize = sizeof(sProcMap) / sizeof(sProcMap[0]);
     }
 
-    WGPUInstance NativeCreateInstance(WGPUInstanceDescriptor const* cDescriptor) {
-        const dawn_native::InstanceDescriptor* descriptor =
-            reinterpret_cast<const dawn_native::InstanceDescriptor*>(cDescriptor);
-        return reinterpret_cast<WGPUInstance>(InstanceBase::Create(descriptor));
-    }
-
     WGPUProc NativeGetProcAddress(WGPUDevice, const char* procName) {
         if (procName == nullptr) {
             return nullptr;
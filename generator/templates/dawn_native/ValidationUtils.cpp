@@ -14,30 +14,39 @@
 
 #include "dawn_native/ValidationUtils_autogen.h"
 
+#include "common/Assert.h"
+#include "common/Compiler.h"
+
 namespace dawn_native {
 
-    {% for type in by_category["enum"] %}
+    {% for type in by_category["enum"] + by_category["bitmask"] %}
         MaybeError Validate{{type.name.CamelCase()}}(wgpu::{{as_cppType(type.name)}} value) {
-            switch (value) {
-                {% for value in type.values if value.valid %}
-                    case wgpu::{{as_cppType(type.name)}}::{{as_cppEnum(value.name)}}:
-                        return {};
-                {% endfor %}
-                default:
-                    return DAWN_VALIDATION_ERROR("Invalid value for {{as_cType(type.name)}}");
+            if (DAWN_LIKELY(IsValid{{type.name.CamelCase()}}(value))) {
+                return {};
             }
+            return DAWN_VALIDATION_ERROR("Invalid value for {{as_cType(type.name)}}");
         }
 
     {% endfor %}
+    {% for type in by_category["structure"] %}
+        {% set scalars = type.members | selectattr("annotation", "equalto", "value") | selectattr("type.category", "in", ["enum", "bitmask"]) | list %}
+        {% if scalars | length > 0 %}
+            MaybeError Validate{{type.name.CamelCase()}}Scalars(const {{as_cppType(type.name)}}* value) {
+                //* Use & instead of && so that all the members are checked without branches.
+                bool valid = true
+                    {%- for member in scalars %} &
+                        IsValid{{member.type.name.CamelCase()}}(value->{{as_varName(member.name)}})
+                    {%- endfor %};
+                if (DAWN_LIKELY(valid)) {
+                    return {};
+                }
 
-    {% for type in by_category["bitmask"] %}
-        MaybeError Validate{{type.name.CamelCase()}}(wgpu::{{as_cppType(type.name)}} value) {
-            if ((value & static_cast<wgpu::{{as_cppType(type.name)}}>(~{{type.full_mask}})) == 0) {
-                return {};
+                {% for member in scalars %}
+                    DAWN_TRY(Validate{{member.type.name.CamelCase()}}(value->{{as_varName(member.name)}}));
+                {% endfor %}
+                UNREACHABLE();
             }
-            return DAWN_VALIDATION_ERROR("Invalid value for {{as_cType(type.name)}}");
-        }
 
+        {% endif %}
     {% endfor %}
-
 } // namespace dawn_native
@@ -18,14 +18,48 @@
 #include "dawn/webgpu_cpp.h"
 
 #include "dawn_native/Error.h"
+#include "dawn_native/dawn_platform.h"
+
+#include <cstdint>
 
 namespace dawn_native {
 
+    // Branchless checks of the value of enums and bitmasks. Enums with values that fit in 64 bits
+    // are checked with a constexpr bitset of their valid values instead of a switch.
+    {% for type in by_category["enum"] %}
+        {% set cppType = "wgpu::" + as_cppType(type.name) %}
+        {% if type.values | map(attribute="value") | max < 64 %}
+            constexpr uint64_t kValid{{type.name.CamelCase()}}Values = 0
+                {%- for value in type.values if value.valid %} | (uint64_t(1) << {{value.value}}){% endfor %};
+            constexpr bool IsValid{{type.name.CamelCase()}}({{cppType}} value) {
+                return static_cast<uint32_t>(value) < 64 &&
+                       ((kValid{{type.name.CamelCase()}}Values >> static_cast<uint32_t>(value)) & 1) != 0;
+            }
+        {% else %}
+            constexpr bool IsValid{{type.name.CamelCase()}}({{cppType}} value) {
+                return false
+                    {%- for value in type.values if value.valid %} || value == {{cppType}}::{{as_cppEnum(value.name)}}{% endfor %};
+            }
+        {% endif %}
+
+    {% endfor %}
+    {% for type in by_category["bitmask"] %}
+        constexpr bool IsValid{{type.name.CamelCase()}}(wgpu::{{as_cppType(type.name)}} value) {
+            return (static_cast<uint32_t>(value) & ~uint32_t({{type.full_mask}})) == 0;
+        }
+
+    {% endfor %}
     // Helper functions to check the value of enums and bitmasks
     {% for type in by_category["enum"] + by_category["bitmask"] %}
         MaybeError Validate{{type.name.CamelCase()}}(wgpu::{{as_cppType(type.name)}} value);
     {% endfor %}
 
+    // Check all the enum and bitmask members of a structure with a single branch in the success
+    // case. The individual errors are only computed when one of the members is invalid.
+    {% for type in by_category["structure"] if type.members | selectattr("annotation", "equalto", "value") | selectattr("type.category", "in", ["enum", "bitmask"]) | list | length > 0 %}
+        MaybeError Validate{{type.name.CamelCase()}}Scalars(const {{as_cppType(type.name)}}* value);
+    {% endfor %}
+
 } // namespace dawn_native
 
 #endif  // BACKEND_VALIDATIONUTILS_H_
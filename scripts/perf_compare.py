@@ -0,0 +1,216 @@
+#!/usr/bin/env python
+#
+# Copyright 2020 The Dawn Authors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Compares the results files written by dawn_perf_tests --results-file=<file> and reports the
+# statistically significant regressions. Each side can be given several results files, for example
+# from repeated runs, and all their trials are pooled together.
+#
+# A measurement is a regression when:
+#  - Welch's t-test says that the current mean is bigger than the baseline mean with a p-value
+#    below --alpha, and
+#  - the relative change is bigger than --threshold, and bigger than --noise-factor times the
+#    coefficient of variation of the measurements so that noisy tests need bigger changes.
+#
+# The script exits with a non-zero status when there are regressions so it can be used in CI.
+
+import argparse
+import json
+import math
+import sys
+
+# Metrics that aren't times, like the step counts, aren't compared.
+UNIT_TO_NANOSECONDS = {
+    'ns': 1.0,
+    'us': 1e3,
+    'ms': 1e6,
+    's': 1e9,
+}
+
+
+def mean(data):
+    return float(sum(data)) / len(data)
+
+
+def variance(data):
+    """Sample variance, 0 when there is a single point."""
+    if len(data) < 2:
+        return 0.0
+    m = mean(data)
+    return sum((x - m)**2 for x in data) / (len(data) - 1)
+
+
+def log_beta(a, b):
+    return math.lgamma(a) + math.lgamma(b) - math.lgamma(a + b)
+
+
+def incomplete_beta_continued_fraction(a, b, x):
+    """Continued fraction of the regularized incomplete beta function (Lentz's method)."""
+    tiny = 1e-300
+    c = 1.0
+    d = 1.0 - (a + b) * x / (a + 1.0)
+    d = 1.0 / (d if abs(d) > tiny else tiny)
+    result = d
+    for m in range(1, 200):
+        for numerator in [
+                m * (b - m) * x / ((a + 2 * m - 1) * (a + 2 * m)),
+                -(a + m) * (a + b + m) * x / ((a + 2 * m) * (a + 2 * m + 1))
+        ]:
+            d = 1.0 + numerator * d
+            d = 1.0 / (d if abs(d) > tiny else tiny)
+            c = 1.0 + numerator / c
+            c = c if abs(c) > tiny else tiny
+            result *= c * d
+        if abs(c * d - 1.0) < 1e-12:
+            break
+    return result
+
+
+def regularized_incomplete_beta(a, b, x):
+    if x <= 0.0:
+        return 0.0
+    if x >= 1.0:
+        return 1.0
+    front = math.exp(a * math.log(x) + b * math.log(1.0 - x) - log_beta(a, b))
+    if x < (a + 1.0) / (a + b + 2.0):
+        return front * incomplete_beta_continued_fraction(a, b, x) / a
+    return 1.0 - front * incomplete_beta_continued_fraction(b, a, 1.0 - x) / b
+
+
+def welch_one_sided_p_value(baseline, current):
+    """P-value of the hypothesis that the current mean isn't bigger than the baseline mean."""
+    if len(baseline) < 2 or len(current) < 2:
+        return None
+
+    baseline_term = variance(baseline) / len(baseline)
+    current_term = variance(current) / len(current)
+    standard_error = math.sqrt(baseline_term + current_term)
+    difference = mean(current) - mean(baseline)
+    if standard_error == 0.0:
+        return 0.0 if difference > 0 else 1.0
+
+    t = difference / standard_error
+    dof = (baseline_term + current_term)**2 / (
+        baseline_term**2 / (len(baseline) - 1) + current_term**2 / (len(current) - 1))
+
+    # The Student's t tail probability P(T > t) expressed with the incomplete beta function.
+    tail = 0.5 * regularized_incomplete_beta(dof / 2.0, 0.5, dof / (dof + t * t))
+    return tail if t > 0 else 1.0 - tail
+
+
+def load_results(paths):
+    """Returns the times in nanoseconds of each (test, configuration, metric) and the metadata."""
+    measurements = {}
+    metadata = []
+    for path in paths:
+        with open(path) as f:
+            data = json.load(f)
+        metadata.append(data.get('metadata', {}))
+
+        for result in data['results']:
+            scale = UNIT_TO_NANOSECONDS.get(result['units'])
+            if scale is None:
+                continue
+            key = (result['test_suite'], result['story'], result['metric'])
+            measurements.setdefault(key, []).append(result['value'] * scale)
+    return measurements, metadata
+
+
+def format_time(nanoseconds):
+    for unit, scale in [('s', 1e9), ('ms', 1e6), ('us', 1e3)]:
+        if nanoseconds >= scale:
+            return '%.3f %s' % (nanoseconds / scale, unit)
+    return '%.3f ns' % nanoseconds
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compares dawn_perf_tests results files and reports regressions.')
+    parser.add_argument('--baseline', nargs='+', required=True, help='Baseline results files.')
+    parser.add_argument('--current', nargs='+', required=True, help='Current results files.')
+    parser.add_argument('--alpha',
+                        type=float,
+                        default=0.01,
+                        help='Significance level of the t-test (default 0.01).')
+    parser.add_argument('--threshold',
+                        type=float,
+                        default=0.05,
+                        help='Minimum relative slowdown reported as a regression (default 0.05).')
+    parser.add_argument('--noise-factor',
+                        type=float,
+                        default=2.0,
+                        help='The slowdown must also be bigger than this times the coefficient '
+                        'of variation of the measurements (default 2).')
+    parser.add_argument('--metric',
+                        action='append',
+                        help='Only compare these metrics, for example wall_time. Can be repeated.')
+    args = parser.parse_args()
+
+    baseline, baseline_metadata = load_results(args.baseline)
+    current, current_metadata = load_results(args.current)
+
+    for name, metadata in [('Baseline', baseline_metadata), ('Current', current_metadata)]:
+        commits = sorted(set(m.get('commit', '') for m in metadata))
+        print('%s commit(s): %s' % (name, ', '.join(c for c in commits if c) or 'unknown'))
+
+    regressions = []
+    improvements = []
+    for key in sorted(set(baseline.keys()) & set(current.keys())):
+        if args.metric and key[2] not in args.metric:
+            continue
+
+        baseline_values = baseline[key]
+        current_values = current[key]
+        baseline_mean = mean(baseline_values)
+        current_mean = mean(current_values)
+        if baseline_mean == 0.0:
+            continue
+
+        change = (current_mean - baseline_mean) / baseline_mean
+        noise = max(
+            math.sqrt(variance(baseline_values)) / baseline_mean,
+            math.sqrt(variance(current_values)) / current_mean if current_mean != 0.0 else 0.0)
+        min_change = max(args.threshold, args.noise_factor * noise)
+
+        p_value = welch_one_sided_p_value(baseline_values, current_values)
+        if p_value is None:
+            print('Skipping %s.%s %s: needs at least two trials on each side' %
+                  (key[0], key[1], key[2]))
+            continue
+
+        line = '%s.%s %s: %s -> %s (%+.1f%%, noise %.1f%%, p=%.4f)' % (
+            key[0], key[1], key[2], format_time(baseline_mean), format_time(current_mean),
+            change * 100.0, noise * 100.0, p_value)
+        if change > min_change and p_value < args.alpha:
+            regressions.append(line)
+        elif -change > min_change and 1.0 - p_value < args.alpha:
+            improvements.append(line)
+
+    for key in sorted(set(baseline.keys()) ^ set(current.keys())):
+        print('Only in %s: %s.%s %s' %
+              ('baseline' if key in baseline else 'current', key[0], key[1], key[2]))
+
+    print('\nImprovements (%d):' % len(improvements))
+    for line in improvements:
+        print('  ' + line)
+    print('\nRegressions (%d):' % len(regressions))
+    for line in regressions:
+        print('  ' + line)
+
+    return 1 if regressions else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -15,72 +15,364 @@
 #ifndef COMMON_SERIALQUEUE_H_
 #define COMMON_SERIALQUEUE_H_
 
-#include "common/SerialStorage.h"
+#include "common/Assert.h"
+#include "common/Serial.h"
 
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
-template <typename T>
-class SerialQueue;
-
-template <typename T>
-struct SerialStorageTraits<SerialQueue<T>> {
-    using Value = T;
-    using SerialPair = std::pair<Serial, std::vector<T>>;
-    using Storage = std::vector<SerialPair>;
-    using StorageIterator = typename Storage::iterator;
-    using ConstStorageIterator = typename Storage::const_iterator;
-};
-
 // SerialQueue stores an associative list mapping a Serial to T.
 // It enforces that the Serials enqueued are strictly non-decreasing.
-// This makes it very efficient iterate or clear all items added up
-// to some Serial value because they are stored contiguously in memory.
+// The elements are stored contiguously in a growable ring buffer, each tagged with its serial, so
+// that enqueuing and retiring elements are amortized O(1) and don't allocate once the queue has
+// reached its steady state size.
 template <typename T>
-class SerialQueue : public SerialStorage<SerialQueue<T>> {
+class SerialQueue {
+  private:
+    struct Entry {
+        template <typename... Args>
+        Entry(Serial serial, Args&&... args) : serial(serial), value(std::forward<Args>(args)...) {
+        }
+
+        Serial serial;
+        T value;
+    };
+    using EntryStorage = typename std::aligned_storage<sizeof(Entry), alignof(Entry)>::type;
+
   public:
-    using SerialPair = typename SerialStorageTraits<SerialQueue<T>>::SerialPair;
+    // Iterators are an index in the queue, starting from the oldest element.
+    template <typename Queue, typename Value>
+    class IteratorBase {
+      public:
+        IteratorBase(Queue* queue, size_t index);
+        IteratorBase& operator++();
+
+        bool operator==(const IteratorBase& other) const;
+        bool operator!=(const IteratorBase& other) const;
+        Value& operator*() const;
+
+      private:
+        Queue* mQueue;
+        size_t mIndex;
+    };
+    using Iterator = IteratorBase<SerialQueue<T>, T>;
+    using ConstIterator = IteratorBase<const SerialQueue<T>, const T>;
+
+    template <typename Queue, typename It>
+    class BeginEndBase {
+      public:
+        BeginEndBase(Queue* queue, size_t start, size_t end);
+
+        It begin() const;
+        It end() const;
+
+      private:
+        Queue* mQueue;
+        size_t mStart;
+        size_t mEnd;
+    };
+    using BeginEnd = BeginEndBase<SerialQueue<T>, Iterator>;
+    using ConstBeginEnd = BeginEndBase<const SerialQueue<T>, ConstIterator>;
+
+    SerialQueue() = default;
+    SerialQueue(const SerialQueue& other);
+    SerialQueue(SerialQueue&& other);
+    SerialQueue& operator=(const SerialQueue& other);
+    SerialQueue& operator=(SerialQueue&& other);
+    ~SerialQueue();
 
     // The serial must be given in (not strictly) increasing order.
     void Enqueue(const T& value, Serial serial);
     void Enqueue(T&& value, Serial serial);
     void Enqueue(const std::vector<T>& values, Serial serial);
     void Enqueue(std::vector<T>&& values, Serial serial);
+
+    bool Empty() const;
+
+    // The UpTo variants of Iterate and Clear affect all values associated to a serial
+    // that is smaller OR EQUAL to the given serial. Iterating is done like so:
+    //     for (const T& value : queue.IterateAll()) { stuff(T); }
+    ConstBeginEnd IterateAll() const;
+    ConstBeginEnd IterateUpTo(Serial serial) const;
+    BeginEnd IterateAll();
+    BeginEnd IterateUpTo(Serial serial);
+
+    void Clear();
+    void ClearUpTo(Serial serial);
+
+    Serial FirstSerial() const;
+    Serial LastSerial() const;
+
+  private:
+    Entry& EntryAt(size_t index);
+    const Entry& EntryAt(size_t index) const;
+
+    // Returns the index of the first element with a serial bigger than serial.
+    size_t FindUpTo(Serial serial) const;
+
+    template <typename... Args>
+    void EmplaceBack(Serial serial, Args&&... args);
+    void PopFront();
+    void Grow();
+
+    std::unique_ptr<EntryStorage[]> mStorage;
+    // The capacity is always a power of two so that indices can be wrapped with a mask.
+    size_t mCapacity = 0;
+    size_t mHead = 0;
+    size_t mSize = 0;
 };
 
 // SerialQueue
 
 template <typename T>
-void SerialQueue<T>::Enqueue(const T& value, Serial serial) {
-    DAWN_ASSERT(this->Empty() || this->mStorage.back().first <= serial);
+SerialQueue<T>::SerialQueue(const SerialQueue& other) {
+    *this = other;
+}
 
-    if (this->Empty() || this->mStorage.back().first < serial) {
-        this->mStorage.emplace_back(serial, std::vector<T>{});
-    }
-    this->mStorage.back().second.push_back(value);
+template <typename T>
+SerialQueue<T>::SerialQueue(SerialQueue&& other)
+    : mStorage(std::move(other.mStorage)),
+      mCapacity(other.mCapacity),
+      mHead(other.mHead),
+      mSize(other.mSize) {
+    other.mCapacity = 0;
+    other.mHead = 0;
+    other.mSize = 0;
 }
 
 template <typename T>
-void SerialQueue<T>::Enqueue(T&& value, Serial serial) {
-    DAWN_ASSERT(this->Empty() || this->mStorage.back().first <= serial);
+SerialQueue<T>& SerialQueue<T>::operator=(const SerialQueue& other) {
+    if (&other != this) {
+        Clear();
+        for (size_t i = 0; i < other.mSize; ++i) {
+            const Entry& entry = other.EntryAt(i);
+            EmplaceBack(entry.serial, entry.value);
+        }
+    }
+    return *this;
+}
 
-    if (this->Empty() || this->mStorage.back().first < serial) {
-        this->mStorage.emplace_back(serial, std::vector<T>{});
+template <typename T>
+SerialQueue<T>& SerialQueue<T>::operator=(SerialQueue&& other) {
+    if (&other != this) {
+        Clear();
+        mStorage = std::move(other.mStorage);
+        mCapacity = other.mCapacity;
+        mHead = other.mHead;
+        mSize = other.mSize;
+        other.mCapacity = 0;
+        other.mHead = 0;
+        other.mSize = 0;
     }
-    this->mStorage.back().second.push_back(std::move(value));
+    return *this;
+}
+
+template <typename T>
+SerialQueue<T>::~SerialQueue() {
+    Clear();
+}
+
+template <typename T>
+void SerialQueue<T>::Enqueue(const T& value, Serial serial) {
+    DAWN_ASSERT(Empty() || LastSerial() <= serial);
+    EmplaceBack(serial, value);
+}
+
+template <typename T>
+void SerialQueue<T>::Enqueue(T&& value, Serial serial) {
+    DAWN_ASSERT(Empty() || LastSerial() <= serial);
+    EmplaceBack(serial, std::move(value));
 }
 
 template <typename T>
 void SerialQueue<T>::Enqueue(const std::vector<T>& values, Serial serial) {
     DAWN_ASSERT(values.size() > 0);
-    DAWN_ASSERT(this->Empty() || this->mStorage.back().first <= serial);
-    this->mStorage.emplace_back(serial, values);
+    DAWN_ASSERT(Empty() || LastSerial() <= serial);
+    for (const T& value : values) {
+        EmplaceBack(serial, value);
+    }
 }
 
 template <typename T>
 void SerialQueue<T>::Enqueue(std::vector<T>&& values, Serial serial) {
     DAWN_ASSERT(values.size() > 0);
-    DAWN_ASSERT(this->Empty() || this->mStorage.back().first <= serial);
-    this->mStorage.emplace_back(serial, values);
+    DAWN_ASSERT(Empty() || LastSerial() <= serial);
+    for (T& value : values) {
+        EmplaceBack(serial, std::move(value));
+    }
+}
+
+template <typename T>
+bool SerialQueue<T>::Empty() const {
+    return mSize == 0;
+}
+
+template <typename T>
+typename SerialQueue<T>::ConstBeginEnd SerialQueue<T>::IterateAll() const {
+    return {this, 0, mSize};
+}
+
+template <typename T>
+typename SerialQueue<T>::ConstBeginEnd SerialQueue<T>::IterateUpTo(Serial serial) const {
+    return {this, 0, FindUpTo(serial)};
+}
+
+template <typename T>
+typename SerialQueue<T>::BeginEnd SerialQueue<T>::IterateAll() {
+    return {this, 0, mSize};
+}
+
+template <typename T>
+typename SerialQueue<T>::BeginEnd SerialQueue<T>::IterateUpTo(Serial serial) {
+    return {this, 0, FindUpTo(serial)};
+}
+
+template <typename T>
+void SerialQueue<T>::Clear() {
+    while (!Empty()) {
+        PopFront();
+    }
+    mHead = 0;
+}
+
+template <typename T>
+void SerialQueue<T>::ClearUpTo(Serial serial) {
+    while (!Empty() && EntryAt(0).serial <= serial) {
+        PopFront();
+    }
+}
+
+template <typename T>
+Serial SerialQueue<T>::FirstSerial() const {
+    DAWN_ASSERT(!Empty());
+    return EntryAt(0).serial;
+}
+
+template <typename T>
+Serial SerialQueue<T>::LastSerial() const {
+    DAWN_ASSERT(!Empty());
+    return EntryAt(mSize - 1).serial;
+}
+
+template <typename T>
+typename SerialQueue<T>::Entry& SerialQueue<T>::EntryAt(size_t index) {
+    DAWN_ASSERT(index < mSize);
+    return *reinterpret_cast<Entry*>(&mStorage[(mHead + index) & (mCapacity - 1)]);
+}
+
+template <typename T>
+const typename SerialQueue<T>::Entry& SerialQueue<T>::EntryAt(size_t index) const {
+    DAWN_ASSERT(index < mSize);
+    return *reinterpret_cast<const Entry*>(&mStorage[(mHead + index) & (mCapacity - 1)]);
+}
+
+template <typename T>
+size_t SerialQueue<T>::FindUpTo(Serial serial) const {
+    // Serials are sorted so we can binary search for the first one bigger than serial.
+    size_t first = 0;
+    size_t count = mSize;
+    while (count > 0) {
+        size_t step = count / 2;
+        if (EntryAt(first + step).serial <= serial) {
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+    return first;
+}
+
+template <typename T>
+template <typename... Args>
+void SerialQueue<T>::EmplaceBack(Serial serial, Args&&... args) {
+    if (mSize == mCapacity) {
+        Grow();
+    }
+    void* slot = &mStorage[(mHead + mSize) & (mCapacity - 1)];
+    new (slot) Entry(serial, std::forward<Args>(args)...);
+    mSize++;
+}
+
+template <typename T>
+void SerialQueue<T>::PopFront() {
+    EntryAt(0).~Entry();
+    mHead = (mHead + 1) & (mCapacity - 1);
+    mSize--;
+}
+
+template <typename T>
+void SerialQueue<T>::Grow() {
+    size_t newCapacity = mCapacity == 0 ? 8 : mCapacity * 2;
+    std::unique_ptr<EntryStorage[]> newStorage(new EntryStorage[newCapacity]);
+
+    for (size_t i = 0; i < mSize; ++i) {
+        Entry& entry = EntryAt(i);
+        new (&newStorage[i]) Entry(std::move(entry));
+        entry.~Entry();
+    }
+
+    mStorage = std::move(newStorage);
+    mCapacity = newCapacity;
+    mHead = 0;
+}
+
+// SerialQueue::BeginEndBase
+
+template <typename T>
+template <typename Queue, typename It>
+SerialQueue<T>::BeginEndBase<Queue, It>::BeginEndBase(Queue* queue, size_t start, size_t end)
+    : mQueue(queue), mStart(start), mEnd(end) {
+}
+
+template <typename T>
+template <typename Queue, typename It>
+It SerialQueue<T>::BeginEndBase<Queue, It>::begin() const {
+    return {mQueue, mStart};
+}
+
+template <typename T>
+template <typename Queue, typename It>
+It SerialQueue<T>::BeginEndBase<Queue, It>::end() const {
+    return {mQueue, mEnd};
+}
+
+// SerialQueue::IteratorBase
+
+template <typename T>
+template <typename Queue, typename Value>
+SerialQueue<T>::IteratorBase<Queue, Value>::IteratorBase(Queue* queue, size_t index)
+    : mQueue(queue), mIndex(index) {
+}
+
+template <typename T>
+template <typename Queue, typename Value>
+typename SerialQueue<T>::template IteratorBase<Queue, Value>&
+SerialQueue<T>::IteratorBase<Queue, Value>::operator++() {
+    mIndex++;
+    return *this;
+}
+
+template <typename T>
+template <typename Queue, typename Value>
+bool SerialQueue<T>::IteratorBase<Queue, Value>::operator==(const IteratorBase& other) const {
+    return other.mQueue == mQueue && other.mIndex == mIndex;
+}
+
+template <typename T>
+template <typename Queue, typename Value>
+bool SerialQueue<T>::IteratorBase<Queue, Value>::operator!=(const IteratorBase& other) const {
+    return !(*this == other);
+}
+
+template <typename T>
+template <typename Queue, typename Value>
+Value& SerialQueue<T>::IteratorBase<Queue, Value>::operator*() const {
+    return mQueue->EntryAt(mIndex).value;
 }
 
 #endif  // COMMON_SERIALQUEUE_H_
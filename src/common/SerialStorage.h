@@ -89,8 +89,6 @@ class SerialStorage {
     };
 
     // Derived classes may specialize constraits for elements stored
-    // Ex.) SerialQueue enforces that the serial must be given in (not strictly)
-    //      increasing order
     template <typename... Params>
     void Enqueue(Params&&... args, Serial serial) {
         Derived::Enqueue(std::forward<Params>(args)..., serial);
@@ -15,6 +15,7 @@
 #include "dawn_native/BindGroup.h"
 
 #include "common/Assert.h"
+#include "common/BitSetIterator.h"
 #include "common/Math.h"
 #include "dawn_native/BindGroupLayout.h"
 #include "dawn_native/Buffer.h"
@@ -23,6 +24,8 @@
 #include "dawn_native/Texture.h"
 #include "dawn_native/RayTracingAccelerationContainer.h"
 
+#include <algorithm>
+
 namespace dawn_native {
 
     namespace {
@@ -127,6 +130,90 @@ namespace dawn_native {
 
     }  // anonymous namespace
 
+    namespace {
+
+        // Validates bindings against the layout and returns in bindingsSet the bindings that were
+        // set. Each binding, or each element of binding arrays, must be set at most once.
+        MaybeError ValidateBindingsForLayout(
+            DeviceBase* device,
+            const BindGroupLayoutBase::LayoutBindingInfo& layoutInfo,
+            uint32_t bindingCount,
+            const BindGroupBinding* bindings,
+            std::bitset<kMaxBindingsPerGroup>* bindingsSet) {
+            std::array<std::vector<bool>, kMaxBindingsPerGroup> arrayElementsSet;
+            for (uint32_t i = 0; i < bindingCount; ++i) {
+                const BindGroupBinding& binding = bindings[i];
+                uint32_t bindingIndex = binding.binding;
+
+                // Check that we can set this binding.
+                if (bindingIndex >= kMaxBindingsPerGroup) {
+                    return DAWN_VALIDATION_ERROR("binding index too high");
+                }
+
+                if (!layoutInfo.mask[bindingIndex]) {
+                    return DAWN_VALIDATION_ERROR("setting non-existent binding");
+                }
+
+                uint32_t arrayLength = layoutInfo.arrayLengths[bindingIndex];
+                if (arrayLength != 0) {
+                    if (binding.arrayElement >= arrayLength) {
+                        return DAWN_VALIDATION_ERROR("binding array element out of bounds");
+                    }
+
+                    std::vector<bool>& elementsSet = arrayElementsSet[bindingIndex];
+                    if (elementsSet.empty()) {
+                        elementsSet.resize(arrayLength, false);
+                    }
+                    if (elementsSet[binding.arrayElement]) {
+                        return DAWN_VALIDATION_ERROR("binding array element set twice");
+                    }
+                    elementsSet[binding.arrayElement] = true;
+                } else {
+                    if (binding.arrayElement != 0) {
+                        return DAWN_VALIDATION_ERROR(
+                            "array element must be 0 for bindings that aren't arrays");
+                    }
+                    if ((*bindingsSet)[bindingIndex]) {
+                        return DAWN_VALIDATION_ERROR("binding set twice");
+                    }
+                }
+                bindingsSet->set(bindingIndex);
+
+                // Perform binding-type specific validation.
+                switch (layoutInfo.types[bindingIndex]) {
+                    case wgpu::BindingType::UniformBuffer:
+                        DAWN_TRY(
+                            ValidateBufferBinding(device, binding, wgpu::BufferUsage::Uniform));
+                        break;
+                    case wgpu::BindingType::StorageBuffer:
+                    case wgpu::BindingType::ReadonlyStorageBuffer:
+                        DAWN_TRY(
+                            ValidateBufferBinding(device, binding, wgpu::BufferUsage::Storage));
+                        break;
+                    case wgpu::BindingType::SampledTexture:
+                        DAWN_TRY(ValidateTextureBinding(
+                            device, binding, wgpu::TextureUsage::Sampled,
+                            layoutInfo.multisampled[bindingIndex],
+                            layoutInfo.textureComponentTypes[bindingIndex],
+                            layoutInfo.textureDimensions[bindingIndex]));
+                        break;
+                    case wgpu::BindingType::Sampler:
+                        DAWN_TRY(ValidateSamplerBinding(device, binding));
+                        break;
+                    case wgpu::BindingType::StorageTexture:
+                        UNREACHABLE();
+                        break;
+                    case wgpu::BindingType::AccelerationContainer:
+                        DAWN_TRY(ValidateAccelerationContainerBinding(device, binding));
+                        break;
+                }
+            }
+
+            return {};
+        }
+
+    }  // anonymous namespace
+
     MaybeError ValidateBindGroupDescriptor(DeviceBase* device,
                                            const BindGroupDescriptor* descriptor) {
         if (descriptor->nextInChain != nullptr) {
@@ -138,62 +225,45 @@ namespace dawn_native {
         const BindGroupLayoutBase::LayoutBindingInfo& layoutInfo =
             descriptor->layout->GetBindingInfo();
 
-        if (descriptor->bindingCount != layoutInfo.mask.count()) {
+        std::bitset<kMaxBindingsPerGroup> arrayBindings;
+        for (uint32_t bindingIndex : IterateBitSet(layoutInfo.mask)) {
+            arrayBindings.set(bindingIndex, layoutInfo.arrayLengths[bindingIndex] != 0);
+        }
+
+        // Binding arrays are partially bound so they can have any number of elements set.
+        if (arrayBindings.none() && descriptor->bindingCount != layoutInfo.mask.count()) {
             return DAWN_VALIDATION_ERROR("numBindings mismatch");
         }
 
         std::bitset<kMaxBindingsPerGroup> bindingsSet;
-        for (uint32_t i = 0; i < descriptor->bindingCount; ++i) {
-            const BindGroupBinding& binding = descriptor->bindings[i];
-            uint32_t bindingIndex = binding.binding;
-
-            // Check that we can set this binding.
-            if (bindingIndex >= kMaxBindingsPerGroup) {
-                return DAWN_VALIDATION_ERROR("binding index too high");
-            }
+        DAWN_TRY(ValidateBindingsForLayout(device, layoutInfo, descriptor->bindingCount,
+                                           descriptor->bindings, &bindingsSet));
 
-            if (!layoutInfo.mask[bindingIndex]) {
-                return DAWN_VALIDATION_ERROR("setting non-existent binding");
-            }
-
-            if (bindingsSet[bindingIndex]) {
-                return DAWN_VALIDATION_ERROR("binding set twice");
-            }
-            bindingsSet.set(bindingIndex);
-
-            // Perform binding-type specific validation.
-            switch (layoutInfo.types[bindingIndex]) {
-                case wgpu::BindingType::UniformBuffer:
-                    DAWN_TRY(ValidateBufferBinding(device, binding, wgpu::BufferUsage::Uniform));
-                    break;
-                case wgpu::BindingType::StorageBuffer:
-                case wgpu::BindingType::ReadonlyStorageBuffer:
-                    DAWN_TRY(ValidateBufferBinding(device, binding, wgpu::BufferUsage::Storage));
-                    break;
-                case wgpu::BindingType::SampledTexture:
-                    DAWN_TRY(ValidateTextureBinding(device, binding, wgpu::TextureUsage::Sampled,
-                                                    layoutInfo.multisampled[bindingIndex],
-                                                    layoutInfo.textureComponentTypes[bindingIndex],
-                                                    layoutInfo.textureDimensions[bindingIndex]));
-                    break;
-                case wgpu::BindingType::Sampler:
-                    DAWN_TRY(ValidateSamplerBinding(device, binding));
-                    break;
-                case wgpu::BindingType::StorageTexture:
-                    UNREACHABLE();
-                    break;
-                case wgpu::BindingType::AccelerationContainer:
-                    DAWN_TRY(ValidateAccelerationContainerBinding(device, binding));
-                    break;
-            }
-        }
-
-        // This should always be true because
+        // When there are no binding arrays this should always be true because
         //  - numBindings has to match between the bind group and its layout.
         //  - Each binding must be set at most once
         //
-        // We don't validate the equality because it wouldn't be possible to cover it with a test.
-        ASSERT(bindingsSet == layoutInfo.mask);
+        // Otherwise bindingCount can't be checked upfront, so make sure all the bindings that
+        // aren't arrays have been set.
+        ASSERT(arrayBindings.any() || bindingsSet == layoutInfo.mask);
+        if ((bindingsSet | arrayBindings) != layoutInfo.mask) {
+            return DAWN_VALIDATION_ERROR("some bindings were not set");
+        }
+
+        return {};
+    }
+
+    MaybeError ValidateDerivedBindGroupBindings(DeviceBase* device,
+                                                BindGroupBase* parent,
+                                                uint32_t bindingCount,
+                                                const BindGroupBinding* bindings) {
+        DAWN_TRY(device->ValidateObject(parent));
+
+        // Only the replaced bindings need to be validated, the other ones were validated when
+        // creating the parent.
+        std::bitset<kMaxBindingsPerGroup> bindingsSet;
+        DAWN_TRY(ValidateBindingsForLayout(device, parent->GetLayout()->GetBindingInfo(),
+                                           bindingCount, bindings, &bindingsSet));
 
         return {};
     }
@@ -202,42 +272,119 @@ namespace dawn_native {
 
     BindGroupBase::BindGroupBase(DeviceBase* device, const BindGroupDescriptor* descriptor)
         : ObjectBase(device), mLayout(descriptor->layout) {
+        mOwnedBindings = mLayout->GetBindingInfo().mask;
         for (uint32_t i = 0; i < descriptor->bindingCount; ++i) {
-            const BindGroupBinding& binding = descriptor->bindings[i];
+            SetBinding(descriptor->bindings[i]);
+        }
+        SortBindingArrays();
+    }
 
+    BindGroupBase::BindGroupBase(DeviceBase* device,
+                                 BindGroupBase* parent,
+                                 uint32_t bindingCount,
+                                 const BindGroupBinding* bindings)
+        : ObjectBase(device), mLayout(parent->GetLayout()) {
+        // Always share the bindings of the root bind group so that deriving repeatedly from
+        // derived bind groups doesn't build chains of bind groups. The bindings the parent
+        // replaced are copied instead.
+        if (parent->mParent.Get() != nullptr) {
+            mParent = parent->mParent;
+            mOwnedBindings = parent->mOwnedBindings;
+            for (uint32_t binding : IterateBitSet(mOwnedBindings)) {
+                mBindings[binding] = parent->mBindings[binding];
+                mOffsets[binding] = parent->mOffsets[binding];
+                mSizes[binding] = parent->mSizes[binding];
+                mBindingArrays[binding] = parent->mBindingArrays[binding];
+            }
+        } else {
+            mParent = parent;
+        }
+
+        for (uint32_t i = 0; i < bindingCount; ++i) {
+            const BindGroupBinding& binding = bindings[i];
             uint32_t bindingIndex = binding.binding;
             ASSERT(bindingIndex < kMaxBindingsPerGroup);
 
-            // Only a single binding type should be set, so once we found it we can skip to the
-            // next loop iteration.
+            if (!mOwnedBindings[bindingIndex]) {
+                // Replacing an element of a binding array keeps its other elements.
+                if (mLayout->GetBindingInfo().arrayLengths[bindingIndex] != 0) {
+                    mBindingArrays[bindingIndex] = mParent->mBindingArrays[bindingIndex];
+                }
+                mOwnedBindings.set(bindingIndex);
+            } else {
+                mBindings[bindingIndex] = nullptr;
+            }
+
+            std::vector<BindingArrayElement>& elements = mBindingArrays[bindingIndex];
+            elements.erase(std::remove_if(elements.begin(), elements.end(),
+                                          [&](const BindingArrayElement& element) {
+                                              return element.arrayElement == binding.arrayElement;
+                                          }),
+                           elements.end());
+
+            SetBinding(binding);
+        }
+        SortBindingArrays();
+    }
+
+    void BindGroupBase::SetBinding(const BindGroupBinding& binding) {
+        uint32_t bindingIndex = binding.binding;
+        ASSERT(bindingIndex < kMaxBindingsPerGroup);
 
+        if (mLayout->GetBindingInfo().arrayLengths[bindingIndex] != 0) {
+            BindingArrayElement element = {};
+            element.arrayElement = binding.arrayElement;
             if (binding.buffer != nullptr) {
-                ASSERT(mBindings[bindingIndex].Get() == nullptr);
-                mBindings[bindingIndex] = binding.buffer;
-                mOffsets[bindingIndex] = binding.offset;
-                uint64_t bufferSize =
+                element.resource = binding.buffer;
+                element.offset = binding.offset;
+                element.size =
                     (binding.size == wgpu::kWholeSize) ? binding.buffer->GetSize() : binding.size;
-                mSizes[bindingIndex] = bufferSize;
-                continue;
+            } else {
+                ASSERT(binding.textureView != nullptr);
+                element.resource = binding.textureView;
             }
+            mBindingArrays[bindingIndex].push_back(std::move(element));
+            return;
+        }
 
-            if (binding.textureView != nullptr) {
-                ASSERT(mBindings[bindingIndex].Get() == nullptr);
-                mBindings[bindingIndex] = binding.textureView;
-                continue;
-            }
+        // Only a single binding type should be set, so once we found it we can return.
 
-            if (binding.sampler != nullptr) {
-                ASSERT(mBindings[bindingIndex].Get() == nullptr);
-                mBindings[bindingIndex] = binding.sampler;
-                continue;
-            }
+        if (binding.buffer != nullptr) {
+            ASSERT(mBindings[bindingIndex].Get() == nullptr);
+            mBindings[bindingIndex] = binding.buffer;
+            mOffsets[bindingIndex] = binding.offset;
+            uint64_t bufferSize =
+                (binding.size == wgpu::kWholeSize) ? binding.buffer->GetSize() : binding.size;
+            mSizes[bindingIndex] = bufferSize;
+            return;
+        }
 
-            if (binding.accelerationContainer != nullptr) {
-                ASSERT(mBindings[bindingIndex].Get() == nullptr);
-                mBindings[bindingIndex] = binding.accelerationContainer;
-                continue;
-            }
+        if (binding.textureView != nullptr) {
+            ASSERT(mBindings[bindingIndex].Get() == nullptr);
+            mBindings[bindingIndex] = binding.textureView;
+            return;
+        }
+
+        if (binding.sampler != nullptr) {
+            ASSERT(mBindings[bindingIndex].Get() == nullptr);
+            mBindings[bindingIndex] = binding.sampler;
+            return;
+        }
+
+        if (binding.accelerationContainer != nullptr) {
+            ASSERT(mBindings[bindingIndex].Get() == nullptr);
+            mBindings[bindingIndex] = binding.accelerationContainer;
+            return;
+        }
+    }
+
+    void BindGroupBase::SortBindingArrays() {
+        // Keep the elements sorted so that backends can write contiguous ranges at once.
+        for (std::vector<BindingArrayElement>& elements : mBindingArrays) {
+            std::sort(elements.begin(), elements.end(),
+                      [](const BindingArrayElement& a, const BindingArrayElement& b) {
+                          return a.arrayElement < b.arrayElement;
+                      });
         }
     }
 
@@ -259,12 +406,14 @@ namespace dawn_native {
         ASSERT(!IsError());
         ASSERT(binding < kMaxBindingsPerGroup);
         ASSERT(mLayout->GetBindingInfo().mask[binding]);
+        ASSERT(mLayout->GetBindingInfo().arrayLengths[binding] == 0);
         ASSERT(mLayout->GetBindingInfo().types[binding] == wgpu::BindingType::UniformBuffer ||
                mLayout->GetBindingInfo().types[binding] == wgpu::BindingType::StorageBuffer ||
                mLayout->GetBindingInfo().types[binding] ==
                    wgpu::BindingType::ReadonlyStorageBuffer);
-        BufferBase* buffer = static_cast<BufferBase*>(mBindings[binding].Get());
-        return {buffer, mOffsets[binding], mSizes[binding]};
+        BindGroupBase* source = GetBindingSource(binding);
+        BufferBase* buffer = static_cast<BufferBase*>(source->mBindings[binding].Get());
+        return {buffer, source->mOffsets[binding], source->mSizes[binding]};
     }
 
     SamplerBase* BindGroupBase::GetBindingAsSampler(size_t binding) {
@@ -272,7 +421,7 @@ namespace dawn_native {
         ASSERT(binding < kMaxBindingsPerGroup);
         ASSERT(mLayout->GetBindingInfo().mask[binding]);
         ASSERT(mLayout->GetBindingInfo().types[binding] == wgpu::BindingType::Sampler);
-        return static_cast<SamplerBase*>(mBindings[binding].Get());
+        return static_cast<SamplerBase*>(GetBindingSource(binding)->mBindings[binding].Get());
     }
 
     RayTracingAccelerationContainerBase* BindGroupBase::GetBindingAsRayTracingAccelerationContainer(
@@ -281,15 +430,38 @@ namespace dawn_native {
         ASSERT(binding < kMaxBindingsPerGroup);
         ASSERT(mLayout->GetBindingInfo().mask[binding]);
         ASSERT(mLayout->GetBindingInfo().types[binding] == wgpu::BindingType::AccelerationContainer);
-        return static_cast<RayTracingAccelerationContainerBase*>(mBindings[binding].Get());
+        return static_cast<RayTracingAccelerationContainerBase*>(
+            GetBindingSource(binding)->mBindings[binding].Get());
     }
 
     TextureViewBase* BindGroupBase::GetBindingAsTextureView(size_t binding) {
         ASSERT(!IsError());
         ASSERT(binding < kMaxBindingsPerGroup);
         ASSERT(mLayout->GetBindingInfo().mask[binding]);
+        ASSERT(mLayout->GetBindingInfo().arrayLengths[binding] == 0);
         ASSERT(mLayout->GetBindingInfo().types[binding] == wgpu::BindingType::SampledTexture);
-        return static_cast<TextureViewBase*>(mBindings[binding].Get());
+        return static_cast<TextureViewBase*>(GetBindingSource(binding)->mBindings[binding].Get());
+    }
+
+    std::vector<BindingArrayElement>& BindGroupBase::GetBindingArrayElements(size_t binding) {
+        ASSERT(!IsError());
+        ASSERT(binding < kMaxBindingsPerGroup);
+        ASSERT(mLayout->GetBindingInfo().mask[binding]);
+        ASSERT(mLayout->GetBindingInfo().arrayLengths[binding] != 0);
+        return GetBindingSource(binding)->mBindingArrays[binding];
+    }
+
+    BindGroupBase* BindGroupBase::GetBindingSource(size_t binding) {
+        if (mOwnedBindings[binding]) {
+            return this;
+        }
+        ASSERT(mParent.Get() != nullptr);
+        return mParent.Get();
+    }
+
+    BindGroupBase* BindGroupBase::CreateDerived(uint32_t bindingCount,
+                                                const BindGroupBinding* bindings) {
+        return GetDevice()->CreateDerivedBindGroup(this, bindingCount, bindings);
     }
 
 }  // namespace dawn_native
@@ -24,6 +24,8 @@
 #include "dawn_native/dawn_platform.h"
 
 #include <array>
+#include <bitset>
+#include <vector>
 
 namespace dawn_native {
 
@@ -31,6 +33,10 @@ namespace dawn_native {
 
     MaybeError ValidateBindGroupDescriptor(DeviceBase* device,
                                            const BindGroupDescriptor* descriptor);
+    MaybeError ValidateDerivedBindGroupBindings(DeviceBase* device,
+                                                BindGroupBase* parent,
+                                                uint32_t bindingCount,
+                                                const BindGroupBinding* bindings);
 
     struct BufferBinding {
         BufferBase* buffer;
@@ -38,25 +44,55 @@ namespace dawn_native {
         uint64_t size;
     };
 
+    // An element of a binding array. Binding arrays are partially bound so only the elements
+    // that were set in the descriptor are stored.
+    struct BindingArrayElement {
+        uint32_t arrayElement;
+        // A BufferBase for storage buffer arrays or a TextureViewBase for sampled texture arrays.
+        Ref<ObjectBase> resource;
+        uint64_t offset;
+        uint64_t size;
+    };
+
     class BindGroupBase : public ObjectBase {
       public:
         BindGroupBase(DeviceBase* device, const BindGroupDescriptor* descriptor);
+        // Creates a bind group with the bindings of `parent` except for `bindings` which replace
+        // the bindings (or binding array elements) with the same index.
+        BindGroupBase(DeviceBase* device,
+                      BindGroupBase* parent,
+                      uint32_t bindingCount,
+                      const BindGroupBinding* bindings);
 
         static BindGroupBase* MakeError(DeviceBase* device);
 
+        // Dawn API
+        BindGroupBase* CreateDerived(uint32_t bindingCount, const BindGroupBinding* bindings);
+
         BindGroupLayoutBase* GetLayout();
         BufferBinding GetBindingAsBufferBinding(size_t binding);
         SamplerBase* GetBindingAsSampler(size_t binding);
         TextureViewBase* GetBindingAsTextureView(size_t binding);
         RayTracingAccelerationContainerBase* GetBindingAsRayTracingAccelerationContainer(size_t binding);
+        std::vector<BindingArrayElement>& GetBindingArrayElements(size_t binding);
 
       private:
         BindGroupBase(DeviceBase* device, ObjectBase::ErrorTag tag);
 
+        void SetBinding(const BindGroupBinding& binding);
+        void SortBindingArrays();
+        BindGroupBase* GetBindingSource(size_t binding);
+
         Ref<BindGroupLayoutBase> mLayout;
         std::array<Ref<ObjectBase>, kMaxBindingsPerGroup> mBindings;
         std::array<uint32_t, kMaxBindingsPerGroup> mOffsets;
         std::array<uint32_t, kMaxBindingsPerGroup> mSizes;
+        std::array<std::vector<BindingArrayElement>, kMaxBindingsPerGroup> mBindingArrays;
+
+        // Derived bind groups only store the bindings that differ from the root bind group they
+        // were derived from, and share the references it holds for the other bindings.
+        Ref<BindGroupBase> mParent;
+        std::bitset<kMaxBindingsPerGroup> mOwnedBindings;
     };
 
 }  // namespace dawn_native
@@ -23,13 +23,14 @@
 
 namespace dawn_native {
 
-    MaybeError ValidateBindGroupLayoutDescriptor(DeviceBase*,
+    MaybeError ValidateBindGroupLayoutDescriptor(DeviceBase* device,
                                                  const BindGroupLayoutDescriptor* descriptor) {
         if (descriptor->nextInChain != nullptr) {
             return DAWN_VALIDATION_ERROR("nextInChain must be nullptr");
         }
 
         std::bitset<kMaxBindingsPerGroup> bindingsSet;
+        bool hasBindingArrays = false;
         uint32_t dynamicUniformBufferCount = 0;
         uint32_t dynamicStorageBufferCount = 0;
         for (uint32_t i = 0; i < descriptor->bindingCount; ++i) {
@@ -87,6 +88,30 @@ namespace dawn_native {
                     "BindGroupLayoutBinding::multisampled must be false (for now)");
             }
 
+            if (binding.arrayLength != 0) {
+                if (!device->IsExtensionEnabled(Extension::DescriptorIndexing)) {
+                    return DAWN_VALIDATION_ERROR(
+                        "Binding arrays require the descriptor_indexing extension");
+                }
+                if (binding.arrayLength > kMaxBindingArrayLength) {
+                    return DAWN_VALIDATION_ERROR("Binding array length exceeds the maximum value");
+                }
+                if (binding.hasDynamicOffset) {
+                    return DAWN_VALIDATION_ERROR("Binding arrays cannot be dynamic");
+                }
+
+                switch (binding.type) {
+                    case wgpu::BindingType::SampledTexture:
+                    case wgpu::BindingType::StorageBuffer:
+                    case wgpu::BindingType::ReadonlyStorageBuffer:
+                        break;
+                    default:
+                        return DAWN_VALIDATION_ERROR(
+                            "Only sampled textures and storage buffers can be binding arrays");
+                }
+                hasBindingArrays = true;
+            }
+
             bindingsSet.set(binding.binding);
         }
 
@@ -100,6 +125,13 @@ namespace dawn_native {
                 "The number of dynamic storage buffer exceeds the maximum value");
         }
 
+        // Binding arrays are updated after bind on Vulkan, which disallows dynamic buffers in the
+        // same descriptor set.
+        if (hasBindingArrays && dynamicUniformBufferCount + dynamicStorageBufferCount > 0) {
+            return DAWN_VALIDATION_ERROR(
+                "Bind group layouts with binding arrays cannot have dynamic bindings");
+        }
+
         return {};
     }
 
@@ -110,7 +142,8 @@ namespace dawn_native {
 
             for (uint32_t binding : IterateBitSet(info.mask)) {
                 HashCombine(&hash, info.visibilities[binding], info.types[binding],
-                            info.textureComponentTypes[binding], info.textureDimensions[binding]);
+                            info.textureComponentTypes[binding], info.textureDimensions[binding],
+                            info.arrayLengths[binding]);
             }
 
             return hash;
@@ -127,7 +160,8 @@ namespace dawn_native {
                 if ((a.visibilities[binding] != b.visibilities[binding]) ||
                     (a.types[binding] != b.types[binding]) ||
                     (a.textureComponentTypes[binding] != b.textureComponentTypes[binding]) ||
-                    (a.textureDimensions[binding] != b.textureDimensions[binding])) {
+                    (a.textureDimensions[binding] != b.textureDimensions[binding]) ||
+                    (a.arrayLengths[binding] != b.arrayLengths[binding])) {
                     return false;
                 }
             }
@@ -174,6 +208,7 @@ namespace dawn_native {
             }
 
             mBindingInfo.multisampled.set(index, binding.multisampled);
+            mBindingInfo.arrayLengths[index] = binding.arrayLength;
 
             ASSERT(!mBindingInfo.mask[index]);
             mBindingInfo.mask.set(index);
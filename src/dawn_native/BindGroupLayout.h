@@ -42,6 +42,8 @@ namespace dawn_native {
             std::array<wgpu::BindingType, kMaxBindingsPerGroup> types;
             std::array<wgpu::TextureComponentType, kMaxBindingsPerGroup> textureComponentTypes;
             std::array<wgpu::TextureViewDimension, kMaxBindingsPerGroup> textureDimensions;
+            // The number of descriptors in binding arrays, 0 for bindings that aren't arrays.
+            std::array<uint32_t, kMaxBindingsPerGroup> arrayLengths;
             std::bitset<kMaxBindingsPerGroup> hasDynamicOffset;
             std::bitset<kMaxBindingsPerGroup> multisampled;
             std::bitset<kMaxBindingsPerGroup> mask;
@@ -46,9 +46,12 @@ namespace dawn_native {
                 if (mBindGroups[index] != bindGroup) {
                     mDirtyBindGroups.set(index);
                     mDirtyBindGroupsObjectChangedOrIsDynamic.set(index);
-                }
-
-                if (dynamicOffsetCount > 0) {
+                } else if (dynamicOffsetCount > 0 &&
+                           !SameDynamicOffsets(mDynamicOffsets[index].data(), dynamicOffsetCount,
+                                               dynamicOffsets)) {
+                    // Setting the same bind group with the same dynamic offsets is a no-op. This
+                    // keeps the common pattern of drawing many objects out of a single dynamic
+                    // uniform buffer from re-applying bind groups that didn't change.
                     mDirtyBindGroupsObjectChangedOrIsDynamic.set(index);
                 }
             }
@@ -128,6 +131,23 @@ namespace dawn_native {
                                       uint32_t* dynamicOffsets) {
             memcpy(data, dynamicOffsets, sizeof(uint32_t) * dynamicOffsetCount);
         }
+
+        static bool SameDynamicOffsets(const uint64_t* data,
+                                       uint32_t dynamicOffsetCount,
+                                       const uint32_t* dynamicOffsets) {
+            for (uint32_t i = 0; i < dynamicOffsetCount; ++i) {
+                if (data[i] != static_cast<uint64_t>(dynamicOffsets[i])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static bool SameDynamicOffsets(const uint32_t* data,
+                                       uint32_t dynamicOffsetCount,
+                                       const uint32_t* dynamicOffsets) {
+            return memcmp(data, dynamicOffsets, sizeof(uint32_t) * dynamicOffsetCount) == 0;
+        }
     };
 
 }  // namespace dawn_native
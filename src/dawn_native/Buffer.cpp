@@ -18,6 +18,7 @@
 #include "dawn_native/Device.h"
 #include "dawn_native/DynamicUploader.h"
 #include "dawn_native/ErrorData.h"
+#include "dawn_native/Heap.h"
 #include "dawn_native/ValidationUtils_autogen.h"
 
 #include <cstdio>
@@ -85,15 +86,19 @@ namespace dawn_native {
 
     }  // anonymous namespace
 
-    MaybeError ValidateBufferDescriptor(DeviceBase*, const BufferDescriptor* descriptor) {
-        if (descriptor->nextInChain != nullptr) {
-            return DAWN_VALIDATION_ERROR("nextInChain must be nullptr");
-        }
+    MaybeError ValidateBufferDescriptor(DeviceBase* device, const BufferDescriptor* descriptor) {
+        DAWN_TRY(ValidatePlacedResourceChain(device, descriptor->nextInChain));
 
         DAWN_TRY(ValidateBufferUsage(descriptor->usage));
 
         wgpu::BufferUsage usage = descriptor->usage;
 
+        // Mappable buffers keep their own host-visible memory.
+        if (descriptor->nextInChain != nullptr &&
+            (usage & (wgpu::BufferUsage::MapRead | wgpu::BufferUsage::MapWrite))) {
+            return DAWN_VALIDATION_ERROR("Mappable buffers cannot be placed in a heap");
+        }
+
         const wgpu::BufferUsage kMapWriteAllowedUsages =
             wgpu::BufferUsage::MapWrite | wgpu::BufferUsage::CopySrc;
         if (usage & wgpu::BufferUsage::MapWrite && (usage & kMapWriteAllowedUsages) != usage) {
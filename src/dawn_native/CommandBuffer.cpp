@@ -23,7 +23,10 @@
 namespace dawn_native {
 
     CommandBufferBase::CommandBufferBase(CommandEncoder* encoder, const CommandBufferDescriptor*)
-        : ObjectBase(encoder->GetDevice()), mResourceUsages(encoder->AcquireResourceUsages()) {
+        : ObjectBase(encoder->GetDevice()),
+          mResourceUsages(encoder->AcquireResourceUsages()),
+          mReferencedObjects(encoder->AcquireReferencedObjects()),
+          mRenderPassMerges(encoder->AcquireRenderPassMerges()) {
     }
 
     CommandBufferBase::CommandBufferBase(DeviceBase* device, ObjectBase::ErrorTag tag)
@@ -39,6 +42,10 @@ namespace dawn_native {
         return mResourceUsages;
     }
 
+    bool CommandBufferBase::IsRenderPassMergedWithPrevious(size_t renderPassIndex) const {
+        return renderPassIndex < mRenderPassMerges.size() && mRenderPassMerges[renderPassIndex];
+    }
+
     bool IsCompleteSubresourceCopiedTo(const TextureBase* texture,
                                        const Extent3D copySize,
                                        const uint32_t mipLevel) {
@@ -21,6 +21,8 @@
 #include "dawn_native/ObjectBase.h"
 #include "dawn_native/PassResourceUsage.h"
 
+#include <vector>
+
 namespace dawn_native {
 
     struct BeginRenderPassCmd;
@@ -32,10 +34,18 @@ namespace dawn_native {
 
         const CommandBufferResourceUsage& GetResourceUsages() const;
 
+        // Whether the render pass with this index, counting only render passes, can be recorded
+        // as a continuation of the previous render pass. See ComputeRenderPassMerges.
+        bool IsRenderPassMergedWithPrevious(size_t renderPassIndex) const;
+
       private:
         CommandBufferBase(DeviceBase* device, ObjectBase::ErrorTag tag);
 
         CommandBufferResourceUsage mResourceUsages;
+        // Keeps alive the objects the commands point to without holding a reference.
+        std::vector<Ref<ObjectBase>> mReferencedObjects;
+        // Empty when the MergeRenderPasses toggle is disabled.
+        std::vector<bool> mRenderPassMerges;
     };
     bool IsCompleteSubresourceCopiedTo(const TextureBase* texture,
                                        const Extent3D copySize,
@@ -15,6 +15,7 @@
 #include "dawn_native/CommandEncoder.h"
 
 #include "common/BitSetIterator.h"
+#include "dawn_native/Adapter.h"
 #include "dawn_native/BindGroup.h"
 #include "dawn_native/Buffer.h"
 #include "dawn_native/CommandBuffer.h"
@@ -27,6 +28,7 @@
 #include "dawn_native/RenderPassEncoder.h"
 #include "dawn_native/RayTracingAccelerationContainer.h"
 #include "dawn_native/RayTracingPassEncoder.h"
+#include "dawn_native/RenderPassMerging.h"
 #include "dawn_native/RenderPipeline.h"
 #include "dawn_native/ValidationUtils_autogen.h"
 #include "dawn_platform/DawnPlatform.h"
@@ -312,6 +314,42 @@ namespace dawn_native {
             return {};
         }
 
+        MaybeError ValidateGenerateMipmaps(const GenerateMipmapsCmd* cmd) {
+            const TextureBase* texture = cmd->texture.Get();
+
+            if (texture->GetDimension() != wgpu::TextureDimension::e2D) {
+                return DAWN_VALIDATION_ERROR("Mipmaps can only be generated for 2D textures");
+            }
+
+            if (texture->GetSampleCount() > 1) {
+                return DAWN_VALIDATION_ERROR(
+                    "Mipmaps cannot be generated for multisampled textures");
+            }
+
+            if (cmd->levelCount == 0) {
+                return DAWN_VALIDATION_ERROR("Mipmap generation level count must be at least 1");
+            }
+
+            if (uint64_t(cmd->baseLevel) + uint64_t(cmd->levelCount) >
+                uint64_t(texture->GetNumMipLevels())) {
+                return DAWN_VALIDATION_ERROR("Mipmap generation levels are outside the texture");
+            }
+
+            // Each level is filtered from the previous one by the blit or render paths of the
+            // backends so only filterable color formats that can be rendered to are supported.
+            const Format& format = texture->GetFormat();
+            if (!format.IsColor() || format.isCompressed || !format.isRenderable ||
+                format.type != Format::Type::Float) {
+                return DAWN_VALIDATION_ERROR(
+                    "Mipmaps can only be generated for renderable float color formats");
+            }
+
+            DAWN_TRY(ValidateCanUseAs(texture, wgpu::TextureUsage::CopySrc));
+            DAWN_TRY(ValidateCanUseAs(texture, wgpu::TextureUsage::CopyDst));
+
+            return {};
+        }
+
         MaybeError ValidateAttachmentArrayLayersAndLevelCount(const TextureViewBase* attachment) {
             // Currently we do not support layered rendering.
             if (attachment->GetLayerCount() > 1) {
@@ -360,6 +398,10 @@ namespace dawn_native {
             return {};
         }
 
+        bool IsTransientAttachment(const TextureViewBase* view) {
+            return view->GetTexture()->GetUsage() & wgpu::TextureUsage::TransientAttachment;
+        }
+
         MaybeError ValidateResolveTarget(
             const DeviceBase* device,
             const RenderPassColorAttachmentDescriptor& colorAttachment) {
@@ -380,6 +422,10 @@ namespace dawn_native {
                 return DAWN_VALIDATION_ERROR("Cannot use multisampled texture as resolve target");
             }
 
+            if (IsTransientAttachment(resolveTarget)) {
+                return DAWN_VALIDATION_ERROR("Cannot use a transient attachment as resolve target");
+            }
+
             if (resolveTarget->GetLayerCount() > 1) {
                 return DAWN_VALIDATION_ERROR(
                     "The array layer count of the resolve target must be 1");
@@ -431,6 +477,14 @@ namespace dawn_native {
             DAWN_TRY(ValidateLoadOp(colorAttachment.loadOp));
             DAWN_TRY(ValidateStoreOp(colorAttachment.storeOp));
 
+            if (IsTransientAttachment(attachment) &&
+                (colorAttachment.loadOp != wgpu::LoadOp::Clear ||
+                 colorAttachment.storeOp != wgpu::StoreOp::Clear)) {
+                return DAWN_VALIDATION_ERROR(
+                    "Transient color attachments must be cleared at the start and the end of the "
+                    "pass");
+            }
+
             if (colorAttachment.loadOp == wgpu::LoadOp::Clear) {
                 if (std::isnan(colorAttachment.clearColor.r) ||
                     std::isnan(colorAttachment.clearColor.g) ||
@@ -473,6 +527,16 @@ namespace dawn_native {
             DAWN_TRY(ValidateStoreOp(depthStencilAttachment->depthStoreOp));
             DAWN_TRY(ValidateStoreOp(depthStencilAttachment->stencilStoreOp));
 
+            if (IsTransientAttachment(attachment) &&
+                (depthStencilAttachment->depthLoadOp != wgpu::LoadOp::Clear ||
+                 depthStencilAttachment->stencilLoadOp != wgpu::LoadOp::Clear ||
+                 depthStencilAttachment->depthStoreOp != wgpu::StoreOp::Clear ||
+                 depthStencilAttachment->stencilStoreOp != wgpu::StoreOp::Clear)) {
+                return DAWN_VALIDATION_ERROR(
+                    "Transient depth stencil attachments must be cleared at the start and the end "
+                    "of the pass");
+            }
+
             if (depthStencilAttachment->depthLoadOp == wgpu::LoadOp::Clear &&
                 std::isnan(depthStencilAttachment->clearDepth)) {
                 return DAWN_VALIDATION_ERROR("Depth clear value cannot be NaN");
@@ -555,6 +619,14 @@ namespace dawn_native {
         return mEncodingContext.AcquireCommands();
     }
 
+    std::vector<Ref<ObjectBase>> CommandEncoder::AcquireReferencedObjects() {
+        return mEncodingContext.AcquireReferencedObjects();
+    }
+
+    std::vector<bool> CommandEncoder::AcquireRenderPassMerges() {
+        return std::move(mRenderPassMerges);
+    }
+
     // Implementation of the API's command recording methods
 
     ComputePassEncoder* CommandEncoder::BeginComputePass(const ComputePassDescriptor* descriptor) {
@@ -861,6 +933,31 @@ namespace dawn_native {
         });
     }
 
+    void CommandEncoder::GenerateMipmaps(TextureBase* texture,
+                                         uint32_t baseLevel,
+                                         uint32_t levelCount) {
+        mEncodingContext.TryEncode(this, [&](CommandAllocator* allocator) -> MaybeError {
+            DAWN_TRY(GetDevice()->ValidateObject(texture));
+
+            // This is checked even when validation is skipped because the D3D12 backend has no
+            // blit command nor internal pipelines to downsample with.
+            if (GetDevice()->GetAdapter()->GetBackendType() == wgpu::BackendType::D3D12) {
+                return DAWN_VALIDATION_ERROR("Mipmap generation isn't supported on D3D12");
+            }
+
+            GenerateMipmapsCmd* cmd =
+                allocator->Allocate<GenerateMipmapsCmd>(Command::GenerateMipmaps);
+            cmd->texture = texture;
+            cmd->baseLevel = baseLevel;
+            cmd->levelCount = levelCount;
+
+            if (GetDevice()->IsValidationEnabled()) {
+                mTopLevelTextures.insert(texture);
+            }
+            return {};
+        });
+    }
+
     void CommandEncoder::InsertDebugMarker(const char* groupLabel) {
         mEncodingContext.TryEncode(this, [&](CommandAllocator* allocator) -> MaybeError {
             InsertDebugMarkerCmd* cmd =
@@ -907,6 +1004,12 @@ namespace dawn_native {
             return CommandBufferBase::MakeError(device);
         }
         ASSERT(!IsError());
+
+        if (device->IsToggleEnabled(Toggle::MergeRenderPasses)) {
+            mRenderPassMerges = ComputeRenderPassMerges(mEncodingContext.GetIterator(),
+                                                        mEncodingContext.GetPassUsages());
+        }
+
         return device->CreateCommandBuffer(this, descriptor);
     }
 
@@ -1071,6 +1174,11 @@ namespace dawn_native {
                                               wgpu::TextureUsage::CopyDst));
                 } break;
 
+                case Command::GenerateMipmaps: {
+                    const GenerateMipmapsCmd* cmd = commands->NextCommand<GenerateMipmapsCmd>();
+                    DAWN_TRY(ValidateGenerateMipmaps(cmd));
+                } break;
+
                 case Command::InsertDebugMarker: {
                     const InsertDebugMarkerCmd* cmd = commands->NextCommand<InsertDebugMarkerCmd>();
                     commands->NextData<char>(cmd->length + 1);
@@ -23,6 +23,7 @@
 #include "dawn_native/PassResourceUsage.h"
 
 #include <string>
+#include <vector>
 
 namespace dawn_native {
 
@@ -34,6 +35,8 @@ namespace dawn_native {
 
         CommandIterator AcquireCommands();
         CommandBufferResourceUsage AcquireResourceUsages();
+        std::vector<Ref<ObjectBase>> AcquireReferencedObjects();
+        std::vector<bool> AcquireRenderPassMerges();
 
         // Dawn API
         ComputePassEncoder* BeginComputePass(const ComputePassDescriptor* descriptor);
@@ -62,6 +65,8 @@ namespace dawn_native {
                                   const TextureCopyView* destination,
                                   const Extent3D* copySize);
 
+        void GenerateMipmaps(TextureBase* texture, uint32_t baseLevel, uint32_t levelCount);
+
         void InsertDebugMarker(const char* groupLabel);
         void PopDebugGroup();
         void PushDebugGroup(const char* groupLabel);
@@ -76,6 +81,7 @@ namespace dawn_native {
         std::set<BufferBase*> mTopLevelBuffers;
         std::set<TextureBase*> mTopLevelTextures;
         std::set<RayTracingAccelerationContainerBase*> mTopLevelAccelerationContainers;
+        std::vector<bool> mRenderPassMerges;
     };
 
 }  // namespace dawn_native
@@ -73,7 +73,7 @@ namespace dawn_native {
 
                 case Command::SetRenderPipeline: {
                     SetRenderPipelineCmd* cmd = commands->NextCommand<SetRenderPipelineCmd>();
-                    RenderPipelineBase* pipeline = cmd->pipeline.Get();
+                    RenderPipelineBase* pipeline = cmd->pipeline;
 
                     if (DAWN_UNLIKELY(pipeline->GetAttachmentState() != attachmentState)) {
                         return DAWN_VALIDATION_ERROR("Pipeline attachment state is not compatible");
@@ -87,7 +87,7 @@ namespace dawn_native {
                         commands->NextData<uint32_t>(cmd->dynamicOffsetCount);
                     }
 
-                    commandBufferState->SetBindGroup(cmd->index, cmd->group.Get());
+                    commandBufferState->SetBindGroup(cmd->index, cmd->group);
                 } break;
 
                 case Command::SetIndexBuffer: {
@@ -239,7 +239,7 @@ namespace dawn_native {
 
                 case Command::SetComputePipeline: {
                     SetComputePipelineCmd* cmd = commands->NextCommand<SetComputePipelineCmd>();
-                    ComputePipelineBase* pipeline = cmd->pipeline.Get();
+                    ComputePipelineBase* pipeline = cmd->pipeline;
                     commandBufferState.SetComputePipeline(pipeline);
                 } break;
 
@@ -248,7 +248,7 @@ namespace dawn_native {
                     if (cmd->dynamicOffsetCount > 0) {
                         commands->NextData<uint32_t>(cmd->dynamicOffsetCount);
                     }
-                    commandBufferState.SetBindGroup(cmd->index, cmd->group.Get());
+                    commandBufferState.SetBindGroup(cmd->index, cmd->group);
                 } break;
 
                 default:
@@ -298,7 +298,7 @@ namespace dawn_native {
                 case Command::SetRayTracingPipeline: {
                     SetRayTracingPipelineCmd* cmd =
                         commands->NextCommand<SetRayTracingPipelineCmd>();
-                    RayTracingPipelineBase* pipeline = cmd->pipeline.Get();
+                    RayTracingPipelineBase* pipeline = cmd->pipeline;
                     commandBufferState.SetRayTracingPipeline(pipeline);
                 } break;
 
@@ -307,7 +307,7 @@ namespace dawn_native {
                     if (cmd->dynamicOffsetCount > 0) {
                         commands->NextData<uint32_t>(cmd->dynamicOffsetCount);
                     }
-                    commandBufferState.SetBindGroup(cmd->index, cmd->group.Get());
+                    commandBufferState.SetBindGroup(cmd->index, cmd->group);
                 } break;
 
                 default:
@@ -120,6 +120,10 @@ namespace dawn_native {
                     }
                     cmd->~ExecuteBundlesCmd();
                 } break;
+                case Command::GenerateMipmaps: {
+                    GenerateMipmapsCmd* cmd = commands->NextCommand<GenerateMipmapsCmd>();
+                    cmd->~GenerateMipmapsCmd();
+                } break;
                 case Command::InsertDebugMarker: {
                     InsertDebugMarkerCmd* cmd = commands->NextCommand<InsertDebugMarkerCmd>();
                     commands->NextData<char>(cmd->length + 1);
@@ -270,6 +274,10 @@ namespace dawn_native {
                 commands->NextData<Ref<RenderBundleBase>>(cmd->count);
             } break;
 
+            case Command::GenerateMipmaps:
+                commands->NextCommand<GenerateMipmapsCmd>();
+                break;
+
             case Command::InsertDebugMarker: {
                 InsertDebugMarkerCmd* cmd = commands->NextCommand<InsertDebugMarkerCmd>();
                 commands->NextData<char>(cmd->length + 1);
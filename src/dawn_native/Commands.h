@@ -30,6 +30,9 @@ namespace dawn_native {
     // Definition of the commands that are present in the CommandIterator given by the
     // CommandBufferBuilder. There are not defined in CommandBuffer.h to break some header
     // dependencies: Ref<Object> needs Object to be defined.
+    // Commands that are recorded many times per pass hold borrowed pointers instead of Refs, the
+    // objects are kept alive by the references the encoding context hands to the command buffer
+    // or render bundle (see EncodingContext::ReferenceObject).
 
     enum class Command {
         BeginComputePass,
@@ -52,6 +55,7 @@ namespace dawn_native {
         EndRayTracingPass,
         EndRenderPass,
         ExecuteBundles,
+        GenerateMipmaps,
         InsertDebugMarker,
         PopDebugGroup,
         PushDebugGroup,
@@ -198,6 +202,12 @@ namespace dawn_native {
         uint32_t count;
     };
 
+    struct GenerateMipmapsCmd {
+        Ref<TextureBase> texture;
+        uint32_t baseLevel;
+        uint32_t levelCount;
+    };
+
     struct InsertDebugMarkerCmd {
         uint32_t length;
     };
@@ -209,15 +219,15 @@ namespace dawn_native {
     };
 
     struct SetComputePipelineCmd {
-        Ref<ComputePipelineBase> pipeline;
+        ComputePipelineBase* pipeline;
     };
 
     struct SetRayTracingPipelineCmd {
-        Ref<RayTracingPipelineBase> pipeline;
+        RayTracingPipelineBase* pipeline;
     };
 
     struct SetRenderPipelineCmd {
-        Ref<RenderPipelineBase> pipeline;
+        RenderPipelineBase* pipeline;
     };
 
     struct SetStencilReferenceCmd {
@@ -238,18 +248,18 @@ namespace dawn_native {
 
     struct SetBindGroupCmd {
         uint32_t index;
-        Ref<BindGroupBase> group;
+        BindGroupBase* group;
         uint32_t dynamicOffsetCount;
     };
 
     struct SetIndexBufferCmd {
-        Ref<BufferBase> buffer;
+        BufferBase* buffer;
         uint64_t offset;
     };
 
     struct SetVertexBufferCmd {
         uint32_t slot;
-        Ref<BufferBase> buffer;
+        BufferBase* buffer;
         uint64_t offset;
     };
 
@@ -90,6 +90,7 @@ namespace dawn_native {
             SetComputePipelineCmd* cmd =
                 allocator->Allocate<SetComputePipelineCmd>(Command::SetComputePipeline);
             cmd->pipeline = pipeline;
+            mEncodingContext->ReferenceObject(pipeline);
 
             return {};
         });
@@ -40,7 +40,8 @@ namespace dawn_native {
                                              const ComputePipelineDescriptor* descriptor)
         : PipelineBase(device, descriptor->layout, wgpu::ShaderStage::Compute),
           mModule(descriptor->computeStage.module),
-          mEntryPoint(descriptor->computeStage.entryPoint) {
+          mEntryPoint(descriptor->computeStage.entryPoint),
+          mConstants(GetSpecializationConstants(&descriptor->computeStage)) {
     }
 
     ComputePipelineBase::ComputePipelineBase(DeviceBase* device, ObjectBase::ErrorTag tag)
@@ -62,13 +63,14 @@ namespace dawn_native {
     size_t ComputePipelineBase::HashFunc::operator()(const ComputePipelineBase* pipeline) const {
         size_t hash = 0;
         HashCombine(&hash, pipeline->mModule.Get(), pipeline->mEntryPoint, pipeline->GetLayout());
+        HashSpecializationConstants(&hash, pipeline->mConstants);
         return hash;
     }
 
     bool ComputePipelineBase::EqualityFunc::operator()(const ComputePipelineBase* a,
                                                        const ComputePipelineBase* b) const {
         return a->mModule.Get() == b->mModule.Get() && a->mEntryPoint == b->mEntryPoint &&
-               a->GetLayout() == b->GetLayout();
+               a->mConstants == b->mConstants && a->GetLayout() == b->GetLayout();
     }
 
 }  // namespace dawn_native
@@ -45,6 +45,7 @@ namespace dawn_native {
         // TODO(cwallez@chromium.org): Store a crypto hash of the module instead.
         Ref<ShaderModuleBase> mModule;
         std::string mEntryPoint;
+        SpecializationConstants mConstants;
     };
 
 }  // namespace dawn_native
@@ -15,6 +15,7 @@
 #include "dawn_native/DawnNative.h"
 #include "dawn_native/Device.h"
 #include "dawn_native/Instance.h"
+#include "dawn_native/SwapChain.h"
 #include "dawn_platform/DawnPlatform.h"
 
 // Contains the entry-points into dawn_native
@@ -160,11 +161,55 @@ namespace dawn_native {
         return reinterpret_cast<WGPUInstance>(mImpl);
     }
 
+    void SetSwapChainMaxFrameLatency(WGPUSwapChain swapChain, uint32_t maxFrameLatency) {
+        dawn_native::SwapChainBase* swapChainBase =
+            reinterpret_cast<dawn_native::SwapChainBase*>(swapChain);
+        swapChainBase->SetMaxFrameLatency(maxFrameLatency);
+    }
+
+    bool GetSwapChainFrameStatistics(WGPUSwapChain swapChain,
+                                     SwapChainFrameStatistics* statistics) {
+        dawn_native::SwapChainBase* swapChainBase =
+            reinterpret_cast<dawn_native::SwapChainBase*>(swapChain);
+        return swapChainBase->GetLastFrameStatistics(statistics);
+    }
+
+    WGPUSwapChain CreateHeadlessSwapChain(WGPUDevice device,
+                                          const HeadlessSwapChainDescriptor* descriptor) {
+        dawn_native::DeviceBase* deviceBase = reinterpret_cast<dawn_native::DeviceBase*>(device);
+        return reinterpret_cast<WGPUSwapChain>(deviceBase->CreateHeadlessSwapChain(descriptor));
+    }
+
+    std::vector<uint8_t> GetPipelineManifest(WGPUDevice device) {
+        dawn_native::DeviceBase* deviceBase = reinterpret_cast<dawn_native::DeviceBase*>(device);
+        return deviceBase->GetPipelineManifest();
+    }
+
+    bool WarmUpPipelines(WGPUDevice device, const void* manifest, size_t size) {
+        dawn_native::DeviceBase* deviceBase = reinterpret_cast<dawn_native::DeviceBase*>(device);
+        return deviceBase->WarmUpPipelines(manifest, size);
+    }
+
+    bool WaitForIdle(WGPUDevice device, uint64_t timeoutNs) {
+        dawn_native::DeviceBase* deviceBase = reinterpret_cast<dawn_native::DeviceBase*>(device);
+        return deviceBase->WaitForIdle(timeoutNs);
+    }
+
+    int GetCompletionFd(WGPUDevice device) {
+        dawn_native::DeviceBase* deviceBase = reinterpret_cast<dawn_native::DeviceBase*>(device);
+        return deviceBase->GetCompletionFd();
+    }
+
     size_t GetLazyClearCountForTesting(WGPUDevice device) {
         dawn_native::DeviceBase* deviceBase = reinterpret_cast<dawn_native::DeviceBase*>(device);
         return deviceBase->GetLazyClearCountForTesting();
     }
 
+    bool ResetDeviceForTesting(WGPUDevice device) {
+        dawn_native::DeviceBase* deviceBase = reinterpret_cast<dawn_native::DeviceBase*>(device);
+        return deviceBase->ResetForTesting();
+    }
+
     std::vector<const char*> GetProcMapNamesForTestingInternal();
 
     std::vector<const char*> GetProcMapNamesForTesting() {
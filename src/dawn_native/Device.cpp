@@ -28,8 +28,12 @@
 #include "dawn_native/ErrorScopeTracker.h"
 #include "dawn_native/Fence.h"
 #include "dawn_native/FenceSignalTracker.h"
+#include "dawn_native/HeadlessSwapChain.h"
+#include "dawn_native/Heap.h"
 #include "dawn_native/Instance.h"
 #include "dawn_native/PipelineLayout.h"
+#include "dawn_native/PipelineManifest.h"
+#include "dawn_native/PollableEvent.h"
 #include "dawn_native/Queue.h"
 #include "dawn_native/RayTracingAccelerationContainer.h"
 #include "dawn_native/RayTracingPipeline.h"
@@ -38,6 +42,7 @@
 #include "dawn_native/RenderPipeline.h"
 #include "dawn_native/Sampler.h"
 #include "dawn_native/ShaderModule.h"
+#include "dawn_native/SpirvOptimizer.h"
 #include "dawn_native/SwapChain.h"
 #include "dawn_native/Texture.h"
 #include "dawn_native/ValidationUtils_autogen.h"
@@ -62,8 +67,33 @@ namespace dawn_native {
         ContentLessObjectCache<RenderPipelineBase> renderPipelines;
         ContentLessObjectCache<SamplerBase> samplers;
         ContentLessObjectCache<ShaderModuleBase> shaderModules;
+
+        // Error objects of types that are immutable once created can't be told apart, so a single
+        // one is shared by all the failed creations of that type instead of allocating each time.
+        Ref<BindGroupLayoutBase> errorBindGroupLayout;
+        Ref<ComputePipelineBase> errorComputePipeline;
+        Ref<PipelineLayoutBase> errorPipelineLayout;
+        Ref<RayTracingPipelineBase> errorRayTracingPipeline;
+        Ref<RenderPipelineBase> errorRenderPipeline;
+        Ref<SamplerBase> errorSampler;
+        Ref<ShaderModuleBase> errorShaderModule;
+        Ref<TextureViewBase> errorTextureView;
     };
 
+    namespace {
+
+        // Returns a new reference to the shared error object, creating it if needed.
+        template <typename T>
+        T* ReferenceSharedErrorObject(DeviceBase* device, Ref<T>* errorObject) {
+            if (errorObject->Get() == nullptr) {
+                *errorObject = AcquireRef(T::MakeError(device));
+            }
+            errorObject->Get()->Reference();
+            return errorObject->Get();
+        }
+
+    }  // anonymous namespace
+
     // DeviceBase
 
     DeviceBase::DeviceBase(AdapterBase* adapter, const DeviceDescriptor* descriptor)
@@ -74,6 +104,8 @@ namespace dawn_native {
         mErrorScopeTracker = std::make_unique<ErrorScopeTracker>(this);
         mFenceSignalTracker = std::make_unique<FenceSignalTracker>(this);
         mDynamicUploader = std::make_unique<DynamicUploader>(this);
+        mSpirvOptimizer = std::make_unique<SpirvOptimizer>(this);
+        mPipelineManifest = std::make_unique<PipelineManifest>();
         SetDefaultToggles();
 
         if (descriptor != nullptr) {
@@ -98,6 +130,9 @@ namespace dawn_native {
     }
 
     void DeviceBase::BaseDestructor() {
+        // The warmed up pipelines must be released while the backend device still exists.
+        mWarmedUpPipelines.clear();
+
         if (mLossStatus != LossStatus::Alive) {
             return;
         }
@@ -274,6 +309,10 @@ namespace dawn_native {
         DAWN_TRY_ASSIGN(backendObj, CreateComputePipelineImpl(descriptor));
         backendObj->SetIsCachedReference();
         mCaches->computePipelines.insert(backendObj);
+
+        if (IsToggleEnabled(Toggle::RecordPipelineManifest)) {
+            mPipelineManifest->RecordComputePipeline(descriptor);
+        }
         return backendObj;
     }
 
@@ -320,6 +359,10 @@ namespace dawn_native {
         DAWN_TRY_ASSIGN(backendObj, CreateRenderPipelineImpl(descriptor));
         backendObj->SetIsCachedReference();
         mCaches->renderPipelines.insert(backendObj);
+
+        if (IsToggleEnabled(Toggle::RecordPipelineManifest)) {
+            mPipelineManifest->RecordRenderPipeline(descriptor);
+        }
         return backendObj;
     }
 
@@ -354,6 +397,20 @@ namespace dawn_native {
 
     ResultOrError<ShaderModuleBase*> DeviceBase::GetOrCreateShaderModule(
         const ShaderModuleDescriptor* descriptor) {
+        // Modules are deduplicated on the optimized code, so modules that only differ by code the
+        // optimizer removes share the same backend object.
+        const ShaderModuleDescriptor* originalDescriptor = descriptor;
+        ShaderModuleDescriptor optimizedDescriptor;
+        if (IsToggleEnabled(Toggle::OptimizeShaderModules)) {
+            const std::vector<uint32_t>* optimizedCode =
+                mSpirvOptimizer->Optimize(descriptor->code, descriptor->codeSize);
+
+            optimizedDescriptor = *descriptor;
+            optimizedDescriptor.code = optimizedCode->data();
+            optimizedDescriptor.codeSize = static_cast<uint32_t>(optimizedCode->size());
+            descriptor = &optimizedDescriptor;
+        }
+
         ShaderModuleBase blueprint(this, descriptor);
 
         auto iter = mCaches->shaderModules.find(&blueprint);
@@ -366,6 +423,12 @@ namespace dawn_native {
         DAWN_TRY_ASSIGN(backendObj, CreateShaderModuleImpl(descriptor));
         backendObj->SetIsCachedReference();
         mCaches->shaderModules.insert(backendObj);
+
+        // Pipeline manifests record the original code so that they can be replayed on devices
+        // with and without the optimization, and with other versions of the optimizer.
+        if (descriptor != originalDescriptor && IsToggleEnabled(Toggle::RecordPipelineManifest)) {
+            backendObj->SetOriginalCode(originalDescriptor->code, originalDescriptor->codeSize);
+        }
         return backendObj;
     }
 
@@ -438,7 +501,7 @@ namespace dawn_native {
         RayTracingPipelineBase* result = nullptr;
 
         if (ConsumedError(CreateRayTracingPipelineInternal(&result, descriptor))) {
-            return RayTracingPipelineBase::MakeError(this);
+            return ReferenceSharedErrorObject(this, &mCaches->errorRayTracingPipeline);
         }
 
         return result;
@@ -458,7 +521,7 @@ namespace dawn_native {
         BindGroupLayoutBase* result = nullptr;
 
         if (ConsumedError(CreateBindGroupLayoutInternal(&result, descriptor))) {
-            return BindGroupLayoutBase::MakeError(this);
+            return ReferenceSharedErrorObject(this, &mCaches->errorBindGroupLayout);
         }
 
         return result;
@@ -531,7 +594,16 @@ namespace dawn_native {
         ComputePipelineBase* result = nullptr;
 
         if (ConsumedError(CreateComputePipelineInternal(&result, descriptor))) {
-            return ComputePipelineBase::MakeError(this);
+            return ReferenceSharedErrorObject(this, &mCaches->errorComputePipeline);
+        }
+
+        return result;
+    }
+    HeapBase* DeviceBase::CreateHeap(const HeapDescriptor* descriptor) {
+        HeapBase* result = nullptr;
+
+        if (ConsumedError(CreateHeapInternal(&result, descriptor))) {
+            return HeapBase::MakeError(this);
         }
 
         return result;
@@ -541,7 +613,7 @@ namespace dawn_native {
         PipelineLayoutBase* result = nullptr;
 
         if (ConsumedError(CreatePipelineLayoutInternal(&result, descriptor))) {
-            return PipelineLayoutBase::MakeError(this);
+            return ReferenceSharedErrorObject(this, &mCaches->errorPipelineLayout);
         }
 
         return result;
@@ -559,7 +631,7 @@ namespace dawn_native {
         SamplerBase* result = nullptr;
 
         if (ConsumedError(CreateSamplerInternal(&result, descriptor))) {
-            return SamplerBase::MakeError(this);
+            return ReferenceSharedErrorObject(this, &mCaches->errorSampler);
         }
 
         return result;
@@ -579,7 +651,7 @@ namespace dawn_native {
         RenderPipelineBase* result = nullptr;
 
         if (ConsumedError(CreateRenderPipelineInternal(&result, descriptor))) {
-            return RenderPipelineBase::MakeError(this);
+            return ReferenceSharedErrorObject(this, &mCaches->errorRenderPipeline);
         }
 
         return result;
@@ -588,7 +660,7 @@ namespace dawn_native {
         ShaderModuleBase* result = nullptr;
 
         if (ConsumedError(CreateShaderModuleInternal(&result, descriptor))) {
-            return ShaderModuleBase::MakeError(this);
+            return ReferenceSharedErrorObject(this, &mCaches->errorShaderModule);
         }
 
         return result;
@@ -602,6 +674,16 @@ namespace dawn_native {
 
         return result;
     }
+    SwapChainBase* DeviceBase::CreateHeadlessSwapChain(
+        const HeadlessSwapChainDescriptor* descriptor) {
+        SwapChainBase* result = nullptr;
+
+        if (ConsumedError(CreateHeadlessSwapChainInternal(&result, descriptor))) {
+            return SwapChainBase::MakeError(this);
+        }
+
+        return result;
+    }
     TextureBase* DeviceBase::CreateTexture(const TextureDescriptor* descriptor) {
         TextureBase* result = nullptr;
 
@@ -616,7 +698,19 @@ namespace dawn_native {
         TextureViewBase* result = nullptr;
 
         if (ConsumedError(CreateTextureViewInternal(&result, texture, descriptor))) {
-            return TextureViewBase::MakeError(this);
+            return ReferenceSharedErrorObject(this, &mCaches->errorTextureView);
+        }
+
+        return result;
+    }
+    BindGroupBase* DeviceBase::CreateDerivedBindGroup(BindGroupBase* parent,
+                                                      uint32_t bindingCount,
+                                                      const BindGroupBinding* bindings) {
+        BindGroupBase* result = nullptr;
+
+        if (ConsumedError(
+                CreateDerivedBindGroupInternal(&result, parent, bindingCount, bindings))) {
+            return BindGroupBase::MakeError(this);
         }
 
         return result;
@@ -628,6 +722,11 @@ namespace dawn_native {
         if (ConsumedError(ValidateIsAlive())) {
             return;
         }
+        // Reset the completion event before looking at the completed serial so that work
+        // completing concurrently signals it again.
+        if (mCompletionEvent != nullptr) {
+            mCompletionEvent->Reset();
+        }
         if (ConsumedError(TickImpl())) {
             return;
         }
@@ -708,6 +807,103 @@ namespace dawn_native {
         ++mLazyClearCountForTesting;
     }
 
+    void DeviceBase::IncrementObjectCount() {
+        mObjectCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void DeviceBase::DecrementObjectCount() {
+        size_t previousCount = mObjectCount.fetch_sub(1, std::memory_order_relaxed);
+        ASSERT(previousCount != 0);
+        DAWN_UNUSED(previousCount);
+    }
+
+    bool DeviceBase::ResetForTesting() {
+        if (mLossStatus != LossStatus::Alive) {
+            return false;
+        }
+
+        // The warmed up pipelines are only kept alive by the device.
+        mWarmedUpPipelines.clear();
+        // The objects used by GPU work in flight are only released once it completes.
+        if (!WaitForIdle(UINT64_MAX)) {
+            return false;
+        }
+
+        // The scopes that weren't popped don't have callbacks so they can be dropped.
+        mCurrentErrorScope = mRootErrorScope;
+        mRootErrorScope->SetCallback(nullptr, nullptr);
+        mDeviceLostCallback = nullptr;
+        mDeviceLostUserdata = nullptr;
+        mLazyClearCountForTesting = 0;
+
+        // The shared error objects are kept by the device, so release them before checking that
+        // all the objects were released.
+        mCaches->errorBindGroupLayout = nullptr;
+        mCaches->errorComputePipeline = nullptr;
+        mCaches->errorPipelineLayout = nullptr;
+        mCaches->errorRayTracingPipeline = nullptr;
+        mCaches->errorRenderPipeline = nullptr;
+        mCaches->errorSampler = nullptr;
+        mCaches->errorShaderModule = nullptr;
+        mCaches->errorTextureView = nullptr;
+
+        if (mObjectCount.load(std::memory_order_relaxed) != 0) {
+            return false;
+        }
+
+        // The optimized shaders and recorded pipelines of the previous test would change what
+        // the next test observes through the manifest.
+        mSpirvOptimizer = std::make_unique<SpirvOptimizer>(this);
+        mPipelineManifest = std::make_unique<PipelineManifest>();
+
+        ResetForTestingImpl();
+        return true;
+    }
+
+    void DeviceBase::ResetForTestingImpl() {
+    }
+
+    std::vector<uint8_t> DeviceBase::GetPipelineManifest() const {
+        return mPipelineManifest->Serialize();
+    }
+
+    bool DeviceBase::WarmUpPipelines(const void* manifest, size_t size) {
+        return !ConsumedError(ReplayPipelineManifest(this, manifest, size, &mWarmedUpPipelines));
+    }
+
+    bool DeviceBase::WaitForIdle(uint64_t timeoutNs) {
+        if (ConsumedError(ValidateIsAlive())) {
+            return false;
+        }
+        // Tick first so that pending commands are submitted.
+        if (ConsumedError(TickImpl())) {
+            return false;
+        }
+
+        bool completed = false;
+        if (ConsumedError(WaitForSerialImpl(GetLastSubmittedCommandSerial(), timeoutNs),
+                          &completed)) {
+            return false;
+        }
+        Tick();
+        return completed;
+    }
+
+    int DeviceBase::GetCompletionFd() {
+        if (mCompletionEvent == nullptr) {
+            std::unique_ptr<PollableEvent> event = std::make_unique<PollableEvent>();
+            if (event->GetFd() == -1 || !StartSignalingCompletion(event.get())) {
+                return -1;
+            }
+            mCompletionEvent = std::move(event);
+        }
+        return mCompletionEvent->GetFd();
+    }
+
+    bool DeviceBase::StartSignalingCompletion(PollableEvent* event) {
+        return false;
+    }
+
     void DeviceBase::SetDefaultToggles() {
         // Sets the default-enabled toggles
         mTogglesSet.SetToggle(Toggle::LazyClearResourceOnFirstUse, true);
@@ -724,6 +920,18 @@ namespace dawn_native {
         return {};
     }
 
+    MaybeError DeviceBase::CreateDerivedBindGroupInternal(BindGroupBase** result,
+                                                          BindGroupBase* parent,
+                                                          uint32_t bindingCount,
+                                                          const BindGroupBinding* bindings) {
+        DAWN_TRY(ValidateIsAlive());
+        if (IsValidationEnabled()) {
+            DAWN_TRY(ValidateDerivedBindGroupBindings(this, parent, bindingCount, bindings));
+        }
+        DAWN_TRY_ASSIGN(*result, CreateDerivedBindGroupImpl(parent, bindingCount, bindings));
+        return {};
+    }
+
     MaybeError DeviceBase::CreateBindGroupLayoutInternal(
         BindGroupLayoutBase** result,
         const BindGroupLayoutDescriptor* descriptor) {
@@ -770,6 +978,16 @@ namespace dawn_native {
         return {};
     }
 
+    MaybeError DeviceBase::CreateHeapInternal(HeapBase** result,
+                                              const HeapDescriptor* descriptor) {
+        DAWN_TRY(ValidateIsAlive());
+        if (IsValidationEnabled()) {
+            DAWN_TRY(ValidateHeapDescriptor(descriptor));
+        }
+        DAWN_TRY_ASSIGN(*result, CreateHeapImpl(descriptor));
+        return {};
+    }
+
     MaybeError DeviceBase::CreatePipelineLayoutInternal(
         PipelineLayoutBase** result,
         const PipelineLayoutDescriptor* descriptor) {
@@ -892,6 +1110,17 @@ namespace dawn_native {
         return {};
     }
 
+    MaybeError DeviceBase::CreateHeadlessSwapChainInternal(
+        SwapChainBase** result,
+        const HeadlessSwapChainDescriptor* descriptor) {
+        DAWN_TRY(ValidateIsAlive());
+        if (IsValidationEnabled()) {
+            DAWN_TRY(ValidateHeadlessSwapChainDescriptor(descriptor));
+        }
+        *result = new HeadlessSwapChain(this, descriptor);
+        return {};
+    }
+
     MaybeError DeviceBase::CreateTextureInternal(TextureBase** result,
                                                  const TextureDescriptor* descriptor) {
         DAWN_TRY(ValidateIsAlive());
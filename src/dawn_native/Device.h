@@ -26,6 +26,7 @@
 #include "dawn_native/DawnNative.h"
 #include "dawn_native/dawn_platform.h"
 
+#include <atomic>
 #include <memory>
 
 namespace dawn_native {
@@ -36,6 +37,9 @@ namespace dawn_native {
     class ErrorScopeTracker;
     class FenceSignalTracker;
     class DynamicUploader;
+    class PipelineManifest;
+    class PollableEvent;
+    class SpirvOptimizer;
     class StagingBufferBase;
 
     class DeviceBase {
@@ -90,6 +94,14 @@ namespace dawn_native {
         virtual Serial GetPendingCommandSerial() const = 0;
         virtual MaybeError TickImpl() = 0;
 
+        // Blocks until `serial` completes or `timeoutNs` nanoseconds elapse and returns whether it
+        // completed. The completed serial is updated but the device doesn't need to be ticked.
+        virtual ResultOrError<bool> WaitForSerialImpl(Serial serial, uint64_t timeoutNs) = 0;
+        // Called the first time the completion fd is requested. Backends that can tell when GPU
+        // work completes without being ticked signal `event` when it happens and return true.
+        // The event outlives the backend device.
+        virtual bool StartSignalingCompletion(PollableEvent* event);
+
         // Many Dawn objects are completely immutable once created which means that if two
         // creations are given the same arguments, they can return the same object. Reusing
         // objects will help make comparisons between objects by a single pointer comparison.
@@ -150,6 +162,7 @@ namespace dawn_native {
                                      void* userdata);
         CommandEncoder* CreateCommandEncoder(const CommandEncoderDescriptor* descriptor);
         ComputePipelineBase* CreateComputePipeline(const ComputePipelineDescriptor* descriptor);
+        HeapBase* CreateHeap(const HeapDescriptor* descriptor);
         PipelineLayoutBase* CreatePipelineLayout(const PipelineLayoutDescriptor* descriptor);
         QueueBase* CreateQueue();
         RenderBundleEncoder* CreateRenderBundleEncoder(
@@ -158,9 +171,13 @@ namespace dawn_native {
         SamplerBase* CreateSampler(const SamplerDescriptor* descriptor);
         ShaderModuleBase* CreateShaderModule(const ShaderModuleDescriptor* descriptor);
         SwapChainBase* CreateSwapChain(const SwapChainDescriptor* descriptor);
+        SwapChainBase* CreateHeadlessSwapChain(const HeadlessSwapChainDescriptor* descriptor);
         TextureBase* CreateTexture(const TextureDescriptor* descriptor);
         TextureViewBase* CreateTextureView(TextureBase* texture,
                                            const TextureViewDescriptor* descriptor);
+        BindGroupBase* CreateDerivedBindGroup(BindGroupBase* parent,
+                                              uint32_t bindingCount,
+                                              const BindGroupBinding* bindings);
 
         void InjectError(wgpu::ErrorType type, const char* message);
 
@@ -197,6 +214,31 @@ namespace dawn_native {
         void IncrementLazyClearCountForTesting();
         void LoseForTesting();
 
+        // Called by ObjectBase so that the device knows when all its objects are released.
+        void IncrementObjectCount();
+        void DecrementObjectCount();
+        // Waits for the GPU work, then clears the error scopes, callbacks, testing counters and
+        // the caches and manifest that live as long as the device, so that the device can be
+        // used by another test. Returns false if the device can't be reused because it is lost
+        // or objects created by the previous test are still alive.
+        bool ResetForTesting();
+
+        // Returns the serialized PipelineManifest of the pipelines created while the
+        // RecordPipelineManifest toggle was enabled.
+        std::vector<uint8_t> GetPipelineManifest() const;
+        // Creates the pipelines of a serialized PipelineManifest and keeps them in the caches
+        // until the device is destroyed. Returns false if the manifest is invalid.
+        bool WarmUpPipelines(const void* manifest, size_t size);
+
+        // Blocks until the GPU work submitted to the device completes or `timeoutNs` nanoseconds
+        // elapse, then ticks the device so that the callbacks of the completed work are called.
+        // Returns whether all the work completed.
+        bool WaitForIdle(uint64_t timeoutNs);
+        // Returns a file descriptor that becomes readable when GPU work completes and the device
+        // should be ticked, or -1 if the platform or the backend don't support it. Ticking the
+        // device resets it.
+        int GetCompletionFd();
+
       protected:
         void SetToggle(Toggle toggle, bool isEnabled);
         void ApplyToggleOverrides(const DeviceDescriptor* deviceDescriptor);
@@ -220,11 +262,16 @@ namespace dawn_native {
             const RayTracingPipelineDescriptor* descriptor) = 0;
         virtual ResultOrError<BindGroupBase*> CreateBindGroupImpl(
             const BindGroupDescriptor* descriptor) = 0;
+        virtual ResultOrError<BindGroupBase*> CreateDerivedBindGroupImpl(
+            BindGroupBase* parent,
+            uint32_t bindingCount,
+            const BindGroupBinding* bindings) = 0;
         virtual ResultOrError<BindGroupLayoutBase*> CreateBindGroupLayoutImpl(
             const BindGroupLayoutDescriptor* descriptor) = 0;
         virtual ResultOrError<BufferBase*> CreateBufferImpl(const BufferDescriptor* descriptor) = 0;
         virtual ResultOrError<ComputePipelineBase*> CreateComputePipelineImpl(
             const ComputePipelineDescriptor* descriptor) = 0;
+        virtual ResultOrError<HeapBase*> CreateHeapImpl(const HeapDescriptor* descriptor) = 0;
         virtual ResultOrError<PipelineLayoutBase*> CreatePipelineLayoutImpl(
             const PipelineLayoutDescriptor* descriptor) = 0;
         virtual ResultOrError<QueueBase*> CreateQueueImpl() = 0;
@@ -250,11 +297,16 @@ namespace dawn_native {
                                                     const RayTracingPipelineDescriptor* descriptor);
         MaybeError CreateBindGroupInternal(BindGroupBase** result,
                                            const BindGroupDescriptor* descriptor);
+        MaybeError CreateDerivedBindGroupInternal(BindGroupBase** result,
+                                                  BindGroupBase* parent,
+                                                  uint32_t bindingCount,
+                                                  const BindGroupBinding* bindings);
         MaybeError CreateBindGroupLayoutInternal(BindGroupLayoutBase** result,
                                                  const BindGroupLayoutDescriptor* descriptor);
         MaybeError CreateBufferInternal(BufferBase** result, const BufferDescriptor* descriptor);
         MaybeError CreateComputePipelineInternal(ComputePipelineBase** result,
                                                  const ComputePipelineDescriptor* descriptor);
+        MaybeError CreateHeapInternal(HeapBase** result, const HeapDescriptor* descriptor);
         MaybeError CreatePipelineLayoutInternal(PipelineLayoutBase** result,
                                                 const PipelineLayoutDescriptor* descriptor);
         MaybeError CreateQueueInternal(QueueBase** result);
@@ -268,6 +320,8 @@ namespace dawn_native {
                                               const ShaderModuleDescriptor* descriptor);
         MaybeError CreateSwapChainInternal(SwapChainBase** result,
                                            const SwapChainDescriptor* descriptor);
+        MaybeError CreateHeadlessSwapChainInternal(SwapChainBase** result,
+                                                   const HeadlessSwapChainDescriptor* descriptor);
         MaybeError CreateTextureInternal(TextureBase** result, const TextureDescriptor* descriptor);
         MaybeError CreateTextureViewInternal(TextureViewBase** result,
                                              TextureBase* texture,
@@ -289,11 +343,19 @@ namespace dawn_native {
         // resources.
         virtual MaybeError WaitForIdleForDestruction() = 0;
 
+        // Called by ResetForTesting once all the objects of the previous test are released, to
+        // reset the backend state that lives as long as the device.
+        virtual void ResetForTestingImpl();
+
         void HandleLoss(const char* message);
         wgpu::DeviceLostCallback mDeviceLostCallback = nullptr;
         void* mDeviceLostUserdata;
 
         AdapterBase* mAdapter = nullptr;
+        // Declared before the members that can hold objects so that it is destroyed after them.
+        // Atomic because objects can be released from any thread while others are created on the
+        // device's thread.
+        std::atomic<size_t> mObjectCount{0};
 
         Ref<ErrorScope> mRootErrorScope;
         Ref<ErrorScope> mCurrentErrorScope;
@@ -312,6 +374,10 @@ namespace dawn_native {
 
         std::unique_ptr<ErrorScopeTracker> mErrorScopeTracker;
         std::unique_ptr<FenceSignalTracker> mFenceSignalTracker;
+        std::unique_ptr<SpirvOptimizer> mSpirvOptimizer;
+        std::unique_ptr<PipelineManifest> mPipelineManifest;
+        std::vector<Ref<PipelineBase>> mWarmedUpPipelines;
+        std::unique_ptr<PollableEvent> mCompletionEvent;
         std::vector<DeferredCreateBufferMappedAsync> mDeferredCreateBufferMappedAsyncResults;
 
         uint32_t mRefCount = 1;
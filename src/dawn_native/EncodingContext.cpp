@@ -46,6 +46,17 @@ namespace dawn_native {
         return &mIterator;
     }
 
+    void EncodingContext::AddReference(ObjectBase* object) {
+        ASSERT(!mWereReferencedObjectsAcquired);
+        mReferencedObjects.emplace_back(object);
+    }
+
+    std::vector<Ref<ObjectBase>> EncodingContext::AcquireReferencedObjects() {
+        ASSERT(!mWereReferencedObjectsAcquired);
+        mWereReferencedObjectsAcquired = true;
+        return std::move(mReferencedObjects);
+    }
+
     void EncodingContext::MoveToIterator() {
         if (!mWasMovedToIterator) {
             mIterator = std::move(mAllocator);
@@ -19,9 +19,13 @@
 #include "dawn_native/Error.h"
 #include "dawn_native/ErrorData.h"
 #include "dawn_native/PassResourceUsageTracker.h"
+#include "dawn_native/RefCounted.h"
 #include "dawn_native/dawn_platform.h"
 
+#include <array>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 namespace dawn_native {
 
@@ -38,6 +42,19 @@ namespace dawn_native {
         CommandIterator AcquireCommands();
         CommandIterator* GetIterator();
 
+        // Hot commands like SetBindGroup or SetPipeline store borrowed pointers to the objects
+        // they use. The objects are instead kept alive by a per-encoder list of references that
+        // is handed over to the command buffer or render bundle with the commands, so that
+        // encoding the same object many times only references it once.
+        inline void ReferenceObject(ObjectBase* object) {
+            size_t slot = (reinterpret_cast<uintptr_t>(object) >> 4) % kRecentReferenceCount;
+            if (mRecentReferences[slot] != object) {
+                mRecentReferences[slot] = object;
+                AddReference(object);
+            }
+        }
+        std::vector<Ref<ObjectBase>> AcquireReferencedObjects();
+
         // Functions to handle encoder errors
         void HandleError(wgpu::ErrorType type, const char* message);
 
@@ -81,6 +98,7 @@ namespace dawn_native {
       private:
         bool IsFinished() const;
         void MoveToIterator();
+        void AddReference(ObjectBase* object);
 
         DeviceBase* mDevice;
 
@@ -97,6 +115,14 @@ namespace dawn_native {
         PerPassUsages mPassUsages;
         bool mWerePassUsagesAcquired = false;
 
+        // Objects in the list can't be destroyed while the encoder is alive, so the pointers in
+        // this cache can't be reused for other objects. Cache collisions only cause an object to
+        // be referenced twice.
+        static constexpr size_t kRecentReferenceCount = 16;
+        std::array<ObjectBase*, kRecentReferenceCount> mRecentReferences = {};
+        std::vector<Ref<ObjectBase>> mReferencedObjects;
+        bool mWereReferencedObjectsAcquired = false;
+
         CommandAllocator mAllocator;
         CommandIterator mIterator;
         bool mWasMovedToIterator = false;
@@ -19,18 +19,44 @@
 
 namespace dawn_native {
 
+    namespace {
+
+        // Errors are usually propagated through a handful of DAWN_TRY, reserve enough space for
+        // them upfront instead of growing the backtrace one record at a time.
+        constexpr size_t kReservedBacktraceSize = 8;
+
+    }  // anonymous namespace
+
+    // static
     std::unique_ptr<ErrorData> ErrorData::Create(InternalErrorType type,
                                                  std::string message,
                                                  const char* file,
                                                  const char* function,
                                                  int line) {
-        std::unique_ptr<ErrorData> error = std::make_unique<ErrorData>(type, message);
+        std::unique_ptr<ErrorData> error = std::make_unique<ErrorData>(type, std::move(message));
+        error->AppendBacktrace(file, function, line);
+        return error;
+    }
+
+    // static
+    std::unique_ptr<ErrorData> ErrorData::CreateFromLiteral(InternalErrorType type,
+                                                            const char* literalMessage,
+                                                            const char* file,
+                                                            const char* function,
+                                                            int line) {
+        std::unique_ptr<ErrorData> error = std::make_unique<ErrorData>(type, literalMessage);
         error->AppendBacktrace(file, function, line);
         return error;
     }
 
     ErrorData::ErrorData(InternalErrorType type, std::string message)
         : mType(type), mMessage(std::move(message)) {
+        mBacktrace.reserve(kReservedBacktraceSize);
+    }
+
+    ErrorData::ErrorData(InternalErrorType type, const char* literalMessage)
+        : mType(type), mLiteralMessage(literalMessage) {
+        mBacktrace.reserve(kReservedBacktraceSize);
     }
 
     void ErrorData::AppendBacktrace(const char* file, const char* function, int line) {
@@ -60,6 +86,9 @@ namespace dawn_native {
     }
 
     const std::string& ErrorData::GetMessage() const {
+        if (mLiteralMessage != nullptr && mMessage.empty()) {
+            mMessage = mLiteralMessage;
+        }
         return mMessage;
     }
 
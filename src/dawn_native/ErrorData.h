@@ -15,7 +15,9 @@
 #ifndef DAWNNATIVE_ERRORDATA_H_
 #define DAWNNATIVE_ERRORDATA_H_
 
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -37,7 +39,29 @@ namespace dawn_native {
                                                  const char* file,
                                                  const char* function,
                                                  int line);
+
+        // Most errors are created with a string literal: keep a pointer to it and only copy it
+        // in a std::string if the message is queried. Non-const arrays might be temporary
+        // buffers so they are copied eagerly.
+        template <size_t N>
+        static std::unique_ptr<ErrorData> Create(InternalErrorType type,
+                                                 const char (&message)[N],
+                                                 const char* file,
+                                                 const char* function,
+                                                 int line) {
+            return CreateFromLiteral(type, message, file, function, line);
+        }
+        template <size_t N>
+        static std::unique_ptr<ErrorData> Create(InternalErrorType type,
+                                                 char (&message)[N],
+                                                 const char* file,
+                                                 const char* function,
+                                                 int line) {
+            return Create(type, std::string(message), file, function, line);
+        }
+
         ErrorData(InternalErrorType type, std::string message);
+        ErrorData(InternalErrorType type, const char* literalMessage);
 
         struct BacktraceRecord {
             const char* file;
@@ -52,8 +76,16 @@ namespace dawn_native {
         const std::vector<BacktraceRecord>& GetBacktrace() const;
 
       private:
+        static std::unique_ptr<ErrorData> CreateFromLiteral(InternalErrorType type,
+                                                            const char* literalMessage,
+                                                            const char* file,
+                                                            const char* function,
+                                                            int line);
+
         InternalErrorType mType;
-        std::string mMessage;
+        // Only one of the two is used. mMessage is filled lazily from mLiteralMessage.
+        const char* mLiteralMessage = nullptr;
+        mutable std::string mMessage;
         std::vector<BacktraceRecord> mBacktrace;
     };
 
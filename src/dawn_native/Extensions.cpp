@@ -34,7 +34,13 @@ namespace dawn_native {
             {{Extension::TextureCompressionBC,
               {"texture_compression_bc", "Support Block Compressed (BC) texture formats",
                "https://bugs.chromium.org/p/dawn/issues/detail?id=42"},
-              &WGPUDeviceProperties::textureCompressionBC}}};
+              &WGPUDeviceProperties::textureCompressionBC},
+             {Extension::DescriptorIndexing,
+              {"descriptor_indexing",
+               "Support arrays of sampled textures and storage buffers in a single binding, which "
+               "can be partially bound and indexed dynamically in shaders",
+               ""},
+              &WGPUDeviceProperties::descriptorIndexing}}};
 
     }  // anonymous namespace
 
@@ -28,6 +28,7 @@ namespace dawn_native {
     class CommandEncoder;
     class ComputePassEncoder;
     class Fence;
+    class HeapBase;
     class InstanceBase;
     class PipelineBase;
     class PipelineLayoutBase;
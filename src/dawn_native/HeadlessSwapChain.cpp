@@ -0,0 +1,184 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn_native/HeadlessSwapChain.h"
+
+#include "common/Constants.h"
+#include "common/Math.h"
+#include "dawn_native/Buffer.h"
+#include "dawn_native/CommandBuffer.h"
+#include "dawn_native/CommandEncoder.h"
+#include "dawn_native/Device.h"
+#include "dawn_native/Queue.h"
+#include "dawn_native/Texture.h"
+
+namespace dawn_native {
+
+    namespace {
+
+        // The headless swap chain doesn't have a native implementation, all the work is done in
+        // GetNextTextureImpl and OnBeforePresent.
+        void HeadlessInit(void*, void*) {
+        }
+
+        void HeadlessDestroy(void*) {
+        }
+
+        DawnSwapChainError HeadlessConfigure(void*,
+                                             WGPUTextureFormat,
+                                             WGPUTextureUsage,
+                                             uint32_t,
+                                             uint32_t) {
+            return DAWN_SWAP_CHAIN_NO_ERROR;
+        }
+
+        DawnSwapChainError HeadlessGetNextTexture(void*, DawnSwapChainNextTexture*) {
+            return DAWN_SWAP_CHAIN_NO_ERROR;
+        }
+
+        DawnSwapChainError HeadlessPresent(void*) {
+            return DAWN_SWAP_CHAIN_NO_ERROR;
+        }
+
+        const SwapChainDescriptor* GetHeadlessSwapChainDescriptor() {
+            static DawnSwapChainImplementation implementation = {
+                HeadlessInit,    HeadlessDestroy, HeadlessConfigure, HeadlessGetNextTexture,
+                HeadlessPresent, nullptr,         WGPUTextureUsage_None};
+            static SwapChainDescriptor descriptor = {
+                nullptr, nullptr, reinterpret_cast<uint64_t>(&implementation)};
+            return &descriptor;
+        }
+
+    }  // anonymous namespace
+
+    MaybeError ValidateHeadlessSwapChainDescriptor(const HeadlessSwapChainDescriptor* descriptor) {
+        if (descriptor->frameCount == 0) {
+            return DAWN_VALIDATION_ERROR("Headless swap chain needs at least one frame");
+        }
+
+        if (descriptor->callback == nullptr) {
+            return DAWN_VALIDATION_ERROR("Headless swap chain needs a frame callback");
+        }
+
+        return {};
+    }
+
+    HeadlessSwapChain::HeadlessSwapChain(DeviceBase* device,
+                                         const HeadlessSwapChainDescriptor* descriptor)
+        : SwapChainBase(device, GetHeadlessSwapChainDescriptor()),
+          mCallback(descriptor->callback),
+          mUserdata(descriptor->userdata),
+          mQueue(AcquireRef(device->CreateQueue())),
+          mFrames(descriptor->frameCount) {
+        for (Frame& frame : mFrames) {
+            frame.swapChain = this;
+        }
+    }
+
+    HeadlessSwapChain::~HeadlessSwapChain() {
+        // Cancel the pending readbacks so that their callbacks don't reference this swap chain
+        // after it is destroyed.
+        for (Frame& frame : mFrames) {
+            if (frame.inFlight) {
+                frame.readback->Unmap();
+            }
+        }
+    }
+
+    TextureBase* HeadlessSwapChain::GetNextTextureImpl(const TextureDescriptor* descriptor) {
+        Frame& frame = mFrames[mCurrentFrame];
+
+        // Textures are reused across frames unless the swap chain was reconfigured.
+        TextureBase* texture = frame.texture.Get();
+        if (texture == nullptr || texture->GetFormat().format != descriptor->format ||
+            texture->GetSize().width != descriptor->size.width ||
+            texture->GetSize().height != descriptor->size.height ||
+            texture->GetUsage() != (descriptor->usage | wgpu::TextureUsage::CopySrc)) {
+            TextureDescriptor textureDescriptor = *descriptor;
+            textureDescriptor.usage |= wgpu::TextureUsage::CopySrc;
+            frame.texture = AcquireRef(GetDevice()->CreateTexture(&textureDescriptor));
+        }
+
+        // The caller acquires the returned reference.
+        frame.texture->Reference();
+        return frame.texture.Get();
+    }
+
+    MaybeError HeadlessSwapChain::OnBeforePresent(TextureBase* texture) {
+        Frame& frame = mFrames[mCurrentFrame];
+        mCurrentFrame = (mCurrentFrame + 1) % mFrames.size();
+        uint64_t frameIndex = mNextFrameIndex++;
+
+        // The previous readback using this frame hasn't completed yet, skip this frame instead of
+        // waiting on the GPU.
+        if (frame.inFlight) {
+            return {};
+        }
+
+        Extent3D size = texture->GetSize();
+        uint32_t bytesPerRow =
+            Align(size.width * texture->GetFormat().blockByteSize, kTextureRowPitchAlignment);
+        uint64_t readbackSize = static_cast<uint64_t>(bytesPerRow) * size.height;
+
+        if (frame.readback.Get() == nullptr || frame.readback->GetSize() != readbackSize) {
+            BufferDescriptor descriptor;
+            descriptor.size = readbackSize;
+            descriptor.usage = wgpu::BufferUsage::MapRead | wgpu::BufferUsage::CopyDst;
+            frame.readback = AcquireRef(GetDevice()->CreateBuffer(&descriptor));
+        }
+
+        TextureCopyView source;
+        source.texture = texture;
+        source.origin = {0, 0, 0};
+
+        BufferCopyView destination;
+        destination.buffer = frame.readback.Get();
+        destination.offset = 0;
+        destination.rowPitch = bytesPerRow;
+        destination.imageHeight = 0;
+
+        Ref<CommandEncoder> encoder = AcquireRef(GetDevice()->CreateCommandEncoder(nullptr));
+        encoder->CopyTextureToBuffer(&source, &destination, &size);
+        Ref<CommandBufferBase> commands = AcquireRef(encoder->Finish(nullptr));
+
+        CommandBufferBase* commandBuffer = commands.Get();
+        mQueue->Submit(1, &commandBuffer);
+
+        frame.bytesPerRow = bytesPerRow;
+        frame.frameIndex = frameIndex;
+        frame.inFlight = true;
+        frame.readback->MapReadAsync(OnFrameMapped, &frame);
+
+        return {};
+    }
+
+    // static
+    void HeadlessSwapChain::OnFrameMapped(WGPUBufferMapAsyncStatus status,
+                                          const void* data,
+                                          uint64_t dataLength,
+                                          void* userdata) {
+        Frame* frame = static_cast<Frame*>(userdata);
+        frame->inFlight = false;
+
+        if (status != WGPUBufferMapAsyncStatus_Success) {
+            return;
+        }
+
+        HeadlessSwapChain* swapChain = frame->swapChain;
+        swapChain->mCallback(frame->frameIndex, data, dataLength, frame->bytesPerRow,
+                             swapChain->mUserdata);
+        frame->readback->Unmap();
+    }
+
+}  // namespace dawn_native
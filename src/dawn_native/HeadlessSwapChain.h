@@ -0,0 +1,67 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_HEADLESSSWAPCHAIN_H_
+#define DAWNNATIVE_HEADLESSSWAPCHAIN_H_
+
+#include "dawn_native/SwapChain.h"
+
+#include "dawn_native/DawnNative.h"
+
+#include <vector>
+
+namespace dawn_native {
+
+    MaybeError ValidateHeadlessSwapChainDescriptor(const HeadlessSwapChainDescriptor* descriptor);
+
+    // A swap chain that presents into a ring of readback buffers instead of a window surface. It
+    // only uses frontend objects so it works the same on all backends. Presenting a frame records
+    // a copy of its texture into a free buffer of the ring and starts mapping it, the frame
+    // callback is then called when the map completes, during a later Device::Tick.
+    class HeadlessSwapChain final : public SwapChainBase {
+      public:
+        HeadlessSwapChain(DeviceBase* device, const HeadlessSwapChainDescriptor* descriptor);
+        ~HeadlessSwapChain();
+
+      private:
+        TextureBase* GetNextTextureImpl(const TextureDescriptor* descriptor) override;
+        MaybeError OnBeforePresent(TextureBase* texture) override;
+
+        static void OnFrameMapped(WGPUBufferMapAsyncStatus status,
+                                  const void* data,
+                                  uint64_t dataLength,
+                                  void* userdata);
+
+        struct Frame {
+            HeadlessSwapChain* swapChain = nullptr;
+            Ref<TextureBase> texture;
+            Ref<BufferBase> readback;
+            uint32_t bytesPerRow = 0;
+            uint64_t frameIndex = 0;
+            bool inFlight = false;
+        };
+
+        HeadlessFrameCallback mCallback;
+        void* mUserdata;
+        Ref<QueueBase> mQueue;
+
+        // The frames are never reallocated since their address is the map callback's userdata.
+        std::vector<Frame> mFrames;
+        size_t mCurrentFrame = 0;
+        uint64_t mNextFrameIndex = 0;
+    };
+
+}  // namespace dawn_native
+
+#endif  // DAWNNATIVE_HEADLESSSWAPCHAIN_H_
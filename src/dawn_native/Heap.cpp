@@ -0,0 +1,85 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn_native/Heap.h"
+
+#include "common/Assert.h"
+#include "dawn_native/Device.h"
+
+namespace dawn_native {
+
+    MaybeError ValidateHeapDescriptor(const HeapDescriptor* descriptor) {
+        if (descriptor->nextInChain != nullptr) {
+            return DAWN_VALIDATION_ERROR("nextInChain must be nullptr");
+        }
+
+        if (descriptor->size == 0) {
+            return DAWN_VALIDATION_ERROR("Cannot create an empty heap");
+        }
+
+        return {};
+    }
+
+    MaybeError ValidatePlacedResourceChain(const DeviceBase* device, const ChainedStruct* chain) {
+        if (chain == nullptr) {
+            return {};
+        }
+
+        if (chain->sType != wgpu::SType::PlacedResourceDescriptor) {
+            return DAWN_VALIDATION_ERROR("Unsupported sType");
+        }
+        if (chain->nextInChain != nullptr) {
+            return DAWN_VALIDATION_ERROR("Placed resource descriptors can't be chained further");
+        }
+
+        const PlacedResourceDescriptor* placement =
+            static_cast<const PlacedResourceDescriptor*>(chain);
+        DAWN_TRY(device->ValidateObject(placement->heap));
+
+        // Whether the resource fits depends on its memory requirements so the rest is checked by
+        // the backend.
+        if (placement->offset >= placement->heap->GetSize()) {
+            return DAWN_VALIDATION_ERROR("Placed resource offset is outside of the heap");
+        }
+
+        return {};
+    }
+
+    const PlacedResourceDescriptor* GetPlacedResourceDescriptor(const ChainedStruct* chain) {
+        if (chain == nullptr || chain->sType != wgpu::SType::PlacedResourceDescriptor) {
+            return nullptr;
+        }
+        return static_cast<const PlacedResourceDescriptor*>(chain);
+    }
+
+    // Heap
+
+    HeapBase::HeapBase(DeviceBase* device, const HeapDescriptor* descriptor)
+        : ObjectBase(device), mSize(descriptor->size) {
+    }
+
+    HeapBase::HeapBase(DeviceBase* device, ObjectBase::ErrorTag tag) : ObjectBase(device, tag) {
+    }
+
+    // static
+    HeapBase* HeapBase::MakeError(DeviceBase* device) {
+        return new HeapBase(device, ObjectBase::kError);
+    }
+
+    uint64_t HeapBase::GetSize() const {
+        ASSERT(!IsError());
+        return mSize;
+    }
+
+}  // namespace dawn_native
@@ -0,0 +1,57 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_HEAP_H_
+#define DAWNNATIVE_HEAP_H_
+
+#include "dawn_native/Error.h"
+#include "dawn_native/Forward.h"
+#include "dawn_native/ObjectBase.h"
+
+#include "dawn_native/dawn_platform.h"
+
+namespace dawn_native {
+
+    MaybeError ValidateHeapDescriptor(const HeapDescriptor* descriptor);
+
+    // Validates the structures chained to a texture or buffer descriptor. The only one allowed is
+    // a PlacedResourceDescriptor.
+    MaybeError ValidatePlacedResourceChain(const DeviceBase* device, const ChainedStruct* chain);
+
+    // Returns the PlacedResourceDescriptor chained to a texture or buffer descriptor, nullptr if
+    // the resource doesn't need to be placed in a heap.
+    const PlacedResourceDescriptor* GetPlacedResourceDescriptor(const ChainedStruct* chain);
+
+    // A heap is a block of memory that the application places textures and buffers in at explicit
+    // offsets. Resources whose ranges overlap alias the same memory: using one of them discards
+    // the content of the others, so they must not be used in the same pass. Backends that don't
+    // support placement ignore the heap and give each resource its own memory.
+    class HeapBase : public ObjectBase {
+      public:
+        HeapBase(DeviceBase* device, const HeapDescriptor* descriptor);
+
+        static HeapBase* MakeError(DeviceBase* device);
+
+        uint64_t GetSize() const;
+
+      protected:
+        HeapBase(DeviceBase* device, ObjectBase::ErrorTag tag);
+
+      private:
+        uint64_t mSize = 0;
+    };
+
+}  // namespace dawn_native
+
+#endif  // DAWNNATIVE_HEAP_H_
@@ -14,19 +14,24 @@
 
 #include "dawn_native/ObjectBase.h"
 
+#include "dawn_native/Device.h"
+
 namespace dawn_native {
 
     static constexpr uint64_t kErrorPayload = 0;
     static constexpr uint64_t kNotErrorPayload = 1;
 
     ObjectBase::ObjectBase(DeviceBase* device) : RefCounted(kNotErrorPayload), mDevice(device) {
+        mDevice->IncrementObjectCount();
     }
 
     ObjectBase::ObjectBase(DeviceBase* device, ErrorTag)
         : RefCounted(kErrorPayload), mDevice(device) {
+        mDevice->IncrementObjectCount();
     }
 
     ObjectBase::~ObjectBase() {
+        mDevice->DecrementObjectCount();
     }
 
     DeviceBase* ObjectBase::GetDevice() const {
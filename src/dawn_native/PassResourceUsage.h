@@ -28,7 +28,7 @@ namespace dawn_native {
 
     // Which resources are used by pass and how they are used. The command buffer validation
     // pre-computes this information so that backends with explicit barriers don't have to
-    // re-compute it.
+    // re-compute it. The buffers and textures are sorted by address.
     struct PassResourceUsage {
         std::vector<BufferBase*> buffers;
         std::vector<wgpu::BufferUsage> bufferUsages;
@@ -14,6 +14,7 @@
 
 #include "dawn_native/Pipeline.h"
 
+#include "common/HashUtils.h"
 #include "dawn_native/BindGroupLayout.h"
 #include "dawn_native/Device.h"
 #include "dawn_native/PipelineLayout.h"
@@ -36,9 +37,42 @@ namespace dawn_native {
         if (layout != nullptr && !descriptor->module->IsCompatibleWithPipelineLayout(layout)) {
             return DAWN_VALIDATION_ERROR("Stage not compatible with layout");
         }
+
+        const ShaderModuleBase::SpecializationConstantTypes& constantTypes =
+            descriptor->module->GetSpecializationConstantTypes();
+        SpecializationConstants constants;
+        for (uint32_t i = 0; i < descriptor->constantCount; ++i) {
+            const SpecializationConstant& constant = descriptor->constants[i];
+
+            auto it = constantTypes.find(constant.id);
+            if (it == constantTypes.end()) {
+                return DAWN_VALIDATION_ERROR(
+                    "Specialization constant ID isn't a scalar constant of the module");
+            }
+            if (!constants.emplace(constant.id, constant.value).second) {
+                return DAWN_VALIDATION_ERROR("Specialization constant set multiple times");
+            }
+            DAWN_TRY(ValidateSpecializationConstantValue(it->second, constant.value));
+        }
         return {};
     }
 
+    SpecializationConstants GetSpecializationConstants(
+        const ProgrammableStageDescriptor* descriptor) {
+        SpecializationConstants constants;
+        for (uint32_t i = 0; i < descriptor->constantCount; ++i) {
+            constants[descriptor->constants[i].id] = descriptor->constants[i].value;
+        }
+        return constants;
+    }
+
+    void HashSpecializationConstants(size_t* hash, const SpecializationConstants& constants) {
+        HashCombine(hash, constants.size());
+        for (const auto& constant : constants) {
+            HashCombine(hash, constant.first, constant.second);
+        }
+    }
+
     // PipelineBase
 
     PipelineBase::PipelineBase(DeviceBase* device,
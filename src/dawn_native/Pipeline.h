@@ -33,6 +33,10 @@ namespace dawn_native {
                                                    const PipelineLayoutBase* layout,
                                                    SingleShaderStage stage);
 
+    SpecializationConstants GetSpecializationConstants(
+        const ProgrammableStageDescriptor* descriptor);
+    void HashSpecializationConstants(size_t* hash, const SpecializationConstants& constants);
+
     class PipelineBase : public CachedObject {
       public:
         wgpu::ShaderStage GetStageMask() const;
@@ -130,6 +130,11 @@ namespace dawn_native {
                         return DAWN_VALIDATION_ERROR("Multisampled textures not supported (yet)");
                     }
 
+                    if (bindingInfo.isArray) {
+                        return DAWN_VALIDATION_ERROR(
+                            "Binding arrays require an explicit pipeline layout");
+                    }
+
                     BindGroupLayoutBinding bindingSlot;
                     bindingSlot.binding = binding;
                     if (bindingInfo.type == wgpu::BindingType::StorageBuffer) {
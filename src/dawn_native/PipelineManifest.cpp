@@ -0,0 +1,585 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn_native/PipelineManifest.h"
+
+#include "common/Assert.h"
+#include "common/BitSetIterator.h"
+#include "dawn_native/BindGroupLayout.h"
+#include "dawn_native/ComputePipeline.h"
+#include "dawn_native/Device.h"
+#include "dawn_native/PipelineLayout.h"
+#include "dawn_native/RenderPipeline.h"
+#include "dawn_native/ShaderModule.h"
+
+#include <array>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace dawn_native {
+
+    namespace {
+
+        constexpr uint32_t kManifestMagic = 0x464D5044;  // "DPMF"
+        // Must be incremented when the format of the manifest or of the structures it contains
+        // changes, so that manifests recorded by other versions are rejected.
+        constexpr uint32_t kManifestVersion = 1;
+
+        enum class PipelineType : uint32_t {
+            Compute,
+            Render,
+        };
+
+        class Reader {
+          public:
+            Reader(const void* data, size_t size)
+                : mData(static_cast<const uint8_t*>(data)), mSize(size) {
+            }
+
+            template <typename T>
+            MaybeError Read(T* value) {
+                static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                              "Only scalars are read directly");
+                DAWN_TRY(ReadBytes(value, sizeof(T)));
+                return {};
+            }
+
+            MaybeError Read(bool* value) {
+                uint8_t byte;
+                DAWN_TRY(ReadBytes(&byte, sizeof(byte)));
+                if (byte > 1) {
+                    return DAWN_VALIDATION_ERROR("Pipeline manifest has an invalid bool");
+                }
+                *value = byte != 0;
+                return {};
+            }
+
+            MaybeError ReadString(std::string* value) {
+                uint32_t length;
+                DAWN_TRY(Read(&length));
+                DAWN_TRY(CheckAvailable(length));
+                value->assign(reinterpret_cast<const char*>(mData + mOffset), length);
+                mOffset += length;
+                return {};
+            }
+
+            MaybeError ReadWords(std::vector<uint32_t>* words, uint32_t count) {
+                DAWN_TRY(CheckAvailable(uint64_t(count) * sizeof(uint32_t)));
+                words->resize(count);
+                return ReadBytes(words->data(), count * sizeof(uint32_t));
+            }
+
+            // Returns an error if there aren't at least `count` elements of `elementSize` bytes
+            // left. Used before allocating storage for arrays, so that corrupted counts don't
+            // cause huge allocations.
+            MaybeError CheckCount(uint32_t count, size_t elementSize) {
+                return CheckAvailable(uint64_t(count) * elementSize);
+            }
+
+            bool IsAtEnd() const {
+                return mOffset == mSize;
+            }
+
+          private:
+            MaybeError CheckAvailable(uint64_t size) const {
+                if (size > mSize - mOffset) {
+                    return DAWN_VALIDATION_ERROR("Pipeline manifest is truncated");
+                }
+                return {};
+            }
+
+            MaybeError ReadBytes(void* data, size_t size) {
+                DAWN_TRY(CheckAvailable(size));
+                memcpy(data, mData + mOffset, size);
+                mOffset += size;
+                return {};
+            }
+
+            const uint8_t* mData;
+            size_t mSize;
+            size_t mOffset = 0;
+        };
+
+        // Pipelines that failed to be created are dropped, their error was already reported.
+        void AddPipeline(std::vector<Ref<PipelineBase>>* pipelines, PipelineBase* pipeline) {
+            Ref<PipelineBase> ref = AcquireRef(pipeline);
+            if (!ref->IsError()) {
+                pipelines->push_back(std::move(ref));
+            }
+        }
+
+        // The storage for the strings and arrays a stage points to.
+        struct StageStorage {
+            std::string entryPoint;
+            std::vector<SpecializationConstant> constants;
+        };
+
+        MaybeError ReadLayout(DeviceBase* device, Reader* reader, Ref<PipelineLayoutBase>* layout) {
+            uint32_t groupCount;
+            DAWN_TRY(reader->Read(&groupCount));
+            if (groupCount > kMaxBindGroups) {
+                return DAWN_VALIDATION_ERROR("Pipeline manifest has too many bind groups");
+            }
+
+            std::array<Ref<BindGroupLayoutBase>, kMaxBindGroups> bindGroupLayouts;
+            std::array<BindGroupLayoutBase*, kMaxBindGroups> bindGroupLayoutPointers;
+            for (uint32_t group = 0; group < groupCount; ++group) {
+                uint32_t bindingCount;
+                DAWN_TRY(reader->Read(&bindingCount));
+                if (bindingCount > kMaxBindingsPerGroup) {
+                    return DAWN_VALIDATION_ERROR("Pipeline manifest has too many bindings");
+                }
+
+                std::array<BindGroupLayoutBinding, kMaxBindingsPerGroup> bindings;
+                for (uint32_t i = 0; i < bindingCount; ++i) {
+                    BindGroupLayoutBinding* binding = &bindings[i];
+                    DAWN_TRY(reader->Read(&binding->binding));
+                    DAWN_TRY(reader->Read(&binding->visibility));
+                    DAWN_TRY(reader->Read(&binding->type));
+                    DAWN_TRY(reader->Read(&binding->hasDynamicOffset));
+                    DAWN_TRY(reader->Read(&binding->multisampled));
+                    DAWN_TRY(reader->Read(&binding->textureDimension));
+                    DAWN_TRY(reader->Read(&binding->textureComponentType));
+                    DAWN_TRY(reader->Read(&binding->arrayLength));
+                }
+
+                BindGroupLayoutDescriptor descriptor;
+                descriptor.bindingCount = bindingCount;
+                descriptor.bindings = bindings.data();
+                bindGroupLayouts[group] = AcquireRef(device->CreateBindGroupLayout(&descriptor));
+                bindGroupLayoutPointers[group] = bindGroupLayouts[group].Get();
+            }
+
+            PipelineLayoutDescriptor descriptor;
+            descriptor.bindGroupLayoutCount = groupCount;
+            descriptor.bindGroupLayouts = bindGroupLayoutPointers.data();
+            *layout = AcquireRef(device->CreatePipelineLayout(&descriptor));
+            return {};
+        }
+
+        MaybeError ReadStage(Reader* reader,
+                             std::vector<Ref<ShaderModuleBase>>* modules,
+                             ProgrammableStageDescriptor* stage,
+                             StageStorage* storage) {
+            uint32_t moduleIndex;
+            DAWN_TRY(reader->Read(&moduleIndex));
+            if (moduleIndex >= modules->size()) {
+                return DAWN_VALIDATION_ERROR("Pipeline manifest uses an unknown shader module");
+            }
+            stage->module = (*modules)[moduleIndex].Get();
+
+            DAWN_TRY(reader->ReadString(&storage->entryPoint));
+            stage->entryPoint = storage->entryPoint.c_str();
+
+            uint32_t constantCount;
+            DAWN_TRY(reader->Read(&constantCount));
+            DAWN_TRY(reader->CheckCount(constantCount, sizeof(uint32_t) + sizeof(double)));
+            storage->constants.resize(constantCount);
+            for (SpecializationConstant& constant : storage->constants) {
+                DAWN_TRY(reader->Read(&constant.id));
+                DAWN_TRY(reader->Read(&constant.value));
+            }
+            stage->constantCount = constantCount;
+            stage->constants = storage->constants.data();
+            return {};
+        }
+
+        MaybeError ReadBlend(Reader* reader, BlendDescriptor* blend) {
+            DAWN_TRY(reader->Read(&blend->operation));
+            DAWN_TRY(reader->Read(&blend->srcFactor));
+            DAWN_TRY(reader->Read(&blend->dstFactor));
+            return {};
+        }
+
+        MaybeError ReadStencilFace(Reader* reader, StencilStateFaceDescriptor* face) {
+            DAWN_TRY(reader->Read(&face->compare));
+            DAWN_TRY(reader->Read(&face->failOp));
+            DAWN_TRY(reader->Read(&face->depthFailOp));
+            DAWN_TRY(reader->Read(&face->passOp));
+            return {};
+        }
+
+        MaybeError ReplayComputePipeline(DeviceBase* device,
+                                         Reader* reader,
+                                         std::vector<Ref<ShaderModuleBase>>* modules,
+                                         std::vector<Ref<PipelineBase>>* pipelines) {
+            Ref<PipelineLayoutBase> layout;
+            DAWN_TRY(ReadLayout(device, reader, &layout));
+
+            ComputePipelineDescriptor descriptor;
+            descriptor.layout = layout.Get();
+            StageStorage computeStorage;
+            DAWN_TRY(ReadStage(reader, modules, &descriptor.computeStage, &computeStorage));
+
+            AddPipeline(pipelines, device->CreateComputePipeline(&descriptor));
+            return {};
+        }
+
+        MaybeError ReplayRenderPipeline(DeviceBase* device,
+                                        Reader* reader,
+                                        std::vector<Ref<ShaderModuleBase>>* modules,
+                                        std::vector<Ref<PipelineBase>>* pipelines) {
+            Ref<PipelineLayoutBase> layout;
+            DAWN_TRY(ReadLayout(device, reader, &layout));
+
+            RenderPipelineDescriptor descriptor;
+            descriptor.layout = layout.Get();
+
+            StageStorage vertexStorage;
+            DAWN_TRY(ReadStage(reader, modules, &descriptor.vertexStage, &vertexStorage));
+
+            bool hasFragmentStage;
+            ProgrammableStageDescriptor fragmentStage;
+            StageStorage fragmentStorage;
+            DAWN_TRY(reader->Read(&hasFragmentStage));
+            if (hasFragmentStage) {
+                DAWN_TRY(ReadStage(reader, modules, &fragmentStage, &fragmentStorage));
+                descriptor.fragmentStage = &fragmentStage;
+            }
+
+            bool hasVertexState;
+            VertexStateDescriptor vertexState;
+            std::vector<VertexBufferLayoutDescriptor> vertexBuffers;
+            std::vector<std::vector<VertexAttributeDescriptor>> vertexAttributes;
+            DAWN_TRY(reader->Read(&hasVertexState));
+            if (hasVertexState) {
+                DAWN_TRY(reader->Read(&vertexState.indexFormat));
+                DAWN_TRY(reader->Read(&vertexState.vertexBufferCount));
+                if (vertexState.vertexBufferCount > kMaxVertexBuffers) {
+                    return DAWN_VALIDATION_ERROR("Pipeline manifest has too many vertex buffers");
+                }
+
+                vertexBuffers.resize(vertexState.vertexBufferCount);
+                vertexAttributes.resize(vertexState.vertexBufferCount);
+                for (uint32_t i = 0; i < vertexState.vertexBufferCount; ++i) {
+                    VertexBufferLayoutDescriptor* buffer = &vertexBuffers[i];
+                    DAWN_TRY(reader->Read(&buffer->arrayStride));
+                    DAWN_TRY(reader->Read(&buffer->stepMode));
+                    DAWN_TRY(reader->Read(&buffer->attributeCount));
+                    if (buffer->attributeCount > kMaxVertexAttributes) {
+                        return DAWN_VALIDATION_ERROR(
+                            "Pipeline manifest has too many vertex attributes");
+                    }
+
+                    vertexAttributes[i].resize(buffer->attributeCount);
+                    for (VertexAttributeDescriptor& attribute : vertexAttributes[i]) {
+                        DAWN_TRY(reader->Read(&attribute.format));
+                        DAWN_TRY(reader->Read(&attribute.offset));
+                        DAWN_TRY(reader->Read(&attribute.shaderLocation));
+                    }
+                    buffer->attributes = vertexAttributes[i].data();
+                }
+                vertexState.vertexBuffers = vertexBuffers.data();
+                descriptor.vertexState = &vertexState;
+            }
+
+            DAWN_TRY(reader->Read(&descriptor.primitiveTopology));
+
+            bool hasRasterizationState;
+            RasterizationStateDescriptor rasterizationState;
+            DAWN_TRY(reader->Read(&hasRasterizationState));
+            if (hasRasterizationState) {
+                DAWN_TRY(reader->Read(&rasterizationState.frontFace));
+                DAWN_TRY(reader->Read(&rasterizationState.cullMode));
+                DAWN_TRY(reader->Read(&rasterizationState.depthBias));
+                DAWN_TRY(reader->Read(&rasterizationState.depthBiasSlopeScale));
+                DAWN_TRY(reader->Read(&rasterizationState.depthBiasClamp));
+                descriptor.rasterizationState = &rasterizationState;
+            }
+
+            DAWN_TRY(reader->Read(&descriptor.sampleCount));
+
+            bool hasDepthStencilState;
+            DepthStencilStateDescriptor depthStencilState;
+            DAWN_TRY(reader->Read(&hasDepthStencilState));
+            if (hasDepthStencilState) {
+                DAWN_TRY(reader->Read(&depthStencilState.format));
+                DAWN_TRY(reader->Read(&depthStencilState.depthWriteEnabled));
+                DAWN_TRY(reader->Read(&depthStencilState.depthCompare));
+                DAWN_TRY(ReadStencilFace(reader, &depthStencilState.stencilFront));
+                DAWN_TRY(ReadStencilFace(reader, &depthStencilState.stencilBack));
+                DAWN_TRY(reader->Read(&depthStencilState.stencilReadMask));
+                DAWN_TRY(reader->Read(&depthStencilState.stencilWriteMask));
+                descriptor.depthStencilState = &depthStencilState;
+            }
+
+            std::array<ColorStateDescriptor, kMaxColorAttachments> colorStates;
+            DAWN_TRY(reader->Read(&descriptor.colorStateCount));
+            if (descriptor.colorStateCount > kMaxColorAttachments) {
+                return DAWN_VALIDATION_ERROR("Pipeline manifest has too many color states");
+            }
+            for (uint32_t i = 0; i < descriptor.colorStateCount; ++i) {
+                ColorStateDescriptor* colorState = &colorStates[i];
+                DAWN_TRY(reader->Read(&colorState->format));
+                DAWN_TRY(ReadBlend(reader, &colorState->alphaBlend));
+                DAWN_TRY(ReadBlend(reader, &colorState->colorBlend));
+                DAWN_TRY(reader->Read(&colorState->writeMask));
+            }
+            descriptor.colorStates = colorStates.data();
+
+            DAWN_TRY(reader->Read(&descriptor.sampleMask));
+            DAWN_TRY(reader->Read(&descriptor.alphaToCoverageEnabled));
+
+            AddPipeline(pipelines, device->CreateRenderPipeline(&descriptor));
+            return {};
+        }
+
+    }  // anonymous namespace
+
+    class PipelineManifest::Writer {
+      public:
+        template <typename T>
+        void Write(T value) {
+            static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                          "Only scalars are written directly");
+            WriteBytes(&value, sizeof(T));
+        }
+
+        void WriteString(const char* value) {
+            uint32_t length = static_cast<uint32_t>(strlen(value));
+            Write(length);
+            WriteBytes(value, length);
+        }
+
+        void WriteBytes(const void* data, size_t size) {
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            mData.insert(mData.end(), bytes, bytes + size);
+        }
+
+        std::vector<uint8_t> AcquireData() {
+            return std::move(mData);
+        }
+
+      private:
+        std::vector<uint8_t> mData;
+    };
+
+    void PipelineManifest::RecordComputePipeline(const ComputePipelineDescriptor* descriptor) {
+        Writer writer;
+        writer.Write(PipelineType::Compute);
+        WriteLayout(&writer, descriptor->layout);
+        WriteStage(&writer, &descriptor->computeStage);
+        AddPipeline(writer.AcquireData());
+    }
+
+    void PipelineManifest::RecordRenderPipeline(const RenderPipelineDescriptor* descriptor) {
+        Writer writer;
+        writer.Write(PipelineType::Render);
+        WriteLayout(&writer, descriptor->layout);
+        WriteStage(&writer, &descriptor->vertexStage);
+
+        writer.Write(descriptor->fragmentStage != nullptr);
+        if (descriptor->fragmentStage != nullptr) {
+            WriteStage(&writer, descriptor->fragmentStage);
+        }
+
+        const VertexStateDescriptor* vertexState = descriptor->vertexState;
+        writer.Write(vertexState != nullptr);
+        if (vertexState != nullptr) {
+            writer.Write(vertexState->indexFormat);
+            writer.Write(vertexState->vertexBufferCount);
+            for (uint32_t i = 0; i < vertexState->vertexBufferCount; ++i) {
+                const VertexBufferLayoutDescriptor& buffer = vertexState->vertexBuffers[i];
+                writer.Write(buffer.arrayStride);
+                writer.Write(buffer.stepMode);
+                writer.Write(buffer.attributeCount);
+                for (uint32_t j = 0; j < buffer.attributeCount; ++j) {
+                    writer.Write(buffer.attributes[j].format);
+                    writer.Write(buffer.attributes[j].offset);
+                    writer.Write(buffer.attributes[j].shaderLocation);
+                }
+            }
+        }
+
+        writer.Write(descriptor->primitiveTopology);
+
+        const RasterizationStateDescriptor* rasterizationState = descriptor->rasterizationState;
+        writer.Write(rasterizationState != nullptr);
+        if (rasterizationState != nullptr) {
+            writer.Write(rasterizationState->frontFace);
+            writer.Write(rasterizationState->cullMode);
+            writer.Write(rasterizationState->depthBias);
+            writer.Write(rasterizationState->depthBiasSlopeScale);
+            writer.Write(rasterizationState->depthBiasClamp);
+        }
+
+        writer.Write(descriptor->sampleCount);
+
+        const DepthStencilStateDescriptor* depthStencilState = descriptor->depthStencilState;
+        writer.Write(depthStencilState != nullptr);
+        if (depthStencilState != nullptr) {
+            writer.Write(depthStencilState->format);
+            writer.Write(depthStencilState->depthWriteEnabled);
+            writer.Write(depthStencilState->depthCompare);
+            for (const StencilStateFaceDescriptor* face :
+                 {&depthStencilState->stencilFront, &depthStencilState->stencilBack}) {
+                writer.Write(face->compare);
+                writer.Write(face->failOp);
+                writer.Write(face->depthFailOp);
+                writer.Write(face->passOp);
+            }
+            writer.Write(depthStencilState->stencilReadMask);
+            writer.Write(depthStencilState->stencilWriteMask);
+        }
+
+        writer.Write(descriptor->colorStateCount);
+        for (uint32_t i = 0; i < descriptor->colorStateCount; ++i) {
+            const ColorStateDescriptor& colorState = descriptor->colorStates[i];
+            writer.Write(colorState.format);
+            for (const BlendDescriptor* blend : {&colorState.alphaBlend, &colorState.colorBlend}) {
+                writer.Write(blend->operation);
+                writer.Write(blend->srcFactor);
+                writer.Write(blend->dstFactor);
+            }
+            writer.Write(colorState.writeMask);
+        }
+
+        writer.Write(descriptor->sampleMask);
+        writer.Write(descriptor->alphaToCoverageEnabled);
+        AddPipeline(writer.AcquireData());
+    }
+
+    std::vector<uint8_t> PipelineManifest::Serialize() const {
+        Writer writer;
+        writer.Write(kManifestMagic);
+        writer.Write(kManifestVersion);
+
+        writer.Write(static_cast<uint32_t>(mShaderModules.size()));
+        for (const std::vector<uint32_t>& code : mShaderModules) {
+            writer.Write(static_cast<uint32_t>(code.size()));
+            writer.WriteBytes(code.data(), code.size() * sizeof(uint32_t));
+        }
+
+        writer.Write(static_cast<uint32_t>(mPipelines.size()));
+        for (const std::vector<uint8_t>& pipeline : mPipelines) {
+            writer.WriteBytes(pipeline.data(), pipeline.size());
+        }
+        return writer.AcquireData();
+    }
+
+    void PipelineManifest::WriteLayout(Writer* writer, const PipelineLayoutBase* layout) {
+        // Pipeline layouts are created from an array of bind group layouts so the groups used are
+        // always the first ones.
+        const std::bitset<kMaxBindGroups> groups = layout->GetBindGroupLayoutsMask();
+        uint32_t groupCount = static_cast<uint32_t>(groups.count());
+        ASSERT(groupCount == kMaxBindGroups || !groups[groupCount]);
+        writer->Write(groupCount);
+
+        for (uint32_t group = 0; group < groupCount; ++group) {
+            const BindGroupLayoutBase::LayoutBindingInfo& info =
+                layout->GetBindGroupLayout(group)->GetBindingInfo();
+            writer->Write(static_cast<uint32_t>(info.mask.count()));
+            for (uint32_t binding : IterateBitSet(info.mask)) {
+                writer->Write(binding);
+                writer->Write(info.visibilities[binding]);
+                writer->Write(info.types[binding]);
+                writer->Write(static_cast<bool>(info.hasDynamicOffset[binding]));
+                writer->Write(static_cast<bool>(info.multisampled[binding]));
+                writer->Write(info.textureDimensions[binding]);
+                writer->Write(info.textureComponentTypes[binding]);
+                writer->Write(info.arrayLengths[binding]);
+            }
+        }
+    }
+
+    void PipelineManifest::WriteStage(Writer* writer, const ProgrammableStageDescriptor* stage) {
+        const ShaderModuleBase* module = stage->module;
+        const std::vector<uint32_t>& code = module->GetOriginalCode();
+        size_t hash = ShaderModuleBase::HashFunc()(module);
+
+        uint32_t moduleIndex = static_cast<uint32_t>(mShaderModules.size());
+        auto range = mShaderModuleIndices.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (mShaderModules[it->second] == code) {
+                moduleIndex = it->second;
+                break;
+            }
+        }
+        if (moduleIndex == mShaderModules.size()) {
+            mShaderModules.push_back(code);
+            mShaderModuleIndices.emplace(hash, moduleIndex);
+        }
+
+        writer->Write(moduleIndex);
+        writer->WriteString(stage->entryPoint);
+        writer->Write(stage->constantCount);
+        for (uint32_t i = 0; i < stage->constantCount; ++i) {
+            writer->Write(stage->constants[i].id);
+            writer->Write(stage->constants[i].value);
+        }
+    }
+
+    void PipelineManifest::AddPipeline(std::vector<uint8_t> pipeline) {
+        if (mRecordedPipelines.insert(pipeline).second) {
+            mPipelines.push_back(std::move(pipeline));
+        }
+    }
+
+    MaybeError ReplayPipelineManifest(DeviceBase* device,
+                                      const void* data,
+                                      size_t size,
+                                      std::vector<Ref<PipelineBase>>* pipelines) {
+        Reader reader(data, size);
+
+        uint32_t magic;
+        uint32_t version;
+        DAWN_TRY(reader.Read(&magic));
+        DAWN_TRY(reader.Read(&version));
+        if (magic != kManifestMagic || version != kManifestVersion) {
+            return DAWN_VALIDATION_ERROR("Pipeline manifest was recorded by another version");
+        }
+
+        uint32_t moduleCount;
+        DAWN_TRY(reader.Read(&moduleCount));
+        DAWN_TRY(reader.CheckCount(moduleCount, sizeof(uint32_t)));
+
+        std::vector<Ref<ShaderModuleBase>> modules(moduleCount);
+        for (Ref<ShaderModuleBase>& module : modules) {
+            uint32_t codeSize;
+            std::vector<uint32_t> code;
+            DAWN_TRY(reader.Read(&codeSize));
+            DAWN_TRY(reader.ReadWords(&code, codeSize));
+
+            ShaderModuleDescriptor descriptor;
+            descriptor.codeSize = codeSize;
+            descriptor.code = code.data();
+            module = AcquireRef(device->CreateShaderModule(&descriptor));
+        }
+
+        uint32_t pipelineCount;
+        DAWN_TRY(reader.Read(&pipelineCount));
+        DAWN_TRY(reader.CheckCount(pipelineCount, sizeof(PipelineType)));
+        for (uint32_t i = 0; i < pipelineCount; ++i) {
+            PipelineType type;
+            DAWN_TRY(reader.Read(&type));
+            switch (type) {
+                case PipelineType::Compute:
+                    DAWN_TRY(ReplayComputePipeline(device, &reader, &modules, pipelines));
+                    break;
+                case PipelineType::Render:
+                    DAWN_TRY(ReplayRenderPipeline(device, &reader, &modules, pipelines));
+                    break;
+                default:
+                    return DAWN_VALIDATION_ERROR("Pipeline manifest has an unknown pipeline type");
+            }
+        }
+
+        if (!reader.IsAtEnd()) {
+            return DAWN_VALIDATION_ERROR("Pipeline manifest has trailing data");
+        }
+        return {};
+    }
+
+}  // namespace dawn_native
@@ -0,0 +1,68 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_PIPELINEMANIFEST_H_
+#define DAWNNATIVE_PIPELINEMANIFEST_H_
+
+#include "dawn_native/Error.h"
+#include "dawn_native/Forward.h"
+#include "dawn_native/RefCounted.h"
+
+#include "dawn_native/dawn_platform.h"
+
+#include <cstdint>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace dawn_native {
+
+    // PipelineManifest records the descriptors of the compute and render pipelines created by a
+    // device, in a serialized form that an application can save and replay on a later run with
+    // ReplayPipelineManifest. Shader modules are stored once even if several pipelines use them,
+    // and a pipeline that is created several times is recorded once.
+    // The serialized data is only meant to be replayed by the same version of Dawn.
+    class PipelineManifest {
+      public:
+        void RecordComputePipeline(const ComputePipelineDescriptor* descriptor);
+        void RecordRenderPipeline(const RenderPipelineDescriptor* descriptor);
+
+        std::vector<uint8_t> Serialize() const;
+
+      private:
+        class Writer;
+        void WriteLayout(Writer* writer, const PipelineLayoutBase* layout);
+        void WriteStage(Writer* writer, const ProgrammableStageDescriptor* stage);
+        void AddPipeline(std::vector<uint8_t> pipeline);
+
+        std::vector<std::vector<uint32_t>> mShaderModules;
+        // Indices in mShaderModules keyed by the hash of the code.
+        std::unordered_multimap<size_t, uint32_t> mShaderModuleIndices;
+
+        // The serialized pipelines in the order they were created.
+        std::vector<std::vector<uint8_t>> mPipelines;
+        std::set<std::vector<uint8_t>> mRecordedPipelines;
+    };
+
+    // Creates the pipelines of a manifest and appends them to `pipelines`. Errors creating the
+    // objects are reported to the device like for any other creation; an error is only returned
+    // if the data isn't a valid manifest.
+    MaybeError ReplayPipelineManifest(DeviceBase* device,
+                                      const void* data,
+                                      size_t size,
+                                      std::vector<Ref<PipelineBase>>* pipelines);
+
+}  // namespace dawn_native
+
+#endif  // DAWNNATIVE_PIPELINEMANIFEST_H_
@@ -0,0 +1,66 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn_native/PollableEvent.h"
+
+#include "common/Compiler.h"
+#include "common/Platform.h"
+
+#if defined(DAWN_PLATFORM_LINUX)
+#    include <sys/eventfd.h>
+#    include <unistd.h>
+
+#    include <cstdint>
+#endif
+
+namespace dawn_native {
+
+    PollableEvent::PollableEvent() {
+#if defined(DAWN_PLATFORM_LINUX)
+        mFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+#endif
+    }
+
+    PollableEvent::~PollableEvent() {
+#if defined(DAWN_PLATFORM_LINUX)
+        if (mFd != -1) {
+            close(mFd);
+        }
+#endif
+    }
+
+    int PollableEvent::GetFd() const {
+        return mFd;
+    }
+
+    void PollableEvent::Signal() {
+#if defined(DAWN_PLATFORM_LINUX)
+        // The write can only fail if the counter would overflow, in which case the event is
+        // already signaled.
+        uint64_t value = 1;
+        ssize_t written = write(mFd, &value, sizeof(value));
+        DAWN_UNUSED(written);
+#endif
+    }
+
+    void PollableEvent::Reset() {
+#if defined(DAWN_PLATFORM_LINUX)
+        // Reading an eventfd resets its counter, or fails with EAGAIN if it isn't signaled.
+        uint64_t value;
+        ssize_t result = read(mFd, &value, sizeof(value));
+        DAWN_UNUSED(result);
+#endif
+    }
+
+}  // namespace dawn_native
@@ -0,0 +1,42 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_POLLABLEEVENT_H_
+#define DAWNNATIVE_POLLABLEEVENT_H_
+
+namespace dawn_native {
+
+    // PollableEvent wraps a file descriptor that is readable while the event is signaled, so that
+    // applications can wait for it with poll/epoll along with their other file descriptors. It
+    // is an eventfd on Linux and isn't supported on other platforms, where GetFd returns -1.
+    // Signal can be called from any thread.
+    class PollableEvent {
+      public:
+        PollableEvent();
+        ~PollableEvent();
+
+        PollableEvent(const PollableEvent&) = delete;
+        PollableEvent& operator=(const PollableEvent&) = delete;
+
+        int GetFd() const;
+        void Signal();
+        void Reset();
+
+      private:
+        int mFd = -1;
+    };
+
+}  // namespace dawn_native
+
+#endif  // DAWNNATIVE_POLLABLEEVENT_H_
@@ -27,6 +27,36 @@
 namespace dawn_native {
 
     namespace {
+        void TrackBindingArrayResourceUsage(PassResourceUsageTracker* usageTracker,
+                                            BindGroupBase* group,
+                                            uint32_t binding,
+                                            wgpu::BindingType type) {
+            for (BindingArrayElement& element : group->GetBindingArrayElements(binding)) {
+                switch (type) {
+                    case wgpu::BindingType::StorageBuffer:
+                        usageTracker->BufferUsedAs(static_cast<BufferBase*>(element.resource.Get()),
+                                                   wgpu::BufferUsage::Storage);
+                        break;
+
+                    case wgpu::BindingType::ReadonlyStorageBuffer:
+                        usageTracker->BufferUsedAs(static_cast<BufferBase*>(element.resource.Get()),
+                                                   kReadOnlyStorage);
+                        break;
+
+                    case wgpu::BindingType::SampledTexture: {
+                        TextureViewBase* view =
+                            static_cast<TextureViewBase*>(element.resource.Get());
+                        usageTracker->TextureUsedAs(view->GetTexture(),
+                                                    wgpu::TextureUsage::Sampled);
+                    } break;
+
+                    default:
+                        UNREACHABLE();
+                        break;
+                }
+            }
+        }
+
         void TrackBindGroupResourceUsage(PassResourceUsageTracker* usageTracker,
                                          BindGroupBase* group) {
             const auto& layoutInfo = group->GetLayout()->GetBindingInfo();
@@ -34,6 +64,11 @@ namespace dawn_native {
             for (uint32_t i : IterateBitSet(layoutInfo.mask)) {
                 wgpu::BindingType type = layoutInfo.types[i];
 
+                if (layoutInfo.arrayLengths[i] != 0) {
+                    TrackBindingArrayResourceUsage(usageTracker, group, i, type);
+                    continue;
+                }
+
                 switch (type) {
                     case wgpu::BindingType::UniformBuffer: {
                         BufferBase* buffer = group->GetBindingAsBufferBinding(i).buffer;
@@ -155,6 +190,7 @@ namespace dawn_native {
             SetBindGroupCmd* cmd = allocator->Allocate<SetBindGroupCmd>(Command::SetBindGroup);
             cmd->index = groupIndex;
             cmd->group = group;
+            mEncodingContext->ReferenceObject(group);
             cmd->dynamicOffsetCount = dynamicOffsetCount;
             if (dynamicOffsetCount > 0) {
                 uint32_t* offsets = allocator->AllocateData<uint32_t>(cmd->dynamicOffsetCount);
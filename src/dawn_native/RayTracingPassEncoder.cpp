@@ -82,6 +82,7 @@ namespace dawn_native {
             SetRayTracingPipelineCmd* setPipeline =
                 allocator->Allocate<SetRayTracingPipelineCmd>(Command::SetRayTracingPipeline);
             setPipeline->pipeline = pipeline;
+            mEncodingContext->ReferenceObject(pipeline);
 
             return {};
         });
@@ -30,7 +30,7 @@ namespace dawn_native {
     }
 
     uint64_t RefCounted::GetRefCountForTesting() const {
-        return mRefCount >> kPayloadBits;
+        return RefCountPolicy::Load(mRefCount) >> kPayloadBits;
     }
 
     uint64_t RefCounted::GetRefCountPayload() const {
@@ -38,22 +38,22 @@ namespace dawn_native {
         // initialization so we can use the relaxed memory order. The order doesn't guarantee
         // anything except the atomicity of the load, which is enough since any past values of the
         // atomic will have the correct payload bits.
-        return kPayloadMask & mRefCount.load(std::memory_order_relaxed);
+        return kPayloadMask & RefCountPolicy::Load(mRefCount);
     }
 
     void RefCounted::Reference() {
-        ASSERT((mRefCount & ~kPayloadMask) != 0);
+        ASSERT((RefCountPolicy::Load(mRefCount) & ~kPayloadMask) != 0);
 
         // The relaxed ordering guarantees only the atomicity of the update, which is enough here
         // because the reference we are copying from still exists and makes sure other threads
         // don't delete `this`.
         // See the explanation in the Boost documentation:
         //     https://www.boost.org/doc/libs/1_55_0/doc/html/atomic/usage_examples.html
-        mRefCount.fetch_add(kRefCountIncrement, std::memory_order_relaxed);
+        RefCountPolicy::Increment(&mRefCount, kRefCountIncrement);
     }
 
     void RefCounted::Release() {
-        ASSERT((mRefCount & ~kPayloadMask) != 0);
+        ASSERT((RefCountPolicy::Load(mRefCount) & ~kPayloadMask) != 0);
 
         // The release fence here is to make sure all accesses to the object on a thread A
         // happen-before the object is deleted on a thread B. The release memory order ensures that
@@ -64,15 +64,14 @@ namespace dawn_native {
         //
         // See the explanation in the Boost documentation:
         //     https://www.boost.org/doc/libs/1_55_0/doc/html/atomic/usage_examples.html
-        uint64_t previousRefCount =
-            mRefCount.fetch_sub(kRefCountIncrement, std::memory_order_release);
+        uint64_t previousRefCount = RefCountPolicy::Decrement(&mRefCount, kRefCountIncrement);
 
         // Check that the previous reference count was strictly less than 2, ignoring payload bits.
         if (previousRefCount < 2 * kRefCountIncrement) {
             // Note that on ARM64 this will generate a `dmb ish` instruction which is a global
             // memory barrier, when an acquire load on mRefCount (using the `ldar` instruction)
             // should be enough and could end up being faster.
-            std::atomic_thread_fence(std::memory_order_acquire);
+            RefCountPolicy::SynchronizeBeforeDelete();
             delete this;
         }
     }
@@ -20,6 +20,55 @@
 
 namespace dawn_native {
 
+    // Reference counting policies used by RefCounted. The atomic policy lets objects be
+    // referenced and released from any thread. The non-atomic policy is selected with the
+    // dawn_non_atomic_refcount build argument and avoids the cost of atomic read-modify-writes
+    // when devices and their objects are only ever used from a single thread. That includes
+    // threads created by Dawn: the non-atomic policy is incompatible with work that Dawn moves to
+    // worker threads holding references to objects, which must not be enabled with it.
+    struct AtomicRefCountPolicy {
+        using Storage = std::atomic_uint64_t;
+
+        static uint64_t Load(const Storage& count) {
+            return count.load(std::memory_order_relaxed);
+        }
+        static void Increment(Storage* count, uint64_t amount) {
+            count->fetch_add(amount, std::memory_order_relaxed);
+        }
+        // Returns the value of the count before the decrement.
+        static uint64_t Decrement(Storage* count, uint64_t amount) {
+            return count->fetch_sub(amount, std::memory_order_release);
+        }
+        // Called before deleting an object whose count dropped to zero.
+        static void SynchronizeBeforeDelete() {
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+    };
+
+    struct NonAtomicRefCountPolicy {
+        using Storage = uint64_t;
+
+        static uint64_t Load(const Storage& count) {
+            return count;
+        }
+        static void Increment(Storage* count, uint64_t amount) {
+            *count += amount;
+        }
+        static uint64_t Decrement(Storage* count, uint64_t amount) {
+            uint64_t previous = *count;
+            *count -= amount;
+            return previous;
+        }
+        static void SynchronizeBeforeDelete() {
+        }
+    };
+
+#if defined(DAWN_NON_ATOMIC_REFCOUNT)
+    using RefCountPolicy = NonAtomicRefCountPolicy;
+#else
+    using RefCountPolicy = AtomicRefCountPolicy;
+#endif
+
     class RefCounted {
       public:
         RefCounted(uint64_t payload = 0);
@@ -33,7 +82,7 @@ namespace dawn_native {
         void Release();
 
       protected:
-        std::atomic_uint64_t mRefCount;
+        RefCountPolicy::Storage mRefCount;
     };
 
     template <typename T>
@@ -27,6 +27,7 @@ namespace dawn_native {
                                        PassResourceUsage resourceUsage)
         : ObjectBase(encoder->GetDevice()),
           mCommands(encoder->AcquireCommands()),
+          mReferencedObjects(encoder->AcquireReferencedObjects()),
           mAttachmentState(attachmentState),
           mResourceUsage(std::move(resourceUsage)) {
     }
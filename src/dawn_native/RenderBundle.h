@@ -25,6 +25,7 @@
 #include "dawn_native/dawn_platform.h"
 
 #include <bitset>
+#include <vector>
 
 namespace dawn_native {
 
@@ -51,6 +52,8 @@ namespace dawn_native {
         RenderBundleBase(DeviceBase* device, ErrorTag errorTag);
 
         CommandIterator mCommands;
+        // Keeps alive the objects the commands point to without holding a reference.
+        std::vector<Ref<ObjectBase>> mReferencedObjects;
         Ref<AttachmentState> mAttachmentState;
         PassResourceUsage mResourceUsage;
     };
@@ -101,6 +101,10 @@ namespace dawn_native {
         return mEncodingContext.AcquireCommands();
     }
 
+    std::vector<Ref<ObjectBase>> RenderBundleEncoder::AcquireReferencedObjects() {
+        return mEncodingContext.AcquireReferencedObjects();
+    }
+
     RenderBundleBase* RenderBundleEncoder::Finish(const RenderBundleDescriptor* descriptor) {
         PassResourceUsage usages = mUsageTracker.AcquireResourceUsage();
 
@@ -38,6 +38,7 @@ namespace dawn_native {
         RenderBundleBase* Finish(const RenderBundleDescriptor* descriptor);
 
         CommandIterator AcquireCommands();
+        std::vector<Ref<ObjectBase>> AcquireReferencedObjects();
 
       private:
         RenderBundleEncoder(DeviceBase* device, ErrorTag errorTag);
@@ -115,6 +115,7 @@ namespace dawn_native {
             SetRenderPipelineCmd* cmd =
                 allocator->Allocate<SetRenderPipelineCmd>(Command::SetRenderPipeline);
             cmd->pipeline = pipeline;
+            mEncodingContext->ReferenceObject(pipeline);
 
             return {};
         });
@@ -128,6 +129,7 @@ namespace dawn_native {
                 allocator->Allocate<SetIndexBufferCmd>(Command::SetIndexBuffer);
             cmd->buffer = buffer;
             cmd->offset = offset;
+            mEncodingContext->ReferenceObject(buffer);
 
             mUsageTracker.BufferUsedAs(buffer, wgpu::BufferUsage::Index);
 
@@ -148,6 +150,7 @@ namespace dawn_native {
             cmd->slot = slot;
             cmd->buffer = buffer;
             cmd->offset = offset;
+            mEncodingContext->ReferenceObject(buffer);
 
             mUsageTracker.BufferUsedAs(buffer, wgpu::BufferUsage::Vertex);
 
@@ -0,0 +1,199 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn_native/RenderPassMerging.h"
+
+#include "common/BitSetIterator.h"
+#include "dawn_native/CommandAllocator.h"
+#include "dawn_native/Commands.h"
+
+#include <functional>
+
+namespace dawn_native {
+
+    namespace {
+
+        bool HaveSameAttachments(const BeginRenderPassCmd* a, const BeginRenderPassCmd* b) {
+            // Attachment states are deduplicated by the device so this also checks the formats,
+            // the sample count and which attachments are present.
+            if (a->attachmentState.Get() != b->attachmentState.Get() || a->width != b->width ||
+                a->height != b->height) {
+                return false;
+            }
+
+            for (uint32_t i : IterateBitSet(a->attachmentState->GetColorAttachmentsMask())) {
+                if (a->colorAttachments[i].view.Get() != b->colorAttachments[i].view.Get() ||
+                    a->colorAttachments[i].resolveTarget.Get() !=
+                        b->colorAttachments[i].resolveTarget.Get()) {
+                    return false;
+                }
+            }
+
+            if (a->attachmentState->HasDepthStencilAttachment() &&
+                a->depthStencilAttachment.view.Get() != b->depthStencilAttachment.view.Get()) {
+                return false;
+            }
+
+            return true;
+        }
+
+        bool StoresAllAttachments(const BeginRenderPassCmd* pass) {
+            for (uint32_t i : IterateBitSet(pass->attachmentState->GetColorAttachmentsMask())) {
+                if (pass->colorAttachments[i].storeOp != wgpu::StoreOp::Store) {
+                    return false;
+                }
+            }
+
+            if (pass->attachmentState->HasDepthStencilAttachment()) {
+                const RenderPassDepthStencilAttachmentInfo& attachment =
+                    pass->depthStencilAttachment;
+                if (attachment.depthStoreOp != wgpu::StoreOp::Store ||
+                    attachment.stencilStoreOp != wgpu::StoreOp::Store) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        bool LoadsAllAttachments(const BeginRenderPassCmd* pass) {
+            for (uint32_t i : IterateBitSet(pass->attachmentState->GetColorAttachmentsMask())) {
+                if (pass->colorAttachments[i].loadOp != wgpu::LoadOp::Load) {
+                    return false;
+                }
+            }
+
+            if (pass->attachmentState->HasDepthStencilAttachment()) {
+                const RenderPassDepthStencilAttachmentInfo& attachment =
+                    pass->depthStencilAttachment;
+                if (attachment.depthLoadOp != wgpu::LoadOp::Load ||
+                    attachment.stencilLoadOp != wgpu::LoadOp::Load) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        template <typename Resource, typename Usage>
+        bool IsReadOnlySubsetOf(const std::vector<Resource*>& resources,
+                                const std::vector<Usage>& usages,
+                                const std::vector<Resource*>& previousResources,
+                                const std::vector<Usage>& previousUsages,
+                                Usage storageUsage) {
+            // The resources are sorted so both lists can be walked together.
+            size_t previous = 0;
+            for (size_t i = 0; i < resources.size(); ++i) {
+                if (usages[i] & storageUsage) {
+                    return false;
+                }
+
+                while (previous < previousResources.size() &&
+                       std::less<Resource*>()(previousResources[previous], resources[i])) {
+                    previous++;
+                }
+                if (previous == previousResources.size() ||
+                    previousResources[previous] != resources[i] ||
+                    previousUsages[previous] != usages[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Checks that the resources of the pass are already in the state the previous pass
+        // transitioned them to, and that the previous pass didn't write them as storage.
+        bool NeedsNoBarrierAfter(const PassResourceUsage& usages,
+                                 const PassResourceUsage& previousUsages) {
+            if (!usages.accelerationContainers.empty()) {
+                return false;
+            }
+
+            return IsReadOnlySubsetOf(usages.buffers, usages.bufferUsages, previousUsages.buffers,
+                                      previousUsages.bufferUsages, wgpu::BufferUsage::Storage) &&
+                   IsReadOnlySubsetOf(usages.textures, usages.textureUsages,
+                                      previousUsages.textures, previousUsages.textureUsages,
+                                      wgpu::TextureUsage::Storage);
+        }
+
+        void SkipPass(CommandIterator* commands, Command endCommand) {
+            Command type;
+            while (commands->NextCommandId(&type)) {
+                SkipCommand(commands, type);
+                if (type == endCommand) {
+                    return;
+                }
+            }
+            UNREACHABLE();
+        }
+
+    }  // anonymous namespace
+
+    std::vector<bool> ComputeRenderPassMerges(CommandIterator* commands,
+                                              const PerPassUsages& perPassUsages) {
+        std::vector<bool> merges;
+
+        // The previous render pass and its usages, only set when it is the last command.
+        const BeginRenderPassCmd* previousRenderPass = nullptr;
+        const PassResourceUsage* previousUsages = nullptr;
+        size_t nextPassNumber = 0;
+
+        commands->Reset();
+        Command type;
+        while (commands->NextCommandId(&type)) {
+            switch (type) {
+                case Command::BeginRenderPass: {
+                    const BeginRenderPassCmd* renderPass =
+                        commands->NextCommand<BeginRenderPassCmd>();
+                    const PassResourceUsage& usages = perPassUsages[nextPassNumber];
+
+                    merges.push_back(previousRenderPass != nullptr &&
+                                     HaveSameAttachments(previousRenderPass, renderPass) &&
+                                     StoresAllAttachments(previousRenderPass) &&
+                                     LoadsAllAttachments(renderPass) &&
+                                     NeedsNoBarrierAfter(usages, *previousUsages));
+
+                    SkipPass(commands, Command::EndRenderPass);
+                    previousRenderPass = renderPass;
+                    previousUsages = &usages;
+                    nextPassNumber++;
+                } break;
+
+                case Command::BeginComputePass: {
+                    commands->NextCommand<BeginComputePassCmd>();
+                    SkipPass(commands, Command::EndComputePass);
+                    previousRenderPass = nullptr;
+                    nextPassNumber++;
+                } break;
+
+                case Command::BeginRayTracingPass: {
+                    commands->NextCommand<BeginRayTracingPassCmd>();
+                    SkipPass(commands, Command::EndRayTracingPass);
+                    previousRenderPass = nullptr;
+                    nextPassNumber++;
+                } break;
+
+                default: {
+                    SkipCommand(commands, type);
+                    previousRenderPass = nullptr;
+                } break;
+            }
+        }
+        commands->Reset();
+
+        ASSERT(nextPassNumber == perPassUsages.size());
+        return merges;
+    }
+
+}  // namespace dawn_native
@@ -0,0 +1,45 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_RENDERPASSMERGING_H_
+#define DAWNNATIVE_RENDERPASSMERGING_H_
+
+#include "dawn_native/PassResourceUsage.h"
+
+#include <vector>
+
+namespace dawn_native {
+
+    class CommandIterator;
+
+    // Finds the render passes that can be recorded as a continuation of the render pass right
+    // before them, so that backends for tile-based GPUs can keep the attachments on-chip instead
+    // of storing them at the end of the first pass and loading them back at the start of the
+    // second. Returns one element per render pass, in recording order, that is true when the pass
+    // can be merged with the previous one.
+    //
+    // A render pass is merged with the previous one when:
+    //  - no command is recorded between the two passes,
+    //  - both passes have the same attachments and resolve targets, the previous pass stores all
+    //    of them and the render pass loads all of them,
+    //  - the render pass only uses resources that the previous pass used with the same usage, and
+    //    none of them are writable storage, so that no barrier is needed between the passes.
+    // Since the render pass can only use the attachments of the previous pass as attachments, it
+    // only ever reads their content at the same pixel.
+    std::vector<bool> ComputeRenderPassMerges(CommandIterator* commands,
+                                              const PerPassUsages& perPassUsages);
+
+}  // namespace dawn_native
+
+#endif  // DAWNNATIVE_RENDERPASSMERGING_H_
@@ -385,8 +385,10 @@ namespace dawn_native {
           mAlphaToCoverageEnabled(descriptor->alphaToCoverageEnabled),
           mVertexModule(descriptor->vertexStage.module),
           mVertexEntryPoint(descriptor->vertexStage.entryPoint),
+          mVertexConstants(GetSpecializationConstants(&descriptor->vertexStage)),
           mFragmentModule(descriptor->fragmentStage->module),
-          mFragmentEntryPoint(descriptor->fragmentStage->entryPoint) {
+          mFragmentEntryPoint(descriptor->fragmentStage->entryPoint),
+          mFragmentConstants(GetSpecializationConstants(descriptor->fragmentStage)) {
         if (descriptor->vertexState != nullptr) {
             mVertexState = *descriptor->vertexState;
         } else {
@@ -564,6 +566,8 @@ namespace dawn_native {
         HashCombine(&hash, pipeline->GetLayout());
         HashCombine(&hash, pipeline->mVertexModule.Get(), pipeline->mFragmentEntryPoint);
         HashCombine(&hash, pipeline->mFragmentModule.Get(), pipeline->mFragmentEntryPoint);
+        HashSpecializationConstants(&hash, pipeline->mVertexConstants);
+        HashSpecializationConstants(&hash, pipeline->mFragmentConstants);
 
         // Hierarchically hash the attachment state.
         // It contains the attachments set, texture formats, and sample count.
@@ -624,8 +628,10 @@ namespace dawn_native {
         // Check modules and layout
         if (a->GetLayout() != b->GetLayout() || a->mVertexModule.Get() != b->mVertexModule.Get() ||
             a->mVertexEntryPoint != b->mVertexEntryPoint ||
+            a->mVertexConstants != b->mVertexConstants ||
             a->mFragmentModule.Get() != b->mFragmentModule.Get() ||
-            a->mFragmentEntryPoint != b->mFragmentEntryPoint) {
+            a->mFragmentEntryPoint != b->mFragmentEntryPoint ||
+            a->mFragmentConstants != b->mFragmentConstants) {
             return false;
         }
 
@@ -116,8 +116,10 @@ namespace dawn_native {
         // TODO(cwallez@chromium.org): Store a crypto hash of the modules instead.
         Ref<ShaderModuleBase> mVertexModule;
         std::string mVertexEntryPoint;
+        SpecializationConstants mVertexConstants;
         Ref<ShaderModuleBase> mFragmentModule;
         std::string mFragmentEntryPoint;
+        SpecializationConstants mFragmentConstants;
     };
 
 }  // namespace dawn_native
@@ -31,6 +31,9 @@ namespace dawn_native {
         // Memory sub-divided using one or more blocks of various sizes.
         kSubAllocated,
 
+        // Memory owned by a heap object that the resource was placed in.
+        kPlaced,
+
         // Memory not allocated or freed.
         kInvalid
     };
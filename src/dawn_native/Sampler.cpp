@@ -40,13 +40,7 @@ namespace dawn_native {
                 "Min lod clamp value cannot greater than max lod clamp value");
         }
 
-        DAWN_TRY(ValidateFilterMode(descriptor->minFilter));
-        DAWN_TRY(ValidateFilterMode(descriptor->magFilter));
-        DAWN_TRY(ValidateFilterMode(descriptor->mipmapFilter));
-        DAWN_TRY(ValidateAddressMode(descriptor->addressModeU));
-        DAWN_TRY(ValidateAddressMode(descriptor->addressModeV));
-        DAWN_TRY(ValidateAddressMode(descriptor->addressModeW));
-        DAWN_TRY(ValidateCompareFunction(descriptor->compare));
+        DAWN_TRY(ValidateSamplerDescriptorScalars(descriptor));
         return {};
     }
 
@@ -23,6 +23,11 @@
 #include <spirv-tools/libspirv.hpp>
 #include <spirv_cross.hpp>
 
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <sstream>
 
 namespace dawn_native {
@@ -175,6 +180,91 @@ namespace dawn_native {
         return {};
     }
 
+    MaybeError ValidateSpecializationConstantValue(SpecializationConstantType type, double value) {
+        switch (type) {
+            case SpecializationConstantType::Bool:
+                if (value != 0.0 && value != 1.0) {
+                    return DAWN_VALIDATION_ERROR("Bool specialization constants must be 0 or 1");
+                }
+                break;
+            case SpecializationConstantType::Int32:
+                if (std::trunc(value) != value ||
+                    value < double(std::numeric_limits<int32_t>::min()) ||
+                    value > double(std::numeric_limits<int32_t>::max())) {
+                    return DAWN_VALIDATION_ERROR("Specialization constant value isn't an int32");
+                }
+                break;
+            case SpecializationConstantType::Uint32:
+                if (std::trunc(value) != value || value < 0.0 ||
+                    value > double(std::numeric_limits<uint32_t>::max())) {
+                    return DAWN_VALIDATION_ERROR("Specialization constant value isn't a uint32");
+                }
+                break;
+            case SpecializationConstantType::Float32:
+                // NaN and infinities can't be written as literals in GLSL and HLSL.
+                if (!std::isfinite(value) || std::abs(value) > double(FLT_MAX)) {
+                    return DAWN_VALIDATION_ERROR(
+                        "Specialization constant value isn't a finite f32");
+                }
+                break;
+            default:
+                UNREACHABLE();
+        }
+        return {};
+    }
+
+    uint32_t GetSpecializationConstantBits(SpecializationConstantType type, double value) {
+        switch (type) {
+            case SpecializationConstantType::Bool:
+                return value != 0.0 ? 1u : 0u;
+            case SpecializationConstantType::Int32:
+                return static_cast<uint32_t>(static_cast<int32_t>(value));
+            case SpecializationConstantType::Uint32:
+                return static_cast<uint32_t>(value);
+            case SpecializationConstantType::Float32: {
+                float floatValue = static_cast<float>(value);
+                uint32_t bits;
+                memcpy(&bits, &floatValue, sizeof(bits));
+                return bits;
+            }
+            default:
+                UNREACHABLE();
+                return 0;
+        }
+    }
+
+    std::string GetSpecializationConstantLiteral(SpecializationConstantType type, double value) {
+        std::ostringstream o;
+        o.imbue(std::locale::classic());
+        switch (type) {
+            case SpecializationConstantType::Bool:
+                o << (value != 0.0 ? "true" : "false");
+                break;
+            case SpecializationConstantType::Int32: {
+                int32_t intValue = static_cast<int32_t>(value);
+                // -2147483648 would be parsed as the negation of an out of range literal.
+                if (intValue == std::numeric_limits<int32_t>::min()) {
+                    o << "(" << intValue + 1 << " - 1)";
+                } else {
+                    o << intValue;
+                }
+                break;
+            }
+            case SpecializationConstantType::Uint32:
+                o << static_cast<uint32_t>(value) << "u";
+                break;
+            case SpecializationConstantType::Float32:
+                // 9 significant digits are enough for the float to round-trip exactly.
+                o << std::scientific;
+                o.precision(8);
+                o << static_cast<float>(value);
+                break;
+            default:
+                UNREACHABLE();
+        }
+        return o.str();
+    }
+
     // ShaderModuleBase
 
     ShaderModuleBase::ShaderModuleBase(DeviceBase* device, const ShaderModuleDescriptor* descriptor)
@@ -204,9 +294,45 @@ namespace dawn_native {
         } else {
             DAWN_TRY(ExtractSpirvInfoWithSpirvCross(compiler));
         }
+
+        // spvc doesn't reflect specialization constants but the backends always give a compiler.
+        ExtractSpecializationConstants(compiler);
         return {};
     }
 
+    void ShaderModuleBase::ExtractSpecializationConstants(const spirv_cross::Compiler& compiler) {
+        for (const spirv_cross::SpecializationConstant& constant :
+             compiler.get_specialization_constants()) {
+            const spirv_cross::SPIRType& type =
+                compiler.get_type(compiler.get_constant(constant.id).constant_type);
+            if (type.vecsize != 1 || type.columns != 1) {
+                continue;
+            }
+
+            // Other types keep their default value since they can't be set on pipeline creation.
+            switch (type.basetype) {
+                case spirv_cross::SPIRType::Boolean:
+                    mSpecializationConstantTypes[constant.constant_id] =
+                        SpecializationConstantType::Bool;
+                    break;
+                case spirv_cross::SPIRType::Int:
+                    mSpecializationConstantTypes[constant.constant_id] =
+                        SpecializationConstantType::Int32;
+                    break;
+                case spirv_cross::SPIRType::UInt:
+                    mSpecializationConstantTypes[constant.constant_id] =
+                        SpecializationConstantType::Uint32;
+                    break;
+                case spirv_cross::SPIRType::Float:
+                    mSpecializationConstantTypes[constant.constant_id] =
+                        SpecializationConstantType::Float32;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
     MaybeError ShaderModuleBase::ExtractSpirvInfoWithSpvc() {
         shaderc_spvc_execution_model execution_model;
         DAWN_TRY(CheckSpvcSuccess(mSpvcContext.GetExecutionModel(&execution_model),
@@ -233,6 +359,8 @@ namespace dawn_native {
                     return DAWN_VALIDATION_ERROR("Binding over limits in the SPIRV");
                 }
 
+                // Note that spvc doesn't report resource arrays yet, so shaders using them are
+                // only compatible with binding arrays when reflected with SPIRV-Cross.
                 BindingInfo* info = &mBindingInfo[binding.set][binding.binding];
                 *info = {};
                 info->used = true;
@@ -391,6 +519,21 @@ namespace dawn_native {
                 info->used = true;
                 info->id = resource.id;
                 info->base_type_id = resource.base_type_id;
+
+                const spirv_cross::SPIRType& type = compiler.get_type(resource.type_id);
+                if (!type.array.empty()) {
+                    if (type.array.size() > 1) {
+                        return DAWN_VALIDATION_ERROR(
+                            "Multi-dimensional arrays of resources aren't supported");
+                    }
+                    if (!type.array_size_literal[0]) {
+                        return DAWN_VALIDATION_ERROR(
+                            "Resource arrays sized by specialization constants aren't supported");
+                    }
+                    info->isArray = true;
+                    info->arrayLength = type.array[0];
+                }
+
                 switch (bindingType) {
                     case wgpu::BindingType::SampledTexture: {
                         spirv_cross::SPIRType::ImageType imageType =
@@ -512,11 +655,47 @@ namespace dawn_native {
         return mFragmentOutputFormatBaseTypes;
     }
 
+    const ShaderModuleBase::SpecializationConstantTypes&
+    ShaderModuleBase::GetSpecializationConstantTypes() const {
+        ASSERT(!IsError());
+        return mSpecializationConstantTypes;
+    }
+
+    std::string ShaderModuleBase::GetSpecializationConstantDefines(
+        const SpecializationConstants& constants) const {
+        std::ostringstream defines;
+        for (const auto& constant : constants) {
+            defines << "#define SPIRV_CROSS_CONSTANT_ID_" << constant.first << " "
+                    << GetSpecializationConstantLiteral(
+                           GetSpecializationConstantTypes().at(constant.first), constant.second)
+                    << "\n";
+        }
+        return defines.str();
+    }
+
     SingleShaderStage ShaderModuleBase::GetExecutionModel() const {
         ASSERT(!IsError());
         return mExecutionModel;
     }
 
+    const std::vector<uint32_t>& ShaderModuleBase::GetCode() const {
+        ASSERT(!IsError());
+        return mCode;
+    }
+
+    const std::vector<uint32_t>& ShaderModuleBase::GetOriginalCode() const {
+        ASSERT(!IsError());
+        return mOriginalCode.empty() ? mCode : mOriginalCode;
+    }
+
+    void ShaderModuleBase::SetOriginalCode(const uint32_t* code, uint32_t codeSize) {
+        ASSERT(!IsError());
+        if (codeSize == mCode.size() && std::equal(mCode.begin(), mCode.end(), code)) {
+            return;
+        }
+        mOriginalCode.assign(code, code + codeSize);
+    }
+
     bool ShaderModuleBase::IsCompatibleWithPipelineLayout(const PipelineLayoutBase* layout) const {
         ASSERT(!IsError());
 
@@ -568,6 +747,12 @@ namespace dawn_native {
                 return false;
             }
 
+            uint32_t layoutArrayLength = layoutInfo.arrayLengths[i];
+            if (moduleInfo.isArray != (layoutArrayLength != 0) ||
+                moduleInfo.arrayLength > layoutArrayLength) {
+                return false;
+            }
+
             if (layoutBindingType == wgpu::BindingType::SampledTexture) {
                 Format::Type layoutTextureComponentType =
                     Format::TextureComponentTypeToFormatType(layoutInfo.textureComponentTypes[i]);
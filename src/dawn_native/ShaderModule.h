@@ -28,6 +28,8 @@
 
 #include <array>
 #include <bitset>
+#include <map>
+#include <string>
 #include <vector>
 
 namespace spirv_cross {
@@ -39,6 +41,27 @@ namespace dawn_native {
     MaybeError ValidateShaderModuleDescriptor(DeviceBase* device,
                                               const ShaderModuleDescriptor* descriptor);
 
+    // The types of specialization constants that can be set on pipeline creation.
+    enum class SpecializationConstantType {
+        Bool,
+        Int32,
+        Uint32,
+        Float32,
+    };
+
+    // The values of the specialization constants set on a pipeline stage, keyed by constant ID.
+    // The map is ordered so that it can be compared and hashed for the pipeline caches.
+    using SpecializationConstants = std::map<uint32_t, double>;
+
+    MaybeError ValidateSpecializationConstantValue(SpecializationConstantType type, double value);
+
+    // The 32-bit representation of the constant, as in the data of a VkSpecializationInfo.
+    uint32_t GetSpecializationConstantBits(SpecializationConstantType type, double value);
+
+    // A literal for the constant that can be used as the SPIRV_CROSS_CONSTANT_ID_<id> macro of the
+    // GLSL and HLSL produced by SPIRV-Cross.
+    std::string GetSpecializationConstantLiteral(SpecializationConstantType type, double value);
+
     class ShaderModuleBase : public CachedObject {
       public:
         ShaderModuleBase(DeviceBase* device, const ShaderModuleDescriptor* descriptor);
@@ -57,6 +80,10 @@ namespace dawn_native {
             wgpu::TextureViewDimension textureDimension = wgpu::TextureViewDimension::Undefined;
             Format::Type textureComponentType = Format::Type::Float;
             bool multisampled = false;
+            // Binding arrays need a layout binding with an array length at least as large.
+            // Runtime-sized arrays have an arrayLength of 0.
+            bool isArray = false;
+            uint32_t arrayLength = 0;
             bool used = false;
         };
         using ModuleBindingInfo =
@@ -65,12 +92,28 @@ namespace dawn_native {
         const ModuleBindingInfo& GetBindingInfo() const;
         const std::bitset<kMaxVertexAttributes>& GetUsedVertexAttributes() const;
         SingleShaderStage GetExecutionModel() const;
+        const std::vector<uint32_t>& GetCode() const;
+        // The code the module was created from, before the OptimizeShaderModules toggle
+        // optimized it. It is only kept when pipeline manifests are recorded, modules created
+        // from it get the same optimized code.
+        const std::vector<uint32_t>& GetOriginalCode() const;
+        void SetOriginalCode(const uint32_t* code, uint32_t codeSize);
 
         // An array to record the basic types (float, int and uint) of the fragment shader outputs
         // or Format::Type::Other means the fragment shader output is unused.
         using FragmentOutputBaseTypes = std::array<Format::Type, kMaxColorAttachments>;
         const FragmentOutputBaseTypes& GetFragmentOutputBaseTypes() const;
 
+        // The types of the scalar specialization constants of the module, keyed by constant ID.
+        using SpecializationConstantTypes = std::map<uint32_t, SpecializationConstantType>;
+        const SpecializationConstantTypes& GetSpecializationConstantTypes() const;
+
+        // Defines the SPIRV_CROSS_CONSTANT_ID_<id> macro of each constant. SPIRV-Cross makes the
+        // constants of the GLSL and HLSL it produces default to these macros when they are
+        // defined, so adding the defines specializes the source without translating it again.
+        std::string GetSpecializationConstantDefines(
+            const SpecializationConstants& constants) const;
+
         bool IsCompatibleWithPipelineLayout(const PipelineLayoutBase* layout) const;
 
         // Functors necessary for the unordered_set<ShaderModuleBase*>-based cache.
@@ -95,16 +138,20 @@ namespace dawn_native {
         // whether using spvc, or directly accessing spirv-cross.
         MaybeError ExtractSpirvInfoWithSpvc();
         MaybeError ExtractSpirvInfoWithSpirvCross(const spirv_cross::Compiler& compiler);
+        void ExtractSpecializationConstants(const spirv_cross::Compiler& compiler);
 
-        // TODO(cwallez@chromium.org): The code is only stored for deduplication. We could maybe
-        // store a cryptographic hash of the code instead?
+        // TODO(cwallez@chromium.org): The code is only stored for deduplication and pipeline
+        // manifests. We could maybe store a cryptographic hash of the code instead?
         std::vector<uint32_t> mCode;
+        // Empty when it is the same as mCode.
+        std::vector<uint32_t> mOriginalCode;
 
         ModuleBindingInfo mBindingInfo;
         std::bitset<kMaxVertexAttributes> mUsedVertexAttributes;
         SingleShaderStage mExecutionModel;
 
         FragmentOutputBaseTypes mFragmentOutputFormatBaseTypes;
+        SpecializationConstantTypes mSpecializationConstantTypes;
     };
 
 }  // namespace dawn_native
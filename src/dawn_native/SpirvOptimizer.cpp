@@ -0,0 +1,140 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn_native/SpirvOptimizer.h"
+
+#include "common/HashUtils.h"
+#include "common/Log.h"
+#include "dawn_native/Device.h"
+#include "dawn_platform/DawnPlatform.h"
+#include "dawn_platform/tracing/TraceEvent.h"
+
+#include <spirv-tools/optimizer.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+namespace dawn_native {
+
+    namespace {
+
+        // Shader modules keep their own copy of the code so the cache only avoids optimizing the
+        // same code again when modules are recreated. Bound it to not keep the code of all the
+        // modules ever created.
+        constexpr size_t kMaxCachedEntries = 256;
+
+        size_t HashCode(const uint32_t* code, uint32_t codeSize) {
+            size_t hash = 0;
+            for (uint32_t i = 0; i < codeSize; ++i) {
+                HashCombine(&hash, code[i]);
+            }
+            return hash;
+        }
+
+        // Dead code elimination, inlining and constant folding. Aggressive dead code elimination
+        // isn't used because it removes unused module-scope variables: the bindings reflected
+        // from the module, and the pipeline layouts it is compatible with, would then depend on
+        // the toggle.
+        void RegisterPasses(spvtools::Optimizer* optimizer) {
+            optimizer->RegisterPass(spvtools::CreateMergeReturnPass())
+                .RegisterPass(spvtools::CreateInlineExhaustivePass())
+                .RegisterPass(spvtools::CreateEliminateDeadFunctionsPass())
+                .RegisterPass(spvtools::CreatePrivateToLocalPass())
+                .RegisterPass(spvtools::CreateLocalSingleBlockLoadStoreElimPass())
+                .RegisterPass(spvtools::CreateLocalSingleStoreElimPass())
+                .RegisterPass(spvtools::CreateSSARewritePass())
+                .RegisterPass(spvtools::CreateCCPPass())
+                .RegisterPass(spvtools::CreateDeadBranchElimPass())
+                .RegisterPass(spvtools::CreateBlockMergePass())
+                .RegisterPass(spvtools::CreateSimplificationPass())
+                .RegisterPass(spvtools::CreateRedundancyEliminationPass())
+                .RegisterPass(spvtools::CreateCFGCleanupPass());
+        }
+
+    }  // anonymous namespace
+
+    SpirvOptimizer::SpirvOptimizer(DeviceBase* device) : mDevice(device) {
+    }
+
+    const std::vector<uint32_t>* SpirvOptimizer::Optimize(const uint32_t* code, uint32_t codeSize) {
+        size_t hash = HashCode(code, codeSize);
+        const std::vector<uint32_t>* cachedOutput = Find(hash, code, codeSize);
+        if (cachedOutput != nullptr) {
+            return cachedOutput;
+        }
+
+        TRACE_EVENT0(mDevice->GetPlatform(), General, "SpirvOptimizer::Optimize");
+
+        Entry entry;
+        entry.hash = hash;
+        entry.input.assign(code, code + codeSize);
+
+        spvtools::Optimizer optimizer(SPV_ENV_VULKAN_1_1);
+        RegisterPasses(&optimizer);
+
+        // The module was validated when it was created so a failure is a limitation of
+        // spirv-opt. Use the code unoptimized then, and cache that to not try again.
+        spvtools::OptimizerOptions options;
+        options.set_run_validator(false);
+        if (!optimizer.Run(code, codeSize, &entry.output, options)) {
+            dawn::WarningLog() << "spirv-opt failed, the shader module is used unoptimized";
+            entry.output = entry.input;
+        }
+
+        // Sizes in bytes of the code before and after optimization.
+        TRACE_COUNTER1(mDevice->GetPlatform(), General, "SpirvOptimizer::InputSize",
+                       entry.input.size() * sizeof(uint32_t));
+        TRACE_COUNTER1(mDevice->GetPlatform(), General, "SpirvOptimizer::OutputSize",
+                       entry.output.size() * sizeof(uint32_t));
+
+        return Insert(std::move(entry));
+    }
+
+    const std::vector<uint32_t>* SpirvOptimizer::Find(size_t hash,
+                                                      const uint32_t* code,
+                                                      uint32_t codeSize) {
+        auto range = mEntriesByHash.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            EntryList::iterator entry = it->second;
+            const std::vector<uint32_t>& input = entry->input;
+            if (input.size() == codeSize && std::equal(input.begin(), input.end(), code)) {
+                // Move the entry to the front, splicing doesn't invalidate the iterators.
+                mEntries.splice(mEntries.begin(), mEntries, entry);
+                return &entry->output;
+            }
+        }
+        return nullptr;
+    }
+
+    const std::vector<uint32_t>* SpirvOptimizer::Insert(Entry entry) {
+        size_t hash = entry.hash;
+        mEntries.push_front(std::move(entry));
+        mEntriesByHash.emplace(hash, mEntries.begin());
+
+        if (mEntries.size() > kMaxCachedEntries) {
+            EntryList::iterator last = std::prev(mEntries.end());
+            auto range = mEntriesByHash.equal_range(last->hash);
+            for (auto it = range.first; it != range.second; ++it) {
+                if (it->second == last) {
+                    mEntriesByHash.erase(it);
+                    break;
+                }
+            }
+            mEntries.erase(last);
+        }
+
+        return &mEntries.front().output;
+    }
+
+}  // namespace dawn_native
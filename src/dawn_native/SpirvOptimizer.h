@@ -0,0 +1,61 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_SPIRVOPTIMIZER_H_
+#define DAWNNATIVE_SPIRVOPTIMIZER_H_
+
+#include "dawn_native/Forward.h"
+
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace dawn_native {
+
+    // SpirvOptimizer runs spirv-opt on the SPIR-V of shader modules when the
+    // OptimizeShaderModules toggle is enabled, so that backends translate and drivers compile
+    // smaller code. The results for the most recently used inputs are cached, so recreating a
+    // module with the same code doesn't run the optimizer again.
+    class SpirvOptimizer {
+      public:
+        SpirvOptimizer(DeviceBase* device);
+        ~SpirvOptimizer() = default;
+
+        // The code must already be valid SPIR-V. If spirv-opt fails, the code is returned
+        // unoptimized. The returned code stays valid until the next call to Optimize.
+        const std::vector<uint32_t>* Optimize(const uint32_t* code, uint32_t codeSize);
+
+      private:
+        struct Entry {
+            size_t hash;
+            std::vector<uint32_t> input;
+            std::vector<uint32_t> output;
+        };
+        using EntryList = std::list<Entry>;
+
+        const std::vector<uint32_t>* Find(size_t hash, const uint32_t* code, uint32_t codeSize);
+        const std::vector<uint32_t>* Insert(Entry entry);
+
+        DeviceBase* mDevice;
+
+        // Most recently used first, the last entries are evicted when there are too many.
+        EntryList mEntries;
+        // Keyed by the hash of the input, collisions are resolved by comparing the full input.
+        std::unordered_multimap<size_t, EntryList::iterator> mEntriesByHash;
+    };
+
+}  // namespace dawn_native
+
+#endif  // DAWNNATIVE_SPIRVOPTIMIZER_H_
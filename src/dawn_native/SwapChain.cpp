@@ -17,11 +17,22 @@
 #include "dawn_native/Device.h"
 #include "dawn_native/Texture.h"
 #include "dawn_native/ValidationUtils_autogen.h"
+#include "dawn_platform/DawnPlatform.h"
+#include "dawn_platform/tracing/TraceEvent.h"
+
+#include <chrono>
 
 namespace dawn_native {
 
     namespace {
 
+        double CurrentTime() {
+            using Seconds = std::chrono::duration<double>;
+            return std::chrono::duration_cast<Seconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+        }
+
         class ErrorSwapChain : public SwapChainBase {
           public:
             ErrorSwapChain(DeviceBase* device) : SwapChainBase(device, ObjectBase::kError) {
@@ -113,6 +124,11 @@ namespace dawn_native {
             return mCurrentTextureView.Get();
         }
 
+        if (GetDevice()->ConsumedError(WaitForFrameLatency())) {
+            return TextureViewBase::MakeError(GetDevice());
+        }
+        mCurrentAcquireTime = CurrentTime();
+
         // Create the backing texture and the view.
         TextureDescriptor descriptor;
         descriptor.dimension = wgpu::TextureDimension::e2D;
@@ -134,6 +150,7 @@ namespace dawn_native {
     }
 
     void SwapChainBase::Present() {
+        TRACE_EVENT0(GetDevice()->GetPlatform(), General, "SwapChain::Present");
         if (GetDevice()->ConsumedError(ValidatePresent())) {
             return;
         }
@@ -147,6 +164,72 @@ namespace dawn_native {
 
         mCurrentTexture = nullptr;
         mCurrentTextureView = nullptr;
+
+        FrameInFlight frame;
+        frame.serial = GetDevice()->GetLastSubmittedCommandSerial();
+        frame.statistics.frameIndex = mNextFrameIndex++;
+        frame.statistics.acquireTime = mCurrentAcquireTime;
+        frame.statistics.presentTime = CurrentTime();
+        mFramesInFlight.push_back(frame);
+
+        UpdateCompletedFrames();
+    }
+
+    void SwapChainBase::SetMaxFrameLatency(uint32_t maxFrameLatency) {
+        if (GetDevice()->ConsumedError(GetDevice()->ValidateObject(this))) {
+            return;
+        }
+        mMaxFrameLatency = maxFrameLatency;
+    }
+
+    bool SwapChainBase::GetLastFrameStatistics(SwapChainFrameStatistics* statistics) {
+        if (GetDevice()->ConsumedError(GetDevice()->ValidateObject(this))) {
+            return false;
+        }
+
+        UpdateCompletedFrames();
+        if (!mHasCompletedFrame) {
+            return false;
+        }
+        *statistics = mLastCompletedFrame;
+        return true;
+    }
+
+    void SwapChainBase::UpdateCompletedFrames() {
+        Serial completedSerial = GetDevice()->GetCompletedCommandSerial();
+        if (mFramesInFlight.empty() || mFramesInFlight.front().serial > completedSerial) {
+            return;
+        }
+
+        // The completion time is when we notice it, so frames completing together share it.
+        double now = CurrentTime();
+        while (!mFramesInFlight.empty() && mFramesInFlight.front().serial <= completedSerial) {
+            mLastCompletedFrame = mFramesInFlight.front().statistics;
+            mLastCompletedFrame.gpuCompleteTime = now;
+            mHasCompletedFrame = true;
+            mFramesInFlight.pop_front();
+        }
+    }
+
+    MaybeError SwapChainBase::WaitForFrameLatency() {
+        UpdateCompletedFrames();
+        if (mMaxFrameLatency == 0 || mFramesInFlight.size() < mMaxFrameLatency) {
+            return {};
+        }
+
+        TRACE_EVENT0(GetDevice()->GetPlatform(), General, "SwapChain::WaitForFrameLatency");
+
+        // Wait for the frame that leaves mMaxFrameLatency - 1 frames in flight after it, so that
+        // the frame being acquired is the mMaxFrameLatency-th one.
+        // The frame's serial is already submitted so blocking on it without a timeout terminates.
+        Serial waitSerial = mFramesInFlight[mFramesInFlight.size() - mMaxFrameLatency].serial;
+        DAWN_TRY(GetDevice()->ValidateIsAlive());
+        bool completed = false;
+        DAWN_TRY_ASSIGN(completed, GetDevice()->WaitForSerialImpl(waitSerial, UINT64_MAX));
+        ASSERT(completed);
+
+        UpdateCompletedFrames();
+        return {};
     }
 
     const DawnSwapChainImplementation& SwapChainBase::GetImplementation() {
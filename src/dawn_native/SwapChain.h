@@ -15,13 +15,17 @@
 #ifndef DAWNNATIVE_SWAPCHAIN_H_
 #define DAWNNATIVE_SWAPCHAIN_H_
 
+#include "common/Serial.h"
 #include "dawn_native/Error.h"
 #include "dawn_native/Forward.h"
 #include "dawn_native/ObjectBase.h"
 
 #include "dawn/dawn_wsi.h"
+#include "dawn_native/DawnNative.h"
 #include "dawn_native/dawn_platform.h"
 
+#include <deque>
+
 namespace dawn_native {
 
     MaybeError ValidateSwapChainDescriptor(const DeviceBase* device,
@@ -42,6 +46,10 @@ namespace dawn_native {
         TextureViewBase* GetCurrentTextureView();
         void Present();
 
+        // dawn_native API
+        void SetMaxFrameLatency(uint32_t maxFrameLatency);
+        bool GetLastFrameStatistics(SwapChainFrameStatistics* statistics);
+
       protected:
         SwapChainBase(DeviceBase* device, ObjectBase::ErrorTag tag);
 
@@ -57,6 +65,11 @@ namespace dawn_native {
         MaybeError ValidateGetCurrentTextureView() const;
         MaybeError ValidatePresent() const;
 
+        // Records the completion time of the frames whose GPU work is done.
+        void UpdateCompletedFrames();
+        // Blocks until fewer than mMaxFrameLatency frames are in flight.
+        MaybeError WaitForFrameLatency();
+
         DawnSwapChainImplementation mImplementation = {};
         wgpu::TextureFormat mFormat = {};
         wgpu::TextureUsage mAllowedUsage;
@@ -64,6 +77,17 @@ namespace dawn_native {
         uint32_t mHeight = 0;
         Ref<TextureBase> mCurrentTexture;
         Ref<TextureViewBase> mCurrentTextureView;
+
+        struct FrameInFlight {
+            Serial serial;
+            SwapChainFrameStatistics statistics;
+        };
+        uint32_t mMaxFrameLatency = 0;
+        uint64_t mNextFrameIndex = 0;
+        double mCurrentAcquireTime = 0;
+        std::deque<FrameInFlight> mFramesInFlight;
+        bool mHasCompletedFrame = false;
+        SwapChainFrameStatistics mLastCompletedFrame;
     };
 
 }  // namespace dawn_native
@@ -20,6 +20,7 @@
 #include "common/Constants.h"
 #include "common/Math.h"
 #include "dawn_native/Device.h"
+#include "dawn_native/Heap.h"
 #include "dawn_native/ValidationUtils_autogen.h"
 
 namespace dawn_native {
@@ -173,8 +174,6 @@ namespace dawn_native {
         }
 
         MaybeError ValidateTextureUsage(const TextureDescriptor* descriptor, const Format* format) {
-            DAWN_TRY(dawn_native::ValidateTextureUsage(descriptor->usage));
-
             constexpr wgpu::TextureUsage kValidCompressedUsages = wgpu::TextureUsage::Sampled |
                                                                   wgpu::TextureUsage::CopySrc |
                                                                   wgpu::TextureUsage::CopyDst;
@@ -194,6 +193,16 @@ namespace dawn_native {
                 return DAWN_VALIDATION_ERROR("Format cannot be used in storage textures");
             }
 
+            // The content of transient attachments never leaves the render pass so they can't be
+            // used for anything else, which allows backends to not give them memory at all.
+            constexpr wgpu::TextureUsage kTransientAttachmentUsage =
+                wgpu::TextureUsage::OutputAttachment | wgpu::TextureUsage::TransientAttachment;
+            if ((descriptor->usage & wgpu::TextureUsage::TransientAttachment) &&
+                descriptor->usage != kTransientAttachmentUsage) {
+                return DAWN_VALIDATION_ERROR(
+                    "TransientAttachment can only be combined with OutputAttachment");
+            }
+
             return {};
         }
 
@@ -204,15 +213,18 @@ namespace dawn_native {
         if (descriptor == nullptr) {
             return DAWN_VALIDATION_ERROR("Texture descriptor is nullptr");
         }
-        if (descriptor->nextInChain != nullptr) {
-            return DAWN_VALIDATION_ERROR("nextInChain must be nullptr");
+        DAWN_TRY(ValidatePlacedResourceChain(device, descriptor->nextInChain));
+        if (descriptor->nextInChain != nullptr &&
+            (descriptor->usage & wgpu::TextureUsage::TransientAttachment)) {
+            return DAWN_VALIDATION_ERROR("Transient attachments cannot be placed in a heap");
         }
 
+        DAWN_TRY(ValidateTextureDescriptorScalars(descriptor));
+
         const Format* format;
         DAWN_TRY_ASSIGN(format, device->GetInternalFormat(descriptor->format));
 
         DAWN_TRY(ValidateTextureUsage(descriptor, format));
-        DAWN_TRY(ValidateTextureDimension(descriptor->dimension));
         DAWN_TRY(ValidateSampleCount(descriptor, format));
 
         // TODO(jiawei.shao@intel.com): check stuff based on the dimension
@@ -244,15 +256,12 @@ namespace dawn_native {
             return DAWN_VALIDATION_ERROR("Destroyed texture used to create texture view");
         }
 
-        DAWN_TRY(ValidateTextureViewDimension(descriptor->dimension));
+        DAWN_TRY(ValidateTextureViewDescriptorScalars(descriptor));
         if (descriptor->dimension == wgpu::TextureViewDimension::e1D ||
             descriptor->dimension == wgpu::TextureViewDimension::e3D) {
             return DAWN_VALIDATION_ERROR("Texture view dimension must be 2D compatible.");
         }
 
-        DAWN_TRY(ValidateTextureFormat(descriptor->format));
-
-        DAWN_TRY(ValidateTextureAspect(descriptor->aspect));
         if (descriptor->aspect != wgpu::TextureAspect::All) {
             return DAWN_VALIDATION_ERROR("Texture aspect must be 'all'");
         }
@@ -58,6 +58,11 @@ namespace dawn_native {
         using BackendType = typename BackendTraits::DeviceType;
     };
 
+    template <typename BackendTraits>
+    struct ToBackendTraits<HeapBase, BackendTraits> {
+        using BackendType = typename BackendTraits::HeapType;
+    };
+
     template <typename BackendTraits>
     struct ToBackendTraits<PipelineLayoutBase, BackendTraits> {
         using BackendType = typename BackendTraits::PipelineLayoutType;
@@ -102,6 +102,51 @@ namespace dawn_native {
               "backend will use D32S8 (toggle to on) but setting the toggle to off will make it"
               "use the D24S8 format when possible.",
               "https://crbug.com/dawn/286"}},
+            {Toggle::VulkanCacheDescriptorSets,
+             {"vulkan_cache_descriptor_sets",
+              "Share a single VkDescriptorSet between all live bind groups that have the same "
+              "layout and resources instead of allocating and writing a new descriptor set for "
+              "every bind group. This speeds up the creation of transient bind groups that point "
+              "at the same resources.",
+              "https://www.khronos.org/registry/vulkan/specs/1.2-extensions/man/html/"
+              "vkUpdateDescriptorSets.html"}},
+            {Toggle::VulkanUseMailboxPresentMode,
+             {"vulkan_use_mailbox_present_mode",
+              "Present with VK_PRESENT_MODE_MAILBOX_KHR when the surface supports it, falling back "
+              "to FIFO otherwise. Presenting then never blocks and the most recent frame is shown "
+              "at the next vblank without tearing, which reduces latency compared to FIFO.",
+              "https://www.khronos.org/registry/vulkan/specs/1.2-extensions/man/html/"
+              "VkPresentModeKHR.html"}},
+            {Toggle::MergeRenderPasses,
+             {"merge_render_passes",
+              "Record consecutive render passes that use the same attachments, and only load what "
+              "the previous pass stored, as a single backend render pass. This keeps the "
+              "attachments on-chip between the passes on tile-based GPUs. Enabled by default on "
+              "Vulkan for ARM, Imagination and Qualcomm GPUs.",
+              "https://www.khronos.org/registry/vulkan/specs/1.2-extensions/man/html/"
+              "VkRenderPass.html"}},
+            {Toggle::OptimizeShaderModules,
+             {"optimize_shader_modules",
+              "Run spirv-opt on the SPIR-V of shader modules after validation to eliminate dead "
+              "code, inline functions and fold constants. Backends then translate and drivers "
+              "compile smaller shaders. The optimized code of recently created modules is "
+              "cached. If spirv-opt fails, the module is used unoptimized.",
+              "https://github.com/KhronosGroup/SPIRV-Tools"}},
+            {Toggle::RecordPipelineManifest,
+             {"record_pipeline_manifest",
+              "Record the descriptors of the render and compute pipelines the device creates in a "
+              "manifest that the application can save, and replay on later runs to create the "
+              "pipelines ahead of their first use.",
+              "https://bugs.chromium.org/p/dawn/issues/list"}},
+            {Toggle::VulkanUsePushDescriptors,
+             {"vulkan_use_push_descriptors",
+              "Use VK_KHR_push_descriptor to write the descriptors of one bind group per pipeline "
+              "layout directly in the command buffer when it is applied, preferably one with "
+              "dynamic offsets. Bind groups created for a single draw don't allocate and write a "
+              "descriptor set, and a new dynamic offset for each draw only pushes that set "
+              "again. Only has an effect when the device supports the extension.",
+              "https://www.khronos.org/registry/vulkan/specs/1.2-extensions/man/html/"
+              "vkCmdPushDescriptorSetKHR.html"}},
         }};
 
     }  // anonymous namespace
@@ -36,6 +36,12 @@ namespace dawn_native {
         UseSpvc,
         UseSpvcIRGen,
         VulkanUseD32S8,
+        VulkanCacheDescriptorSets,
+        VulkanUseMailboxPresentMode,
+        MergeRenderPasses,
+        OptimizeShaderModules,
+        RecordPipelineManifest,
+        VulkanUsePushDescriptors,
 
         EnumCount,
         InvalidEnum = EnumCount,
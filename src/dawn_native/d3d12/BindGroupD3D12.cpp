@@ -27,6 +27,13 @@ namespace dawn_native { namespace d3d12 {
         : BindGroupBase(device, descriptor) {
     }
 
+    BindGroup::BindGroup(Device* device,
+                         BindGroupBase* parent,
+                         uint32_t bindingCount,
+                         const BindGroupBinding* bindings)
+        : BindGroupBase(device, parent, bindingCount, bindings) {
+    }
+
     void BindGroup::AllocateDescriptors(const DescriptorHeapHandle& cbvUavSrvHeapStart,
                                         uint32_t* cbvUavSrvHeapOffset,
                                         const DescriptorHeapHandle& samplerHeapStart,
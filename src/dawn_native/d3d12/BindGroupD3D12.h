@@ -28,6 +28,10 @@ namespace dawn_native { namespace d3d12 {
     class BindGroup : public BindGroupBase {
       public:
         BindGroup(Device* device, const BindGroupDescriptor* descriptor);
+        BindGroup(Device* device,
+                  BindGroupBase* parent,
+                  uint32_t bindingCount,
+                  const BindGroupBinding* bindings);
 
         void AllocateDescriptors(const DescriptorHeapHandle& cbvSrvUavHeapStart,
                                  uint32_t* cbvUavSrvHeapOffset,
@@ -496,7 +496,7 @@ namespace dawn_native { namespace d3d12 {
                     switch (type) {
                         case Command::SetBindGroup: {
                             SetBindGroupCmd* cmd = commands->NextCommand<SetBindGroupCmd>();
-                            BindGroup* group = ToBackend(cmd->group.Get());
+                            BindGroup* group = ToBackend(cmd->group);
                             if (cmd->dynamicOffsetCount) {
                                 commands->NextData<uint32_t>(cmd->dynamicOffsetCount);
                             }
@@ -820,6 +820,11 @@ namespace dawn_native { namespace d3d12 {
                     }
                 } break;
 
+                case Command::GenerateMipmaps: {
+                    // Mipmap generation is rejected when encoding on D3D12.
+                    UNREACHABLE();
+                } break;
+
                 default: { UNREACHABLE(); } break;
             }
         }
@@ -862,7 +867,7 @@ namespace dawn_native { namespace d3d12 {
 
                 case Command::SetComputePipeline: {
                     SetComputePipelineCmd* cmd = mCommands.NextCommand<SetComputePipelineCmd>();
-                    ComputePipeline* pipeline = ToBackend(cmd->pipeline).Get();
+                    ComputePipeline* pipeline = ToBackend(cmd->pipeline);
                     PipelineLayout* layout = ToBackend(pipeline->GetLayout());
 
                     commandList->SetComputeRootSignature(layout->GetRootSignature().Get());
@@ -875,7 +880,7 @@ namespace dawn_native { namespace d3d12 {
 
                 case Command::SetBindGroup: {
                     SetBindGroupCmd* cmd = mCommands.NextCommand<SetBindGroupCmd>();
-                    BindGroup* group = ToBackend(cmd->group.Get());
+                    BindGroup* group = ToBackend(cmd->group);
                     uint32_t* dynamicOffsets = nullptr;
 
                     if (cmd->dynamicOffsetCount > 0) {
@@ -1181,7 +1186,7 @@ namespace dawn_native { namespace d3d12 {
 
                 case Command::SetRenderPipeline: {
                     SetRenderPipelineCmd* cmd = iter->NextCommand<SetRenderPipelineCmd>();
-                    RenderPipeline* pipeline = ToBackend(cmd->pipeline).Get();
+                    RenderPipeline* pipeline = ToBackend(cmd->pipeline);
                     PipelineLayout* layout = ToBackend(pipeline->GetLayout());
 
                     commandList->SetGraphicsRootSignature(layout->GetRootSignature().Get());
@@ -1197,7 +1202,7 @@ namespace dawn_native { namespace d3d12 {
 
                 case Command::SetBindGroup: {
                     SetBindGroupCmd* cmd = iter->NextCommand<SetBindGroupCmd>();
-                    BindGroup* group = ToBackend(cmd->group.Get());
+                    BindGroup* group = ToBackend(cmd->group);
                     uint32_t* dynamicOffsets = nullptr;
 
                     if (cmd->dynamicOffsetCount > 0) {
@@ -1211,13 +1216,13 @@ namespace dawn_native { namespace d3d12 {
                 case Command::SetIndexBuffer: {
                     SetIndexBufferCmd* cmd = iter->NextCommand<SetIndexBufferCmd>();
 
-                    indexBufferTracker.OnSetIndexBuffer(ToBackend(cmd->buffer.Get()), cmd->offset);
+                    indexBufferTracker.OnSetIndexBuffer(ToBackend(cmd->buffer), cmd->offset);
                 } break;
 
                 case Command::SetVertexBuffer: {
                     SetVertexBufferCmd* cmd = iter->NextCommand<SetVertexBufferCmd>();
 
-                    vertexBufferTracker.OnSetVertexBuffer(cmd->slot, ToBackend(cmd->buffer.Get()),
+                    vertexBufferTracker.OnSetVertexBuffer(cmd->slot, ToBackend(cmd->buffer),
                                                           cmd->offset);
                 } break;
 
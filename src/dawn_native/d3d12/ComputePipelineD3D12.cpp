@@ -43,7 +43,9 @@ namespace dawn_native { namespace d3d12 {
 
         ShaderModule* module = ToBackend(descriptor->computeStage.module);
         std::string hlslSource;
-        DAWN_TRY_ASSIGN(hlslSource, module->GetHLSLSource(ToBackend(GetLayout())));
+        DAWN_TRY_ASSIGN(hlslSource, module->GetHLSLSource(
+                                        ToBackend(GetLayout()),
+                                        GetSpecializationConstants(&descriptor->computeStage)));
 
         ComPtr<ID3DBlob> compiledShader;
         ComPtr<ID3DBlob> errors;
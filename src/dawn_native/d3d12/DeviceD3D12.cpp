@@ -18,6 +18,7 @@
 #include "dawn_native/BackendConnection.h"
 #include "dawn_native/DynamicUploader.h"
 #include "dawn_native/ErrorData.h"
+#include "dawn_native/Heap.h"
 #include "dawn_native/d3d12/AdapterD3D12.h"
 #include "dawn_native/d3d12/BackendD3D12.h"
 #include "dawn_native/d3d12/BindGroupD3D12.h"
@@ -39,6 +40,8 @@
 #include "dawn_native/d3d12/SwapChainD3D12.h"
 #include "dawn_native/d3d12/TextureD3D12.h"
 
+#include <algorithm>
+
 namespace dawn_native { namespace d3d12 {
 
     Device::Device(Adapter* adapter, const DeviceDescriptor* descriptor)
@@ -194,13 +197,34 @@ namespace dawn_native { namespace d3d12 {
     }
 
     MaybeError Device::WaitForSerial(uint64_t serial) {
+        bool completed = false;
+        DAWN_TRY_ASSIGN(completed, WaitForSerialImpl(serial, UINT64_MAX));
+        ASSERT(completed);
+        return {};
+    }
+
+    ResultOrError<bool> Device::WaitForSerialImpl(Serial serial, uint64_t timeoutNs) {
         mCompletedSerial = mFence->GetCompletedValue();
-        if (mCompletedSerial < serial) {
-            DAWN_TRY(CheckHRESULT(mFence->SetEventOnCompletion(serial, mFenceEvent),
-                                  "D3D12 set event on completion"));
-            WaitForSingleObject(mFenceEvent, INFINITE);
+        if (mCompletedSerial >= serial) {
+            return true;
         }
-        return {};
+
+        // The event is still signaled if a previous wait timed out, reset it so that it is only
+        // signaled for this serial.
+        ResetEvent(mFenceEvent);
+        DAWN_TRY(CheckHRESULT(mFence->SetEventOnCompletion(serial, mFenceEvent),
+                              "D3D12 set event on completion"));
+
+        // WaitForSingleObject takes milliseconds, round up so that the wait isn't shorter.
+        DWORD timeoutMs = INFINITE;
+        if (timeoutNs != UINT64_MAX) {
+            uint64_t roundedUpMs = timeoutNs / 1000000 + (timeoutNs % 1000000 != 0 ? 1 : 0);
+            timeoutMs = static_cast<DWORD>(std::min(roundedUpMs, uint64_t(INFINITE - 1)));
+        }
+        WaitForSingleObject(mFenceEvent, timeoutMs);
+
+        mCompletedSerial = mFence->GetCompletedValue();
+        return mCompletedSerial >= serial;
     }
 
     void Device::ReferenceUntilUnused(ComPtr<IUnknown> object) {
@@ -215,6 +239,12 @@ namespace dawn_native { namespace d3d12 {
         const BindGroupDescriptor* descriptor) {
         return new BindGroup(this, descriptor);
     }
+    ResultOrError<BindGroupBase*> Device::CreateDerivedBindGroupImpl(
+        BindGroupBase* parent,
+        uint32_t bindingCount,
+        const BindGroupBinding* bindings) {
+        return new BindGroup(this, parent, bindingCount, bindings);
+    }
     ResultOrError<BindGroupLayoutBase*> Device::CreateBindGroupLayoutImpl(
         const BindGroupLayoutDescriptor* descriptor) {
         return new BindGroupLayout(this, descriptor);
@@ -232,6 +262,10 @@ namespace dawn_native { namespace d3d12 {
         const ComputePipelineDescriptor* descriptor) {
         return ComputePipeline::Create(this, descriptor);
     }
+    ResultOrError<HeapBase*> Device::CreateHeapImpl(const HeapDescriptor* descriptor) {
+        // Resources are never placed in heaps on this backend, each gets its own memory.
+        return new HeapBase(this, descriptor);
+    }
     ResultOrError<PipelineLayoutBase*> Device::CreatePipelineLayoutImpl(
         const PipelineLayoutDescriptor* descriptor) {
         return PipelineLayout::Create(this, descriptor);
@@ -120,11 +120,16 @@ namespace dawn_native { namespace d3d12 {
         }
         ResultOrError<BindGroupBase*> CreateBindGroupImpl(
             const BindGroupDescriptor* descriptor) override;
+        ResultOrError<BindGroupBase*> CreateDerivedBindGroupImpl(
+            BindGroupBase* parent,
+            uint32_t bindingCount,
+            const BindGroupBinding* bindings) override;
         ResultOrError<BindGroupLayoutBase*> CreateBindGroupLayoutImpl(
             const BindGroupLayoutDescriptor* descriptor) override;
         ResultOrError<BufferBase*> CreateBufferImpl(const BufferDescriptor* descriptor) override;
         ResultOrError<ComputePipelineBase*> CreateComputePipelineImpl(
             const ComputePipelineDescriptor* descriptor) override;
+        ResultOrError<HeapBase*> CreateHeapImpl(const HeapDescriptor* descriptor) override;
         ResultOrError<PipelineLayoutBase*> CreatePipelineLayoutImpl(
             const PipelineLayoutDescriptor* descriptor) override;
         ResultOrError<QueueBase*> CreateQueueImpl() override;
@@ -142,6 +147,7 @@ namespace dawn_native { namespace d3d12 {
 
         void Destroy() override;
         MaybeError WaitForIdleForDestruction() override;
+        ResultOrError<bool> WaitForSerialImpl(Serial serial, uint64_t timeoutNs) override;
 
         Serial mCompletedSerial = 0;
         Serial mLastSubmittedSerial = 0;
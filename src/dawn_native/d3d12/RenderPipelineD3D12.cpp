@@ -317,18 +317,21 @@ namespace dawn_native { namespace d3d12 {
         for (auto stage : IterateStages(renderStages)) {
             ShaderModule* module = nullptr;
             const char* entryPoint = nullptr;
+            SpecializationConstants constants;
             const char* compileTarget = nullptr;
             D3D12_SHADER_BYTECODE* shader = nullptr;
             switch (stage) {
                 case SingleShaderStage::Vertex:
                     module = ToBackend(descriptor->vertexStage.module);
                     entryPoint = descriptor->vertexStage.entryPoint;
+                    constants = GetSpecializationConstants(&descriptor->vertexStage);
                     shader = &descriptorD3D12.VS;
                     compileTarget = "vs_5_1";
                     break;
                 case SingleShaderStage::Fragment:
                     module = ToBackend(descriptor->fragmentStage->module);
                     entryPoint = descriptor->fragmentStage->entryPoint;
+                    constants = GetSpecializationConstants(descriptor->fragmentStage);
                     shader = &descriptorD3D12.PS;
                     compileTarget = "ps_5_1";
                     break;
@@ -338,7 +341,7 @@ namespace dawn_native { namespace d3d12 {
             }
 
             std::string hlslSource;
-            DAWN_TRY_ASSIGN(hlslSource, module->GetHLSLSource(ToBackend(GetLayout())));
+            DAWN_TRY_ASSIGN(hlslSource, module->GetHLSLSource(ToBackend(GetLayout()), constants));
 
             const PlatformFunctions* functions = device->GetFunctions();
             if (FAILED(functions->d3dCompile(hlslSource.c_str(), hlslSource.length(), nullptr,
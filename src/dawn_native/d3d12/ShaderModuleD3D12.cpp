@@ -66,7 +66,9 @@ namespace dawn_native { namespace d3d12 {
         return {};
     }
 
-    ResultOrError<std::string> ShaderModule::GetHLSLSource(PipelineLayout* layout) {
+    ResultOrError<std::string> ShaderModule::GetHLSLSource(
+        PipelineLayout* layout,
+        const SpecializationConstants& constants) {
         std::unique_ptr<spirv_cross::CompilerHLSL> compiler_impl;
         spirv_cross::CompilerHLSL* compiler;
         if (!GetDevice()->IsToggleEnabled(Toggle::UseSpvc)) {
@@ -112,16 +114,18 @@ namespace dawn_native { namespace d3d12 {
                 }
             }
         }
+        std::string hlslSource;
         if (GetDevice()->IsToggleEnabled(Toggle::UseSpvc)) {
             shaderc_spvc::CompilationResult result;
             DAWN_TRY(CheckSpvcSuccess(mSpvcContext.CompileShader(&result),
                                       "Unable to generate HLSL shader w/ spvc"));
-            std::string result_string =
-                result.GetStringOutput();  // Stripping const for ResultOrError
-            return result_string;
+            hlslSource = result.GetStringOutput();
         } else {
-            return compiler->compile();
+            hlslSource = compiler->compile();
         }
+
+        // HLSL has no specialization constants, they are set with defines.
+        return GetSpecializationConstantDefines(constants) + hlslSource;
     }
 
 }}  // namespace dawn_native::d3d12
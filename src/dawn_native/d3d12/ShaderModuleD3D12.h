@@ -15,6 +15,7 @@
 #ifndef DAWNNATIVE_D3D12_SHADERMODULED3D12_H_
 #define DAWNNATIVE_D3D12_SHADERMODULED3D12_H_
 
+#include "dawn_native/Pipeline.h"
 #include "dawn_native/ShaderModule.h"
 
 namespace dawn_native { namespace d3d12 {
@@ -27,7 +28,8 @@ namespace dawn_native { namespace d3d12 {
         static ResultOrError<ShaderModule*> Create(Device* device,
                                                    const ShaderModuleDescriptor* descriptor);
 
-        ResultOrError<std::string> GetHLSLSource(PipelineLayout* layout);
+        ResultOrError<std::string> GetHLSLSource(PipelineLayout* layout,
+                                                 const SpecializationConstants& constants);
 
       private:
         ShaderModule(Device* device, const ShaderModuleDescriptor* descriptor);
@@ -809,6 +809,32 @@ namespace dawn_native { namespace metal {
                         destinationOrigin:MakeMTLOrigin(copy->destination.origin)];
                 } break;
 
+                case Command::GenerateMipmaps: {
+                    GenerateMipmapsCmd* cmd = mCommands.NextCommand<GenerateMipmapsCmd>();
+                    Texture* texture = ToBackend(cmd->texture.Get());
+                    uint32_t layerCount = texture->GetArrayLayers();
+
+                    texture->EnsureSubresourceContentInitialized(cmd->baseLevel, 1, 0, layerCount);
+                    if (cmd->levelCount == 1) {
+                        break;
+                    }
+                    texture->SetIsSubresourceContentInitialized(true, cmd->baseLevel + 1,
+                                                                cmd->levelCount - 1, 0, layerCount);
+
+                    // generateMipmapsForTexture fills all the levels of a texture from its first
+                    // one so it is given a view of only the requested levels. The command buffer
+                    // keeps a reference to the view.
+                    id<MTLTexture> mtlTexture = texture->GetMTLTexture();
+                    id<MTLTexture> levelsView =
+                        [mtlTexture newTextureViewWithPixelFormat:[mtlTexture pixelFormat]
+                                                      textureType:[mtlTexture textureType]
+                                                           levels:NSMakeRange(cmd->baseLevel,
+                                                                              cmd->levelCount)
+                                                           slices:NSMakeRange(0, layerCount)];
+                    [commandContext->EnsureBlit() generateMipmapsForTexture:levelsView];
+                    [levelsView release];
+                } break;
+
                 default: { UNREACHABLE(); } break;
             }
         }
@@ -858,7 +884,7 @@ namespace dawn_native { namespace metal {
 
                 case Command::SetComputePipeline: {
                     SetComputePipelineCmd* cmd = mCommands.NextCommand<SetComputePipelineCmd>();
-                    lastPipeline = ToBackend(cmd->pipeline).Get();
+                    lastPipeline = ToBackend(cmd->pipeline);
 
                     bindGroups.OnSetPipeline(lastPipeline);
 
@@ -872,7 +898,7 @@ namespace dawn_native { namespace metal {
                         dynamicOffsets = mCommands.NextData<uint32_t>(cmd->dynamicOffsetCount);
                     }
 
-                    bindGroups.OnSetBindGroup(cmd->index, ToBackend(cmd->group.Get()),
+                    bindGroups.OnSetBindGroup(cmd->index, ToBackend(cmd->group),
                                               cmd->dynamicOffsetCount, dynamicOffsets);
                 } break;
 
@@ -1110,7 +1136,7 @@ namespace dawn_native { namespace metal {
 
                 case Command::SetRenderPipeline: {
                     SetRenderPipelineCmd* cmd = iter->NextCommand<SetRenderPipelineCmd>();
-                    RenderPipeline* newPipeline = ToBackend(cmd->pipeline).Get();
+                    RenderPipeline* newPipeline = ToBackend(cmd->pipeline);
 
                     vertexBuffers.OnSetPipeline(lastPipeline, newPipeline);
                     bindGroups.OnSetPipeline(newPipeline);
@@ -1130,13 +1156,13 @@ namespace dawn_native { namespace metal {
                         dynamicOffsets = iter->NextData<uint32_t>(cmd->dynamicOffsetCount);
                     }
 
-                    bindGroups.OnSetBindGroup(cmd->index, ToBackend(cmd->group.Get()),
+                    bindGroups.OnSetBindGroup(cmd->index, ToBackend(cmd->group),
                                               cmd->dynamicOffsetCount, dynamicOffsets);
                 } break;
 
                 case Command::SetIndexBuffer: {
                     SetIndexBufferCmd* cmd = iter->NextCommand<SetIndexBufferCmd>();
-                    auto b = ToBackend(cmd->buffer.Get());
+                    auto b = ToBackend(cmd->buffer);
                     indexBuffer = b->GetMTLBuffer();
                     indexBufferBaseOffset = cmd->offset;
                 } break;
@@ -1144,7 +1170,7 @@ namespace dawn_native { namespace metal {
                 case Command::SetVertexBuffer: {
                     SetVertexBufferCmd* cmd = iter->NextCommand<SetVertexBufferCmd>();
 
-                    vertexBuffers.OnSetVertexBuffer(cmd->slot, ToBackend(cmd->buffer.Get()),
+                    vertexBuffers.OnSetVertexBuffer(cmd->slot, ToBackend(cmd->buffer),
                                                     cmd->offset);
                 } break;
 
@@ -35,8 +35,9 @@ namespace dawn_native { namespace metal {
         ShaderModule* computeModule = ToBackend(descriptor->computeStage.module);
         const char* computeEntryPoint = descriptor->computeStage.entryPoint;
         ShaderModule::MetalFunctionData computeData;
-        DAWN_TRY(computeModule->GetFunction(computeEntryPoint, SingleShaderStage::Compute,
-                                            ToBackend(GetLayout()), &computeData));
+        DAWN_TRY(computeModule->GetFunction(
+            computeEntryPoint, SingleShaderStage::Compute, ToBackend(GetLayout()),
+            GetSpecializationConstants(&descriptor->computeStage), &computeData));
 
         NSError* error = nil;
         mMtlComputePipelineState =
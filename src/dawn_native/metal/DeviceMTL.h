@@ -27,6 +27,7 @@
 #import <QuartzCore/QuartzCore.h>
 
 #include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 
@@ -82,11 +83,16 @@ namespace dawn_native { namespace metal {
         }
         ResultOrError<BindGroupBase*> CreateBindGroupImpl(
             const BindGroupDescriptor* descriptor) override;
+        ResultOrError<BindGroupBase*> CreateDerivedBindGroupImpl(
+            BindGroupBase* parent,
+            uint32_t bindingCount,
+            const BindGroupBinding* bindings) override;
         ResultOrError<BindGroupLayoutBase*> CreateBindGroupLayoutImpl(
             const BindGroupLayoutDescriptor* descriptor) override;
         ResultOrError<BufferBase*> CreateBufferImpl(const BufferDescriptor* descriptor) override;
         ResultOrError<ComputePipelineBase*> CreateComputePipelineImpl(
             const ComputePipelineDescriptor* descriptor) override;
+        ResultOrError<HeapBase*> CreateHeapImpl(const HeapDescriptor* descriptor) override;
         ResultOrError<PipelineLayoutBase*> CreatePipelineLayoutImpl(
             const PipelineLayoutDescriptor* descriptor) override;
         ResultOrError<QueueBase*> CreateQueueImpl() override;
@@ -105,6 +111,7 @@ namespace dawn_native { namespace metal {
         void InitTogglesFromDriver();
         void Destroy() override;
         MaybeError WaitForIdleForDestruction() override;
+        ResultOrError<bool> WaitForSerialImpl(Serial serial, uint64_t timeoutNs) override;
 
         id<MTLDevice> mMtlDevice = nil;
         id<MTLCommandQueue> mCommandQueue = nil;
@@ -116,6 +123,10 @@ namespace dawn_native { namespace metal {
         // The completed serial is updated in a Metal completion handler that can be fired on a
         // different thread, so it needs to be atomic.
         std::atomic<uint64_t> mCompletedSerial;
+        // The completion handler also notifies mCompletedSerialCondition, with the mutex held so
+        // that WaitForSerialImpl can't miss it.
+        std::mutex mCompletedSerialMutex;
+        std::condition_variable mCompletedSerialCondition;
 
         // mLastSubmittedCommands will be accessed in a Metal schedule handler that can be fired on
         // a different thread so we guard access to it with a mutex.
@@ -19,6 +19,7 @@
 #include "dawn_native/BindGroupLayout.h"
 #include "dawn_native/DynamicUploader.h"
 #include "dawn_native/ErrorData.h"
+#include "dawn_native/Heap.h"
 #include "dawn_native/metal/BufferMTL.h"
 #include "dawn_native/metal/CommandBufferMTL.h"
 #include "dawn_native/metal/ComputePipelineMTL.h"
@@ -33,6 +34,8 @@
 #include "dawn_platform/DawnPlatform.h"
 #include "dawn_platform/tracing/TraceEvent.h"
 
+#include <algorithm>
+#include <chrono>
 #include <type_traits>
 
 namespace dawn_native { namespace metal {
@@ -78,6 +81,12 @@ namespace dawn_native { namespace metal {
         const BindGroupDescriptor* descriptor) {
         return new BindGroup(this, descriptor);
     }
+    ResultOrError<BindGroupBase*> Device::CreateDerivedBindGroupImpl(
+        BindGroupBase* parent,
+        uint32_t bindingCount,
+        const BindGroupBinding* bindings) {
+        return new BindGroup(this, parent, bindingCount, bindings);
+    }
     ResultOrError<BindGroupLayoutBase*> Device::CreateBindGroupLayoutImpl(
         const BindGroupLayoutDescriptor* descriptor) {
         return new BindGroupLayout(this, descriptor);
@@ -93,6 +102,10 @@ namespace dawn_native { namespace metal {
         const ComputePipelineDescriptor* descriptor) {
         return ComputePipeline::Create(this, descriptor);
     }
+    ResultOrError<HeapBase*> Device::CreateHeapImpl(const HeapDescriptor* descriptor) {
+        // Resources are never placed in heaps on this backend, each gets its own memory.
+        return new HeapBase(this, descriptor);
+    }
     ResultOrError<PipelineLayoutBase*> Device::CreatePipelineLayoutImpl(
         const PipelineLayoutDescriptor* descriptor) {
         return new PipelineLayout(this, descriptor);
@@ -211,7 +224,11 @@ namespace dawn_native { namespace metal {
             TRACE_EVENT_ASYNC_END0(GetPlatform(), GPUWork, "DeviceMTL::SubmitPendingCommandBuffer",
                                    pendingSerial);
             ASSERT(pendingSerial > mCompletedSerial.load());
-            this->mCompletedSerial = pendingSerial;
+            {
+                std::lock_guard<std::mutex> lock(this->mCompletedSerialMutex);
+                this->mCompletedSerial = pendingSerial;
+            }
+            this->mCompletedSerialCondition.notify_all();
         }];
 
         TRACE_EVENT_ASYNC_BEGIN0(GetPlatform(), GPUWork, "DeviceMTL::SubmitPendingCommandBuffer",
@@ -268,13 +285,27 @@ namespace dawn_native { namespace metal {
         [mCommandContext.AcquireCommands() release];
 
         // Wait for all commands to be finished so we can free resources
-        while (GetCompletedCommandSerial() != mLastSubmittedSerial) {
-            usleep(100);
-        }
+        bool completed = false;
+        DAWN_TRY_ASSIGN(completed, WaitForSerialImpl(mLastSubmittedSerial, UINT64_MAX));
+        ASSERT(completed);
         Tick();
         return {};
     }
 
+    ResultOrError<bool> Device::WaitForSerialImpl(Serial serial, uint64_t timeoutNs) {
+        std::unique_lock<std::mutex> lock(mCompletedSerialMutex);
+        auto IsCompleted = [this, serial]() { return mCompletedSerial.load() >= serial; };
+
+        if (timeoutNs == UINT64_MAX) {
+            mCompletedSerialCondition.wait(lock, IsCompleted);
+            return true;
+        }
+        // Clamp to an hour so that the deadline computed by wait_for can't overflow.
+        constexpr uint64_t kMaxTimeoutNs = uint64_t(3600) * 1000 * 1000 * 1000;
+        return mCompletedSerialCondition.wait_for(
+            lock, std::chrono::nanoseconds(std::min(timeoutNs, kMaxTimeoutNs)), IsCompleted);
+    }
+
     void Device::Destroy() {
         ASSERT(mLossStatus != LossStatus::AlreadyLost);
 
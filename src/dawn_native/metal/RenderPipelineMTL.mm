@@ -335,8 +335,9 @@ namespace dawn_native { namespace metal {
         ShaderModule* vertexModule = ToBackend(descriptor->vertexStage.module);
         const char* vertexEntryPoint = descriptor->vertexStage.entryPoint;
         ShaderModule::MetalFunctionData vertexData;
-        DAWN_TRY(vertexModule->GetFunction(vertexEntryPoint, SingleShaderStage::Vertex,
-                                           ToBackend(GetLayout()), &vertexData));
+        DAWN_TRY(vertexModule->GetFunction(
+            vertexEntryPoint, SingleShaderStage::Vertex, ToBackend(GetLayout()),
+            GetSpecializationConstants(&descriptor->vertexStage), &vertexData));
 
         descriptorMTL.vertexFunction = vertexData.function;
         if (vertexData.needsStorageBufferLength) {
@@ -346,8 +347,9 @@ namespace dawn_native { namespace metal {
         ShaderModule* fragmentModule = ToBackend(descriptor->fragmentStage->module);
         const char* fragmentEntryPoint = descriptor->fragmentStage->entryPoint;
         ShaderModule::MetalFunctionData fragmentData;
-        DAWN_TRY(fragmentModule->GetFunction(fragmentEntryPoint, SingleShaderStage::Fragment,
-                                             ToBackend(GetLayout()), &fragmentData));
+        DAWN_TRY(fragmentModule->GetFunction(
+            fragmentEntryPoint, SingleShaderStage::Fragment, ToBackend(GetLayout()),
+            GetSpecializationConstants(descriptor->fragmentStage), &fragmentData));
 
         descriptorMTL.fragmentFunction = fragmentData.function;
         if (fragmentData.needsStorageBufferLength) {
@@ -15,6 +15,7 @@
 #ifndef DAWNNATIVE_METAL_SHADERMODULEMTL_H_
 #define DAWNNATIVE_METAL_SHADERMODULEMTL_H_
 
+#include "dawn_native/Pipeline.h"
 #include "dawn_native/ShaderModule.h"
 
 #import <Metal/Metal.h>
@@ -46,6 +47,7 @@ namespace dawn_native { namespace metal {
         MaybeError GetFunction(const char* functionName,
                                SingleShaderStage functionStage,
                                const PipelineLayout* layout,
+                               const SpecializationConstants& constants,
                                MetalFunctionData* out);
 
       private:
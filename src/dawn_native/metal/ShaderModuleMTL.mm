@@ -53,6 +53,21 @@ namespace dawn_native { namespace metal {
             }
         }
 
+        MTLDataType MetalDataType(SpecializationConstantType type) {
+            switch (type) {
+                case SpecializationConstantType::Bool:
+                    return MTLDataTypeBool;
+                case SpecializationConstantType::Int32:
+                    return MTLDataTypeInt;
+                case SpecializationConstantType::Uint32:
+                    return MTLDataTypeUInt;
+                case SpecializationConstantType::Float32:
+                    return MTLDataTypeFloat;
+                default:
+                    UNREACHABLE();
+            }
+        }
+
         shaderc_spvc::CompileOptions GetMSLCompileOptions() {
             // If these options are changed, the values in DawnSPIRVCrossGLSLFastFuzzer.cpp need to
             // be updated.
@@ -108,6 +123,7 @@ namespace dawn_native { namespace metal {
     MaybeError ShaderModule::GetFunction(const char* functionName,
                                          SingleShaderStage functionStage,
                                          const PipelineLayout* layout,
+                                         const SpecializationConstants& constants,
                                          ShaderModule::MetalFunctionData* out) {
         ASSERT(!IsError());
         ASSERT(out);
@@ -225,7 +241,39 @@ namespace dawn_native { namespace metal {
             }
 
             NSString* name = [NSString stringWithFormat:@"%s", functionName];
-            out->function = [library newFunctionWithName:name];
+            if (constants.empty()) {
+                out->function = [library newFunctionWithName:name];
+            } else {
+                // SPIRV-Cross turns specialization constants into function constants with the
+                // same IDs.
+                MTLFunctionConstantValues* constantValues = [MTLFunctionConstantValues new];
+                for (const auto& constant : constants) {
+                    SpecializationConstantType type =
+                        GetSpecializationConstantTypes().at(constant.first);
+                    uint32_t bits = GetSpecializationConstantBits(type, constant.second);
+                    if (type == SpecializationConstantType::Bool) {
+                        bool value = bits != 0;
+                        [constantValues setConstantValue:&value
+                                                    type:MTLDataTypeBool
+                                                 atIndex:constant.first];
+                    } else {
+                        [constantValues setConstantValue:&bits
+                                                    type:MetalDataType(type)
+                                                 atIndex:constant.first];
+                    }
+                }
+
+                error = nil;
+                out->function = [library newFunctionWithName:name
+                                              constantValues:constantValues
+                                                       error:&error];
+                [constantValues release];
+                if (out->function == nil) {
+                    NSLog(@"MTLLibrary newFunctionWithName:constantValues: => %@", error);
+                    [library release];
+                    return DAWN_VALIDATION_ERROR("Unable to specialize function");
+                }
+            }
             [library release];
         }
 
@@ -19,6 +19,7 @@
 #include "dawn_native/DynamicUploader.h"
 #include "dawn_native/ErrorData.h"
 #include "dawn_native/Instance.h"
+#include "dawn_native/PollableEvent.h"
 
 #include <spirv_cross.hpp>
 
@@ -93,6 +94,12 @@ namespace dawn_native { namespace null {
         const BindGroupDescriptor* descriptor) {
         return new BindGroup(this, descriptor);
     }
+    ResultOrError<BindGroupBase*> Device::CreateDerivedBindGroupImpl(
+        BindGroupBase* parent,
+        uint32_t bindingCount,
+        const BindGroupBinding* bindings) {
+        return new BindGroup(this, parent, bindingCount, bindings);
+    }
     ResultOrError<BindGroupLayoutBase*> Device::CreateBindGroupLayoutImpl(
         const BindGroupLayoutDescriptor* descriptor) {
         return new BindGroupLayout(this, descriptor);
@@ -109,6 +116,10 @@ namespace dawn_native { namespace null {
         const ComputePipelineDescriptor* descriptor) {
         return new ComputePipeline(this, descriptor);
     }
+    ResultOrError<HeapBase*> Device::CreateHeapImpl(const HeapDescriptor* descriptor) {
+        // Resources are never placed in heaps on this backend, each gets its own memory.
+        return new HeapBase(this, descriptor);
+    }
     ResultOrError<PipelineLayoutBase*> Device::CreatePipelineLayoutImpl(
         const PipelineLayoutDescriptor* descriptor) {
         return new PipelineLayout(this, descriptor);
@@ -226,8 +237,22 @@ namespace dawn_native { namespace null {
         return {};
     }
 
+    ResultOrError<bool> Device::WaitForSerialImpl(Serial serial, uint64_t timeoutNs) {
+        if (mCompletedSerial < serial) {
+            SubmitPendingOperations();
+        }
+        ASSERT(mCompletedSerial >= serial);
+        return true;
+    }
+
+    bool Device::StartSignalingCompletion(PollableEvent* event) {
+        mCompletionEvent = event;
+        return true;
+    }
+
     void Device::AddPendingOperation(std::unique_ptr<PendingOperation> operation) {
         mPendingOperations.emplace_back(std::move(operation));
+        SignalCompletion();
     }
     void Device::SubmitPendingOperations() {
         for (auto& operation : mPendingOperations) {
@@ -239,6 +264,12 @@ namespace dawn_native { namespace null {
         mLastSubmittedSerial++;
     }
 
+    void Device::SignalCompletion() {
+        if (mCompletionEvent != nullptr) {
+            mCompletionEvent->Signal();
+        }
+    }
+
     // Buffer
 
     struct BufferMapOperation : PendingOperation {
@@ -344,6 +375,7 @@ namespace dawn_native { namespace null {
 
     MaybeError Queue::SubmitImpl(uint32_t, CommandBufferBase* const*) {
         ToBackend(GetDevice())->SubmitPendingOperations();
+        ToBackend(GetDevice())->SignalCompletion();
         return {};
     }
 
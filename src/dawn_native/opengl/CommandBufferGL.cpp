@@ -623,6 +623,31 @@ namespace dawn_native { namespace opengl {
                                         copySize.width, copySize.height, 1);
                 } break;
 
+                case Command::GenerateMipmaps: {
+                    GenerateMipmapsCmd* cmd = mCommands.NextCommand<GenerateMipmapsCmd>();
+                    Texture* texture = ToBackend(cmd->texture.Get());
+                    uint32_t layerCount = texture->GetArrayLayers();
+
+                    texture->EnsureSubresourceContentInitialized(cmd->baseLevel, 1, 0, layerCount);
+                    if (cmd->levelCount == 1) {
+                        break;
+                    }
+                    texture->SetIsSubresourceContentInitialized(true, cmd->baseLevel + 1,
+                                                                cmd->levelCount - 1, 0, layerCount);
+
+                    // glGenerateMipmap fills the levels after the base level up to the max level
+                    // so restrict them to the requested range, then restore the defaults.
+                    GLenum target = texture->GetGLTarget();
+                    gl.BindTexture(target, texture->GetHandle());
+                    gl.TexParameteri(target, GL_TEXTURE_BASE_LEVEL, cmd->baseLevel);
+                    gl.TexParameteri(target, GL_TEXTURE_MAX_LEVEL,
+                                     cmd->baseLevel + cmd->levelCount - 1);
+                    gl.GenerateMipmap(target);
+                    gl.TexParameteri(target, GL_TEXTURE_BASE_LEVEL, 0);
+                    gl.TexParameteri(target, GL_TEXTURE_MAX_LEVEL,
+                                     texture->GetNumMipLevels() - 1);
+                } break;
+
                 default: { UNREACHABLE(); } break;
             }
         }
@@ -665,7 +690,7 @@ namespace dawn_native { namespace opengl {
 
                 case Command::SetComputePipeline: {
                     SetComputePipelineCmd* cmd = mCommands.NextCommand<SetComputePipelineCmd>();
-                    lastPipeline = ToBackend(cmd->pipeline).Get();
+                    lastPipeline = ToBackend(cmd->pipeline);
                     lastPipeline->ApplyNow();
 
                     bindGroupTracker.OnSetPipeline(lastPipeline);
@@ -677,7 +702,7 @@ namespace dawn_native { namespace opengl {
                     if (cmd->dynamicOffsetCount > 0) {
                         dynamicOffsets = mCommands.NextData<uint32_t>(cmd->dynamicOffsetCount);
                     }
-                    bindGroupTracker.OnSetBindGroup(cmd->index, cmd->group.Get(),
+                    bindGroupTracker.OnSetBindGroup(cmd->index, cmd->group,
                                                     cmd->dynamicOffsetCount, dynamicOffsets);
                 } break;
 
@@ -923,7 +948,7 @@ namespace dawn_native { namespace opengl {
 
                 case Command::SetRenderPipeline: {
                     SetRenderPipelineCmd* cmd = iter->NextCommand<SetRenderPipelineCmd>();
-                    lastPipeline = ToBackend(cmd->pipeline).Get();
+                    lastPipeline = ToBackend(cmd->pipeline);
                     lastPipeline->ApplyNow(persistentPipelineState);
 
                     vertexStateBufferBindingTracker.OnSetPipeline(lastPipeline);
@@ -936,19 +961,19 @@ namespace dawn_native { namespace opengl {
                     if (cmd->dynamicOffsetCount > 0) {
                         dynamicOffsets = iter->NextData<uint32_t>(cmd->dynamicOffsetCount);
                     }
-                    bindGroupTracker.OnSetBindGroup(cmd->index, cmd->group.Get(),
+                    bindGroupTracker.OnSetBindGroup(cmd->index, cmd->group,
                                                     cmd->dynamicOffsetCount, dynamicOffsets);
                 } break;
 
                 case Command::SetIndexBuffer: {
                     SetIndexBufferCmd* cmd = iter->NextCommand<SetIndexBufferCmd>();
                     indexBufferBaseOffset = cmd->offset;
-                    vertexStateBufferBindingTracker.OnSetIndexBuffer(cmd->buffer.Get());
+                    vertexStateBufferBindingTracker.OnSetIndexBuffer(cmd->buffer);
                 } break;
 
                 case Command::SetVertexBuffer: {
                     SetVertexBufferCmd* cmd = iter->NextCommand<SetVertexBufferCmd>();
-                    vertexStateBufferBindingTracker.OnSetVertexBuffer(cmd->slot, cmd->buffer.Get(),
+                    vertexStateBufferBindingTracker.OnSetVertexBuffer(cmd->slot, cmd->buffer,
                                                                       cmd->offset);
                 } break;
 
@@ -23,7 +23,11 @@ namespace dawn_native { namespace opengl {
         PerStage<const ShaderModule*> modules(nullptr);
         modules[SingleShaderStage::Compute] = ToBackend(descriptor->computeStage.module);
 
-        PipelineGL::Initialize(device->gl, ToBackend(descriptor->layout), modules);
+        PerStage<SpecializationConstants> constants;
+        constants[SingleShaderStage::Compute] =
+            GetSpecializationConstants(&descriptor->computeStage);
+
+        PipelineGL::Initialize(device->gl, ToBackend(descriptor->layout), modules, constants);
     }
 
     void ComputePipeline::ApplyNow() {
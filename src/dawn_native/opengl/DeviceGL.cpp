@@ -19,6 +19,7 @@
 #include "dawn_native/BindGroupLayout.h"
 #include "dawn_native/DynamicUploader.h"
 #include "dawn_native/ErrorData.h"
+#include "dawn_native/Heap.h"
 #include "dawn_native/opengl/BufferGL.h"
 #include "dawn_native/opengl/CommandBufferGL.h"
 #include "dawn_native/opengl/ComputePipelineGL.h"
@@ -30,6 +31,8 @@
 #include "dawn_native/opengl/SwapChainGL.h"
 #include "dawn_native/opengl/TextureGL.h"
 
+#include <algorithm>
+
 namespace dawn_native { namespace opengl {
 
     Device::Device(AdapterBase* adapter,
@@ -59,6 +62,12 @@ namespace dawn_native { namespace opengl {
         const BindGroupDescriptor* descriptor) {
         return new BindGroup(this, descriptor);
     }
+    ResultOrError<BindGroupBase*> Device::CreateDerivedBindGroupImpl(
+        BindGroupBase* parent,
+        uint32_t bindingCount,
+        const BindGroupBinding* bindings) {
+        return new BindGroup(this, parent, bindingCount, bindings);
+    }
     ResultOrError<BindGroupLayoutBase*> Device::CreateBindGroupLayoutImpl(
         const BindGroupLayoutDescriptor* descriptor) {
         return new BindGroupLayout(this, descriptor);
@@ -74,6 +83,10 @@ namespace dawn_native { namespace opengl {
         const ComputePipelineDescriptor* descriptor) {
         return new ComputePipeline(this, descriptor);
     }
+    ResultOrError<HeapBase*> Device::CreateHeapImpl(const HeapDescriptor* descriptor) {
+        // Resources are never placed in heaps on this backend, each gets its own memory.
+        return new HeapBase(this, descriptor);
+    }
     ResultOrError<PipelineLayoutBase*> Device::CreatePipelineLayoutImpl(
         const PipelineLayoutDescriptor* descriptor) {
         return new PipelineLayout(this, descriptor);
@@ -108,7 +121,7 @@ namespace dawn_native { namespace opengl {
     void Device::SubmitFenceSync() {
         GLsync sync = gl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
         mLastSubmittedSerial++;
-        mFencesInFlight.emplace(sync, mLastSubmittedSerial);
+        mFencesInFlight.emplace_back(sync, mLastSubmittedSerial);
     }
 
     Serial Device::GetCompletedCommandSerial() const {
@@ -137,18 +150,44 @@ namespace dawn_native { namespace opengl {
             // as we see one that's not ready.
             GLenum result = gl.ClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
             if (result == GL_TIMEOUT_EXPIRED) {
-                continue;
+                return;
             }
 
             gl.DeleteSync(sync);
 
-            mFencesInFlight.pop();
+            mFencesInFlight.pop_front();
 
             ASSERT(fenceSerial > mCompletedSerial);
             mCompletedSerial = fenceSerial;
         }
     }
 
+    ResultOrError<bool> Device::WaitForSerialImpl(Serial serial, uint64_t timeoutNs) {
+        CheckPassedFences();
+        if (mCompletedSerial >= serial) {
+            return true;
+        }
+
+        // Fences pass in order so waiting on the first fence of a serial at least `serial` is
+        // enough.
+        auto it = std::find_if(mFencesInFlight.begin(), mFencesInFlight.end(),
+                               [serial](const std::pair<GLsync, Serial>& syncAndSerial) {
+                                   return syncAndSerial.second >= serial;
+                               });
+        ASSERT(it != mFencesInFlight.end());
+
+        GLenum result = gl.ClientWaitSync(it->first, GL_SYNC_FLUSH_COMMANDS_BIT, timeoutNs);
+        if (result == GL_TIMEOUT_EXPIRED) {
+            return false;
+        }
+        if (result == GL_WAIT_FAILED) {
+            return DAWN_DEVICE_LOST_ERROR("glClientWaitSync failed");
+        }
+
+        CheckPassedFences();
+        return true;
+    }
+
     ResultOrError<std::unique_ptr<StagingBufferBase>> Device::CreateStagingBuffer(size_t size) {
         return DAWN_UNIMPLEMENTED_ERROR("Device unable to create staging buffer.");
     }
@@ -23,7 +23,7 @@
 #include "dawn_native/opengl/GLFormat.h"
 #include "dawn_native/opengl/OpenGLFunctions.h"
 
-#include <queue>
+#include <deque>
 
 // Remove windows.h macros after glad's include of windows.h
 #if defined(DAWN_PLATFORM_WINDOWS)
@@ -78,11 +78,16 @@ namespace dawn_native { namespace opengl {
         }
         ResultOrError<BindGroupBase*> CreateBindGroupImpl(
             const BindGroupDescriptor* descriptor) override;
+        ResultOrError<BindGroupBase*> CreateDerivedBindGroupImpl(
+            BindGroupBase* parent,
+            uint32_t bindingCount,
+            const BindGroupBinding* bindings) override;
         ResultOrError<BindGroupLayoutBase*> CreateBindGroupLayoutImpl(
             const BindGroupLayoutDescriptor* descriptor) override;
         ResultOrError<BufferBase*> CreateBufferImpl(const BufferDescriptor* descriptor) override;
         ResultOrError<ComputePipelineBase*> CreateComputePipelineImpl(
             const ComputePipelineDescriptor* descriptor) override;
+        ResultOrError<HeapBase*> CreateHeapImpl(const HeapDescriptor* descriptor) override;
         ResultOrError<PipelineLayoutBase*> CreatePipelineLayoutImpl(
             const PipelineLayoutDescriptor* descriptor) override;
         ResultOrError<QueueBase*> CreateQueueImpl() override;
@@ -101,10 +106,11 @@ namespace dawn_native { namespace opengl {
         void CheckPassedFences();
         void Destroy() override;
         MaybeError WaitForIdleForDestruction() override;
+        ResultOrError<bool> WaitForSerialImpl(Serial serial, uint64_t timeoutNs) override;
 
         Serial mCompletedSerial = 0;
         Serial mLastSubmittedSerial = 0;
-        std::queue<std::pair<GLsync, Serial>> mFencesInFlight;
+        std::deque<std::pair<GLsync, Serial>> mFencesInFlight;
 
         GLFormatTable mFormatTable;
     };
@@ -48,7 +48,8 @@ namespace dawn_native { namespace opengl {
 
     void PipelineGL::Initialize(const OpenGLFunctions& gl,
                                 const PipelineLayout* layout,
-                                const PerStage<const ShaderModule*>& modules) {
+                                const PerStage<const ShaderModule*>& modules,
+                                const PerStage<SpecializationConstants>& constants) {
         auto CreateShader = [](const OpenGLFunctions& gl, GLenum type,
                                const char* source) -> GLuint {
             GLuint shader = gl.CreateShader(type);
@@ -81,7 +82,8 @@ namespace dawn_native { namespace opengl {
         }
 
         for (SingleShaderStage stage : IterateStages(activeStages)) {
-            GLuint shader = CreateShader(gl, GLShaderType(stage), modules[stage]->GetSource());
+            std::string source = modules[stage]->GetSource(constants[stage]);
+            GLuint shader = CreateShader(gl, GLShaderType(stage), source.c_str());
             gl.AttachShader(mProgram, shader);
         }
 
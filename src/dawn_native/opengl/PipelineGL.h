@@ -34,7 +34,8 @@ namespace dawn_native { namespace opengl {
 
         void Initialize(const OpenGLFunctions& gl,
                         const PipelineLayout* layout,
-                        const PerStage<const ShaderModule*>& modules);
+                        const PerStage<const ShaderModule*>& modules,
+                        const PerStage<SpecializationConstants>& constants);
 
         using BindingLocations =
             std::array<std::array<GLint, kMaxBindingsPerGroup>, kMaxBindGroups>;
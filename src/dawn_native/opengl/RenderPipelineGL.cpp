@@ -201,7 +201,12 @@ namespace dawn_native { namespace opengl {
         modules[SingleShaderStage::Vertex] = ToBackend(descriptor->vertexStage.module);
         modules[SingleShaderStage::Fragment] = ToBackend(descriptor->fragmentStage->module);
 
-        PipelineGL::Initialize(device->gl, ToBackend(GetLayout()), modules);
+        PerStage<SpecializationConstants> constants;
+        constants[SingleShaderStage::Vertex] = GetSpecializationConstants(&descriptor->vertexStage);
+        constants[SingleShaderStage::Fragment] =
+            GetSpecializationConstants(descriptor->fragmentStage);
+
+        PipelineGL::Initialize(device->gl, ToBackend(GetLayout()), modules, constants);
         CreateVAOForVertexState(descriptor->vertexState);
     }
 
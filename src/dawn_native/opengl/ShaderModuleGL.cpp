@@ -57,8 +57,16 @@ namespace dawn_native { namespace opengl {
         return module.release();
     }
 
-    const char* ShaderModule::GetSource() const {
-        return mGlslSource.c_str();
+    std::string ShaderModule::GetSource(const SpecializationConstants& constants) const {
+        if (constants.empty()) {
+            return mGlslSource;
+        }
+
+        // The defines must come after the #version directive.
+        size_t versionEnd = mGlslSource.find('\n') + 1;
+        std::string source = mGlslSource;
+        source.insert(versionEnd, GetSpecializationConstantDefines(constants));
+        return source;
     }
 
     const ShaderModule::CombinedSamplerInfo& ShaderModule::GetCombinedSamplerInfo() const {
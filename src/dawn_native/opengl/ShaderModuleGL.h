@@ -15,6 +15,7 @@
 #ifndef DAWNNATIVE_OPENGL_SHADERMODULEGL_H_
 #define DAWNNATIVE_OPENGL_SHADERMODULEGL_H_
 
+#include "dawn_native/Pipeline.h"
 #include "dawn_native/ShaderModule.h"
 
 #include "dawn_native/opengl/opengl_platform.h"
@@ -45,7 +46,8 @@ namespace dawn_native { namespace opengl {
 
         using CombinedSamplerInfo = std::vector<CombinedSampler>;
 
-        const char* GetSource() const;
+        // Returns the GLSL source with the specialization constants set to these values.
+        std::string GetSource(const SpecializationConstants& constants) const;
         const CombinedSamplerInfo& GetCombinedSamplerInfo() const;
 
       private:
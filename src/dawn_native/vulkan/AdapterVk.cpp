@@ -14,6 +14,7 @@
 
 #include "dawn_native/vulkan/AdapterVk.h"
 
+#include "common/Constants.h"
 #include "dawn_native/vulkan/BackendVk.h"
 #include "dawn_native/vulkan/DeviceVk.h"
 
@@ -74,6 +75,30 @@ namespace dawn_native { namespace vulkan {
         if (mDeviceInfo.features.textureCompressionBC == VK_TRUE) {
             mSupportedExtensions.EnableExtension(Extension::TextureCompressionBC);
         }
+
+        if (mDeviceInfo.descriptorIndexing) {
+            const VkPhysicalDeviceDescriptorIndexingFeaturesEXT& features =
+                mDeviceInfo.descriptorIndexingFeatures;
+            const VkPhysicalDeviceDescriptorIndexingPropertiesEXT& limits =
+                mDeviceInfo.descriptorIndexingProperties;
+
+            bool hasRequiredFeatures =
+                features.runtimeDescriptorArray == VK_TRUE &&
+                features.descriptorBindingPartiallyBound == VK_TRUE &&
+                features.descriptorBindingSampledImageUpdateAfterBind == VK_TRUE &&
+                features.descriptorBindingStorageBufferUpdateAfterBind == VK_TRUE &&
+                features.shaderSampledImageArrayNonUniformIndexing == VK_TRUE &&
+                features.shaderStorageBufferArrayNonUniformIndexing == VK_TRUE;
+            bool hasRequiredLimits =
+                limits.maxPerStageDescriptorUpdateAfterBindSampledImages >=
+                    kMaxBindingArrayLength &&
+                limits.maxPerStageDescriptorUpdateAfterBindStorageBuffers >=
+                    kMaxBindingArrayLength;
+
+            if (hasRequiredFeatures && hasRequiredLimits) {
+                mSupportedExtensions.EnableExtension(Extension::DescriptorIndexing);
+            }
+        }
     }
 
     ResultOrError<DeviceBase*> Adapter::CreateDeviceImpl(const DeviceDescriptor* descriptor) {
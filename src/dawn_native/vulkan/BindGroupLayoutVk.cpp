@@ -21,6 +21,7 @@
 #include "dawn_native/vulkan/VulkanError.h"
 #include "dawn_native/vulkan/UtilsVulkan.h"
 
+#include <algorithm>
 #include <map>
 
 namespace dawn_native { namespace vulkan {
@@ -67,15 +68,25 @@ namespace dawn_native { namespace vulkan {
         // bindings of the same type.
         uint32_t numBindings = 0;
         std::array<VkDescriptorSetLayoutBinding, kMaxBindingsPerGroup> bindings;
+        std::array<VkDescriptorBindingFlagsEXT, kMaxBindingsPerGroup> bindingFlags;
         for (uint32_t bindingIndex : IterateBitSet(info.mask)) {
             VkDescriptorSetLayoutBinding* binding = &bindings[numBindings];
             binding->binding = bindingIndex;
             binding->descriptorType =
                 VulkanDescriptorType(info.types[bindingIndex], info.hasDynamicOffset[bindingIndex]);
-            binding->descriptorCount = 1;
+            binding->descriptorCount = GetDescriptorCount(bindingIndex);
             binding->stageFlags = ToVulkanShaderStageFlags(info.visibilities[bindingIndex]);
             binding->pImmutableSamplers = nullptr;
 
+            // Binding arrays only have some of their elements written, and are updated after
+            // bind so that they can use the much higher update-after-bind descriptor limits.
+            bindingFlags[numBindings] = 0;
+            if (info.arrayLengths[bindingIndex] != 0) {
+                bindingFlags[numBindings] = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT |
+                                            VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT;
+                mHasBindingArrays = true;
+            }
+
             numBindings++;
         }
 
@@ -86,11 +97,39 @@ namespace dawn_native { namespace vulkan {
         createInfo.bindingCount = numBindings;
         createInfo.pBindings = bindings.data();
 
+        VkDescriptorSetLayoutBindingFlagsCreateInfoEXT bindingFlagsCreateInfo;
+        if (mHasBindingArrays) {
+            bindingFlagsCreateInfo.sType =
+                VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT;
+            bindingFlagsCreateInfo.pNext = nullptr;
+            bindingFlagsCreateInfo.bindingCount = numBindings;
+            bindingFlagsCreateInfo.pBindingFlags = bindingFlags.data();
+
+            createInfo.pNext = &bindingFlagsCreateInfo;
+            createInfo.flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT;
+        }
+
         Device* device = ToBackend(GetDevice());
         DAWN_TRY(CheckVkSuccess(device->fn.CreateDescriptorSetLayout(
                                     device->GetVkDevice(), &createInfo, nullptr, &mHandle),
                                 "CreateDescriptorSetLayout"));
 
+        // Binding arrays are updated after bind which push descriptors don't support.
+        // maxPushDescriptors is at least 32 so all the other layouts fit. Push descriptor set
+        // layouts can't have dynamic descriptors, so dynamic buffers use the non-dynamic type and
+        // their dynamic offset is added to the offset of the descriptor when it is pushed.
+        static_assert(kMaxBindingsPerGroup <= 32, "");
+        if (device->GetDeviceInfo().pushDescriptor && !mHasBindingArrays) {
+            for (uint32_t i = 0; i < numBindings; ++i) {
+                uint32_t bindingIndex = bindings[i].binding;
+                bindings[i].descriptorType = VulkanDescriptorType(info.types[bindingIndex], false);
+            }
+            createInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+            DAWN_TRY(CheckVkSuccess(device->fn.CreateDescriptorSetLayout(
+                                        device->GetVkDevice(), &createInfo, nullptr, &mPushHandle),
+                                    "CreateDescriptorSetLayout"));
+        }
+
         // Compute the size of descriptor pools used for this layout.
         std::map<VkDescriptorType, uint32_t> descriptorCountPerType;
 
@@ -99,7 +138,7 @@ namespace dawn_native { namespace vulkan {
                 VulkanDescriptorType(info.types[bindingIndex], info.hasDynamicOffset[bindingIndex]);
 
             // map::operator[] will return 0 if the key doesn't exist.
-            descriptorCountPerType[vulkanType]++;
+            descriptorCountPerType[vulkanType] += GetDescriptorCount(bindingIndex);
         }
 
         mPoolSizes.reserve(descriptorCountPerType.size());
@@ -119,6 +158,10 @@ namespace dawn_native { namespace vulkan {
             device->fn.DestroyDescriptorSetLayout(device->GetVkDevice(), mHandle, nullptr);
             mHandle = VK_NULL_HANDLE;
         }
+        if (mPushHandle != VK_NULL_HANDLE) {
+            device->fn.DestroyDescriptorSetLayout(device->GetVkDevice(), mPushHandle, nullptr);
+            mPushHandle = VK_NULL_HANDLE;
+        }
 
         FencedDeleter* deleter = device->GetFencedDeleter();
         for (const SingleDescriptorSetAllocation& allocation : mAllocations) {
@@ -131,6 +174,22 @@ namespace dawn_native { namespace vulkan {
         return mHandle;
     }
 
+    bool BindGroupLayout::CanUsePushDescriptors() const {
+        return mPushHandle != VK_NULL_HANDLE;
+    }
+
+    VkDescriptorSetLayout BindGroupLayout::GetPushHandle() const {
+        return mPushHandle;
+    }
+
+    uint32_t BindGroupLayout::GetDescriptorCount(uint32_t binding) const {
+        return std::max(GetBindingInfo().arrayLengths[binding], 1u);
+    }
+
+    bool BindGroupLayout::HasBindingArrays() const {
+        return mHasBindingArrays;
+    }
+
     ResultOrError<DescriptorSetAllocation> BindGroupLayout::AllocateOneSet() {
         Device* device = ToBackend(GetDevice());
 
@@ -148,6 +207,9 @@ namespace dawn_native { namespace vulkan {
         createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
         createInfo.pNext = nullptr;
         createInfo.flags = 0;
+        if (mHasBindingArrays) {
+            createInfo.flags |= VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT;
+        }
         createInfo.maxSets = 1;
         createInfo.poolSizeCount = static_cast<uint32_t>(mPoolSizes.size());
         createInfo.pPoolSizes = mPoolSizes.data();
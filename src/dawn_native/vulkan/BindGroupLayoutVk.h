@@ -53,6 +53,17 @@ namespace dawn_native { namespace vulkan {
 
         VkDescriptorSetLayout GetHandle() const;
 
+        // Layouts without binding arrays also have a push descriptor set layout when
+        // VK_KHR_push_descriptor is used. Pipeline layouts use it for at most one of their sets,
+        // and the bind groups of these layouts only allocate a descriptor set when they are bound
+        // to another set.
+        bool CanUsePushDescriptors() const;
+        VkDescriptorSetLayout GetPushHandle() const;
+
+        // The number of descriptors in the binding, which is more than one for binding arrays.
+        uint32_t GetDescriptorCount(uint32_t binding) const;
+        bool HasBindingArrays() const;
+
         ResultOrError<DescriptorSetAllocation> AllocateOneSet();
         void Deallocate(DescriptorSetAllocation* allocation);
 
@@ -64,6 +75,7 @@ namespace dawn_native { namespace vulkan {
         MaybeError Initialize();
 
         std::vector<VkDescriptorPoolSize> mPoolSizes;
+        bool mHasBindingArrays = false;
 
         struct SingleDescriptorSetAllocation {
             VkDescriptorPool pool = VK_NULL_HANDLE;
@@ -74,6 +86,7 @@ namespace dawn_native { namespace vulkan {
         std::vector<size_t> mAvailableAllocations;
 
         VkDescriptorSetLayout mHandle = VK_NULL_HANDLE;
+        VkDescriptorSetLayout mPushHandle = VK_NULL_HANDLE;
     };
 
 }}  // namespace dawn_native::vulkan
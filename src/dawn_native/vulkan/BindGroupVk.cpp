@@ -17,6 +17,7 @@
 #include "common/BitSetIterator.h"
 #include "dawn_native/vulkan/BindGroupLayoutVk.h"
 #include "dawn_native/vulkan/BufferVk.h"
+#include "dawn_native/vulkan/DescriptorSetCache.h"
 #include "dawn_native/vulkan/DeviceVk.h"
 #include "dawn_native/vulkan/FencedDeleter.h"
 #include "dawn_native/vulkan/SamplerVk.h"
@@ -26,103 +27,318 @@
 
 namespace dawn_native { namespace vulkan {
 
+    // The writes of the descriptors of a bind group, with all possible chained data allocated on
+    // the stack.
+    struct BindGroup::DescriptorWrites {
+        uint32_t count = 0;
+        std::array<VkWriteDescriptorSet, kMaxBindingsPerGroup> writes;
+        std::array<VkDescriptorBufferInfo, kMaxBindingsPerGroup> bufferInfos;
+        std::array<VkDescriptorImageInfo, kMaxBindingsPerGroup> imageInfos;
+        std::array<VkAccelerationStructureNV, kMaxBindingsPerGroup> accelerationStructures;
+        std::array<VkWriteDescriptorSetAccelerationStructureNV, kMaxBindingsPerGroup>
+            accelerationInfos;
+    };
+
     // static
     ResultOrError<BindGroup*> BindGroup::Create(Device* device,
                                                 const BindGroupDescriptor* descriptor) {
         std::unique_ptr<BindGroup> group = std::make_unique<BindGroup>(device, descriptor);
-        DAWN_TRY(group->Initialize());
+        DAWN_TRY(group->Initialize(nullptr, group->GetLayout()->GetBindingInfo().mask));
         return group.release();
     }
 
-    MaybeError BindGroup::Initialize() {
+    // static
+    ResultOrError<BindGroup*> BindGroup::CreateDerived(Device* device,
+                                                       BindGroup* parent,
+                                                       uint32_t bindingCount,
+                                                       const BindGroupBinding* bindings) {
+        std::unique_ptr<BindGroup> group =
+            std::make_unique<BindGroup>(device, parent, bindingCount, bindings);
+
+        std::bitset<kMaxBindingsPerGroup> bindingsToWrite;
+        for (uint32_t i = 0; i < bindingCount; ++i) {
+            bindingsToWrite.set(bindings[i].binding);
+        }
+
+        DAWN_TRY(group->Initialize(parent, bindingsToWrite));
+        return group.release();
+    }
+
+    MaybeError BindGroup::Initialize(const BindGroup* copySource,
+                                     const std::bitset<kMaxBindingsPerGroup>& bindingsToWrite) {
+        // The descriptors are written in the command buffer when the bind group is applied.
+        if (ToBackend(GetLayout())->CanUsePushDescriptors()) {
+            return {};
+        }
+
+        return AllocateDescriptorSet(copySource, bindingsToWrite);
+    }
+
+    MaybeError BindGroup::EnsureDescriptorSet() {
+        if (GetHandle() != VK_NULL_HANDLE) {
+            return {};
+        }
+        return AllocateDescriptorSet(nullptr, GetLayout()->GetBindingInfo().mask);
+    }
+
+    MaybeError BindGroup::AllocateDescriptorSet(
+        const BindGroup* copySource,
+        const std::bitset<kMaxBindingsPerGroup>& bindingsToWrite) {
         Device* device = ToBackend(GetDevice());
+        BindGroupLayout* layout = ToBackend(GetLayout());
+
+        // A parent that uses push descriptors might not have a descriptor set to copy from.
+        if (copySource != nullptr && copySource->GetHandle() == VK_NULL_HANDLE) {
+            return AllocateDescriptorSet(nullptr, layout->GetBindingInfo().mask);
+        }
+
+        // Bind groups with the same layout and resources as a live bind group reuse its
+        // descriptor set, which saves both the allocation and the descriptor writes. Binding
+        // arrays are large and rarely duplicated so they aren't worth caching.
+        if (device->IsToggleEnabled(Toggle::VulkanCacheDescriptorSets) &&
+            !layout->HasBindingArrays()) {
+            DescriptorSetCache* cache = device->GetDescriptorSetCache();
+            DescriptorSetCacheKey key(this);
+
+            mCachedSet = cache->Find(key);
+            if (mCachedSet.Get() == nullptr) {
+                DescriptorSetAllocation allocation;
+                DAWN_TRY_ASSIGN(allocation, layout->AllocateOneSet());
+                WriteDescriptorSet(allocation.set, copySource, bindingsToWrite);
+                mCachedSet = cache->Insert(key, layout, allocation);
+            }
+            return {};
+        }
+
+        DAWN_TRY_ASSIGN(mAllocation, layout->AllocateOneSet());
+        WriteDescriptorSet(mAllocation.set, copySource, bindingsToWrite);
 
-        DAWN_TRY_ASSIGN(mAllocation, ToBackend(GetLayout())->AllocateOneSet());
+        return {};
+    }
+
+    void BindGroup::WriteDescriptorSet(VkDescriptorSet set,
+                                       const BindGroup* copySource,
+                                       const std::bitset<kMaxBindingsPerGroup>& bindingsToWrite) {
+        Device* device = ToBackend(GetDevice());
 
         // Now do a write of a single descriptor set with all possible chained data allocated on the
         // stack.
-        uint32_t numWrites = 0;
-        std::array<VkWriteDescriptorSet, kMaxBindingsPerGroup> writes;
-        std::array<VkDescriptorBufferInfo, kMaxBindingsPerGroup> writeBufferInfo;
-        std::array<VkDescriptorImageInfo, kMaxBindingsPerGroup> writeImageInfo;
-        std::array<VkWriteDescriptorSetAccelerationStructureNV, kMaxBindingsPerGroup>
-            writeAccelerationInfo;
+        uint32_t numCopies = 0;
+        std::array<VkCopyDescriptorSet, kMaxBindingsPerGroup> copies;
+        DescriptorWrites writes;
 
         const auto& layoutInfo = GetLayout()->GetBindingInfo();
         for (uint32_t bindingIndex : IterateBitSet(layoutInfo.mask)) {
-            auto& write = writes[numWrites];
-            write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-            write.pNext = nullptr;
-            write.dstSet = mAllocation.set;
-            write.dstBinding = bindingIndex;
-            write.dstArrayElement = 0;
-            write.descriptorCount = 1;
-            write.descriptorType = VulkanDescriptorType(layoutInfo.types[bindingIndex],
-                                                        layoutInfo.hasDynamicOffset[bindingIndex]);
-
-            switch (layoutInfo.types[bindingIndex]) {
-                case wgpu::BindingType::UniformBuffer:
-                case wgpu::BindingType::StorageBuffer:
-                case wgpu::BindingType::ReadonlyStorageBuffer: {
-                    BufferBinding binding = GetBindingAsBufferBinding(bindingIndex);
-
-                    writeBufferInfo[numWrites].buffer = ToBackend(binding.buffer)->GetHandle();
-                    writeBufferInfo[numWrites].offset = binding.offset;
-                    writeBufferInfo[numWrites].range = binding.size;
-                    write.pBufferInfo = &writeBufferInfo[numWrites];
-                } break;
-
-                case wgpu::BindingType::Sampler: {
-                    Sampler* sampler = ToBackend(GetBindingAsSampler(bindingIndex));
-                    writeImageInfo[numWrites].sampler = sampler->GetHandle();
-                    write.pImageInfo = &writeImageInfo[numWrites];
-                } break;
-
-                case wgpu::BindingType::AccelerationContainer: {
-                    RayTracingAccelerationContainer* container =
-                        ToBackend(GetBindingAsRayTracingAccelerationContainer(bindingIndex));
-                    VkAccelerationStructureNV instance = container->GetAccelerationStructure();
-
-                    writeAccelerationInfo[numWrites].pNext = nullptr;
-                    writeAccelerationInfo[numWrites].sType =
-                        VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV;
-                    writeAccelerationInfo[numWrites].accelerationStructureCount = 1;
-                    writeAccelerationInfo[numWrites].pAccelerationStructures = &instance;
-
-                    write.pNext = &writeAccelerationInfo[numWrites];
-                } break;
-
-                case wgpu::BindingType::SampledTexture: {
-                    TextureView* view = ToBackend(GetBindingAsTextureView(bindingIndex));
-
-                    writeImageInfo[numWrites].imageView = view->GetHandle();
-                    // TODO(cwallez@chromium.org): This isn't true in general: if the image has
-                    // two read-only usages one of which is Sampled. Works for now though :)
-                    writeImageInfo[numWrites].imageLayout =
-                        VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-
-                    write.pImageInfo = &writeImageInfo[numWrites];
-                } break;
-
-                default:
-                    UNREACHABLE();
+            if (layoutInfo.arrayLengths[bindingIndex] != 0) {
+                WriteBindingArray(set, bindingIndex);
+                continue;
             }
 
-            numWrites++;
+            // Descriptors that are unchanged from the source bind group are copied on the device
+            // instead of being rebuilt from the frontend objects.
+            if (copySource != nullptr && !bindingsToWrite[bindingIndex]) {
+                auto& copy = copies[numCopies];
+                copy.sType = VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET;
+                copy.pNext = nullptr;
+                copy.srcSet = copySource->GetHandle();
+                copy.srcBinding = bindingIndex;
+                copy.srcArrayElement = 0;
+                copy.dstSet = set;
+                copy.dstBinding = bindingIndex;
+                copy.dstArrayElement = 0;
+                copy.descriptorCount = 1;
+
+                numCopies++;
+                continue;
+            }
+
+            AddDescriptorWrite(&writes, set, bindingIndex);
         }
 
         // TODO(cwallez@chromium.org): Batch these updates
-        device->fn.UpdateDescriptorSets(device->GetVkDevice(), numWrites, writes.data(), 0,
-                                        nullptr);
+        device->fn.UpdateDescriptorSets(device->GetVkDevice(), writes.count, writes.writes.data(),
+                                        numCopies, copies.data());
+    }
 
-        return {};
+    void BindGroup::PushDescriptorSet(VkCommandBuffer commands,
+                                      VkPipelineBindPoint bindPoint,
+                                      VkPipelineLayout pipelineLayout,
+                                      uint32_t set,
+                                      uint32_t dynamicOffsetCount,
+                                      const uint32_t* dynamicOffsets) {
+        ASSERT(ToBackend(GetLayout())->CanUsePushDescriptors());
+        Device* device = ToBackend(GetDevice());
+
+        // The push descriptor set layout uses the non-dynamic descriptor types, so the dynamic
+        // offsets are applied directly to the offsets of the pushed buffer descriptors. A new
+        // dynamic offset for each draw only pushes this set again.
+        const auto& layoutInfo = GetLayout()->GetBindingInfo();
+        uint32_t currentDynamicOffset = 0;
+
+        DescriptorWrites writes;
+        for (uint32_t bindingIndex : IterateBitSet(layoutInfo.mask)) {
+            AddDescriptorWrite(&writes, VK_NULL_HANDLE, bindingIndex);
+
+            if (layoutInfo.hasDynamicOffset[bindingIndex]) {
+                ASSERT(currentDynamicOffset < dynamicOffsetCount);
+                uint32_t index = writes.count - 1;
+                writes.writes[index].descriptorType =
+                    VulkanDescriptorType(layoutInfo.types[bindingIndex], false);
+                writes.bufferInfos[index].offset += dynamicOffsets[currentDynamicOffset];
+                currentDynamicOffset++;
+            }
+        }
+        ASSERT(currentDynamicOffset == dynamicOffsetCount);
+
+        device->fn.CmdPushDescriptorSetKHR(commands, bindPoint, pipelineLayout, set, writes.count,
+                                           writes.writes.data());
+    }
+
+    void BindGroup::AddDescriptorWrite(DescriptorWrites* writes,
+                                       VkDescriptorSet set,
+                                       uint32_t bindingIndex) {
+        const auto& layoutInfo = GetLayout()->GetBindingInfo();
+        uint32_t index = writes->count;
+
+        auto& write = writes->writes[index];
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.pNext = nullptr;
+        write.dstSet = set;
+        write.dstBinding = bindingIndex;
+        write.dstArrayElement = 0;
+        write.descriptorCount = 1;
+        write.descriptorType = VulkanDescriptorType(layoutInfo.types[bindingIndex],
+                                                    layoutInfo.hasDynamicOffset[bindingIndex]);
+
+        switch (layoutInfo.types[bindingIndex]) {
+            case wgpu::BindingType::UniformBuffer:
+            case wgpu::BindingType::StorageBuffer:
+            case wgpu::BindingType::ReadonlyStorageBuffer: {
+                BufferBinding binding = GetBindingAsBufferBinding(bindingIndex);
+
+                writes->bufferInfos[index].buffer = ToBackend(binding.buffer)->GetHandle();
+                writes->bufferInfos[index].offset = binding.offset;
+                writes->bufferInfos[index].range = binding.size;
+                write.pBufferInfo = &writes->bufferInfos[index];
+            } break;
+
+            case wgpu::BindingType::Sampler: {
+                Sampler* sampler = ToBackend(GetBindingAsSampler(bindingIndex));
+                writes->imageInfos[index].sampler = sampler->GetHandle();
+                write.pImageInfo = &writes->imageInfos[index];
+            } break;
+
+            case wgpu::BindingType::AccelerationContainer: {
+                RayTracingAccelerationContainer* container =
+                    ToBackend(GetBindingAsRayTracingAccelerationContainer(bindingIndex));
+                writes->accelerationStructures[index] = container->GetAccelerationStructure();
+
+                auto& accelerationInfo = writes->accelerationInfos[index];
+                accelerationInfo.pNext = nullptr;
+                accelerationInfo.sType =
+                    VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV;
+                accelerationInfo.accelerationStructureCount = 1;
+                accelerationInfo.pAccelerationStructures = &writes->accelerationStructures[index];
+
+                write.pNext = &accelerationInfo;
+            } break;
+
+            case wgpu::BindingType::SampledTexture: {
+                TextureView* view = ToBackend(GetBindingAsTextureView(bindingIndex));
+
+                writes->imageInfos[index].imageView = view->GetHandle();
+                // TODO(cwallez@chromium.org): This isn't true in general: if the image has
+                // two read-only usages one of which is Sampled. Works for now though :)
+                writes->imageInfos[index].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+                write.pImageInfo = &writes->imageInfos[index];
+            } break;
+
+            default:
+                UNREACHABLE();
+        }
+
+        writes->count++;
+    }
+
+    void BindGroup::WriteBindingArray(VkDescriptorSet set, uint32_t binding) {
+        Device* device = ToBackend(GetDevice());
+
+        std::vector<BindingArrayElement>& elements = GetBindingArrayElements(binding);
+        if (elements.empty()) {
+            return;
+        }
+
+        wgpu::BindingType type = GetLayout()->GetBindingInfo().types[binding];
+        bool isBuffer = type != wgpu::BindingType::SampledTexture;
+
+        std::vector<VkDescriptorBufferInfo> bufferInfos;
+        std::vector<VkDescriptorImageInfo> imageInfos;
+        if (isBuffer) {
+            bufferInfos.reserve(elements.size());
+            for (BindingArrayElement& element : elements) {
+                VkDescriptorBufferInfo info;
+                info.buffer = ToBackend(static_cast<BufferBase*>(element.resource.Get()))
+                                  ->GetHandle();
+                info.offset = element.offset;
+                info.range = element.size;
+                bufferInfos.push_back(info);
+            }
+        } else {
+            imageInfos.reserve(elements.size());
+            for (BindingArrayElement& element : elements) {
+                VkDescriptorImageInfo info;
+                info.sampler = VK_NULL_HANDLE;
+                info.imageView = ToBackend(static_cast<TextureViewBase*>(element.resource.Get()))
+                                     ->GetHandle();
+                info.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+                imageInfos.push_back(info);
+            }
+        }
+
+        // The elements are sorted so we can write each contiguous range of bound elements at
+        // once. Elements that aren't bound are left untouched since the binding is partially bound.
+        std::vector<VkWriteDescriptorSet> writes;
+        for (size_t rangeStart = 0; rangeStart < elements.size();) {
+            size_t rangeEnd = rangeStart + 1;
+            while (rangeEnd < elements.size() &&
+                   elements[rangeEnd].arrayElement == elements[rangeEnd - 1].arrayElement + 1) {
+                rangeEnd++;
+            }
+
+            VkWriteDescriptorSet write;
+            write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            write.pNext = nullptr;
+            write.dstSet = set;
+            write.dstBinding = binding;
+            write.dstArrayElement = elements[rangeStart].arrayElement;
+            write.descriptorCount = static_cast<uint32_t>(rangeEnd - rangeStart);
+            write.descriptorType = VulkanDescriptorType(type, false);
+            write.pImageInfo = isBuffer ? nullptr : &imageInfos[rangeStart];
+            write.pBufferInfo = isBuffer ? &bufferInfos[rangeStart] : nullptr;
+            write.pTexelBufferView = nullptr;
+            writes.push_back(write);
+
+            rangeStart = rangeEnd;
+        }
+
+        device->fn.UpdateDescriptorSets(device->GetVkDevice(),
+                                        static_cast<uint32_t>(writes.size()), writes.data(), 0,
+                                        nullptr);
     }
 
     BindGroup::~BindGroup() {
-        ToBackend(GetLayout())->Deallocate(&mAllocation);
+        // Cached descriptor sets are returned to the layout by the cache entry once the last
+        // bind group using them is destroyed.
+        if (mCachedSet.Get() == nullptr && mAllocation.set != VK_NULL_HANDLE) {
+            ToBackend(GetLayout())->Deallocate(&mAllocation);
+        }
     }
 
     VkDescriptorSet BindGroup::GetHandle() const {
+        if (mCachedSet.Get() != nullptr) {
+            return mCachedSet.Get()->GetHandle();
+        }
         return mAllocation.set;
     }
 
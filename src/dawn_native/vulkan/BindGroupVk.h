@@ -18,6 +18,7 @@
 #include "dawn_native/BindGroup.h"
 
 #include "dawn_native/vulkan/BindGroupLayoutVk.h"
+#include "dawn_native/vulkan/DescriptorSetCache.h"
 
 namespace dawn_native { namespace vulkan {
 
@@ -27,17 +28,49 @@ namespace dawn_native { namespace vulkan {
       public:
         static ResultOrError<BindGroup*> Create(Device* device,
                                                 const BindGroupDescriptor* descriptor);
+        static ResultOrError<BindGroup*> CreateDerived(Device* device,
+                                                       BindGroup* parent,
+                                                       uint32_t bindingCount,
+                                                       const BindGroupBinding* bindings);
         ~BindGroup();
 
+        // Returns VK_NULL_HANDLE when the layout uses push descriptors and the bind group wasn't
+        // bound to a set that doesn't push them yet, see EnsureDescriptorSet.
         VkDescriptorSet GetHandle() const;
 
+        // Allocates and writes the descriptor set of a bind group that uses push descriptors,
+        // for when it is bound to a set that doesn't push them.
+        MaybeError EnsureDescriptorSet();
+        void PushDescriptorSet(VkCommandBuffer commands,
+                               VkPipelineBindPoint bindPoint,
+                               VkPipelineLayout pipelineLayout,
+                               uint32_t set,
+                               uint32_t dynamicOffsetCount,
+                               const uint32_t* dynamicOffsets);
+
       private:
         using BindGroupBase::BindGroupBase;
-        MaybeError Initialize();
+        struct DescriptorWrites;
+
+        // When `copySource` is not null, the bindings that aren't in `bindingsToWrite` are copied
+        // from its descriptor set instead of being written from the frontend bindings.
+        MaybeError Initialize(const BindGroup* copySource,
+                              const std::bitset<kMaxBindingsPerGroup>& bindingsToWrite);
+        MaybeError AllocateDescriptorSet(const BindGroup* copySource,
+                                         const std::bitset<kMaxBindingsPerGroup>& bindingsToWrite);
+        void WriteDescriptorSet(VkDescriptorSet set,
+                                const BindGroup* copySource,
+                                const std::bitset<kMaxBindingsPerGroup>& bindingsToWrite);
+        void AddDescriptorWrite(DescriptorWrites* writes, VkDescriptorSet set, uint32_t binding);
+        void WriteBindingArray(VkDescriptorSet set, uint32_t binding);
 
         // The descriptor set in this allocation outlives the BindGroup because it is owned by
         // the BindGroupLayout which is referenced by the BindGroup.
         DescriptorSetAllocation mAllocation;
+
+        // When descriptor set caching is enabled the descriptor set is shared with the other
+        // bind groups that have the same contents and mAllocation is left empty.
+        Ref<CachedDescriptorSet> mCachedSet;
     };
 
 }}  // namespace dawn_native::vulkan
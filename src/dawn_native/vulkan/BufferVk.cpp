@@ -14,6 +14,7 @@
 
 #include "dawn_native/vulkan/BufferVk.h"
 
+#include "dawn_native/vulkan/DescriptorSetCache.h"
 #include "dawn_native/vulkan/DeviceVk.h"
 #include "dawn_native/vulkan/FencedDeleter.h"
 #include "dawn_native/vulkan/ResourceHeapVk.h"
@@ -119,14 +120,44 @@ namespace dawn_native { namespace vulkan {
 
     }  // namespace
 
+    MaybeError ValidateVulkanBufferCanBeWrapped(const DeviceBase*,
+                                                const BufferDescriptor* descriptor) {
+        if (descriptor == nullptr) {
+            return DAWN_VALIDATION_ERROR("Buffer descriptor is nullptr");
+        }
+
+        // Imported memory isn't guaranteed to be host visible, and mapping it would race with the
+        // other users of the memory anyway.
+        if (descriptor->usage & (wgpu::BufferUsage::MapRead | wgpu::BufferUsage::MapWrite)) {
+            return DAWN_VALIDATION_ERROR("Wrapped buffers can't have a map usage");
+        }
+
+        if (descriptor->nextInChain != nullptr) {
+            return DAWN_VALIDATION_ERROR("Wrapped buffers can't be placed in a heap");
+        }
+
+        return {};
+    }
+
     // static
     ResultOrError<Buffer*> Buffer::Create(Device* device, const BufferDescriptor* descriptor) {
         std::unique_ptr<Buffer> buffer = std::make_unique<Buffer>(device, descriptor);
-        DAWN_TRY(buffer->Initialize());
+        DAWN_TRY(buffer->Initialize(GetPlacedResourceDescriptor(descriptor->nextInChain)));
         return buffer.release();
     }
 
-    MaybeError Buffer::Initialize() {
+    // static
+    ResultOrError<Buffer*> Buffer::CreateFromExternal(
+        Device* device,
+        const ExternalBufferDescriptor* descriptor,
+        const BufferDescriptor* bufferDescriptor,
+        external_memory::Service* externalMemoryService) {
+        std::unique_ptr<Buffer> buffer = std::make_unique<Buffer>(device, bufferDescriptor);
+        DAWN_TRY(buffer->InitializeFromExternal(descriptor, externalMemoryService));
+        return buffer.release();
+    }
+
+    MaybeError Buffer::Initialize(const PlacedResourceDescriptor* placement) {
         // Avoid passing ludicrously large sizes to drivers because it causes issues: drivers add
         // some constants to the size passed and align it, but for values close to the maximum
         // VkDeviceSize this can cause overflows and makes drivers crash or return bad sizes in the
@@ -157,9 +188,17 @@ namespace dawn_native { namespace vulkan {
         VkMemoryRequirements requirements;
         device->fn.GetBufferMemoryRequirements(device->GetVkDevice(), mHandle, &requirements);
 
-        bool requestMappable =
-            (GetUsage() & (wgpu::BufferUsage::MapRead | wgpu::BufferUsage::MapWrite)) != 0;
-        DAWN_TRY_ASSIGN(mMemoryAllocation, device->AllocateMemory(requirements, requestMappable));
+        if (placement != nullptr) {
+            mHeap = ToBackend(placement->heap);
+            mHeapRangeSize = requirements.size;
+            DAWN_TRY_ASSIGN(mMemoryAllocation,
+                            mHeap->PlaceResource(requirements, placement->offset));
+        } else {
+            bool requestMappable =
+                (GetUsage() & (wgpu::BufferUsage::MapRead | wgpu::BufferUsage::MapWrite)) != 0;
+            DAWN_TRY_ASSIGN(mMemoryAllocation,
+                            device->AllocateMemory(requirements, requestMappable));
+        }
 
         DAWN_TRY(CheckVkSuccess(
             device->fn.BindBufferMemory(device->GetVkDevice(), mHandle,
@@ -170,6 +209,76 @@ namespace dawn_native { namespace vulkan {
         return {};
     }
 
+    MaybeError Buffer::InitializeFromExternal(const ExternalBufferDescriptor* descriptor,
+                                              external_memory::Service* externalMemoryService) {
+        // Wrapped buffers don't get CopyDst added implicitly: they are never initialized by Dawn
+        // since their content comes from the external memory.
+        VkBufferUsageFlags usage = VulkanBufferUsage(GetUsage());
+        if (!externalMemoryService->SupportsImportBufferMemory(usage, 0)) {
+            return DAWN_VALIDATION_ERROR("Creating a buffer from external memory is not supported");
+        }
+
+        mExternalState = ExternalState::PendingAcquire;
+        VkBufferCreateInfo baseCreateInfo;
+        baseCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        baseCreateInfo.pNext = nullptr;
+        baseCreateInfo.flags = 0;
+        baseCreateInfo.size = GetSize();
+        baseCreateInfo.usage = usage;
+        baseCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        baseCreateInfo.queueFamilyIndexCount = 0;
+        baseCreateInfo.pQueueFamilyIndices = nullptr;
+
+        DAWN_TRY_ASSIGN(mHandle, externalMemoryService->CreateBuffer(descriptor, baseCreateInfo));
+        return {};
+    }
+
+    MaybeError Buffer::BindExternalMemory(VkSemaphore signalSemaphore,
+                                          VkDeviceMemory externalMemoryAllocation,
+                                          std::vector<VkSemaphore> waitSemaphores) {
+        Device* device = ToBackend(GetDevice());
+        DAWN_TRY(CheckVkSuccess(device->fn.BindBufferMemory(device->GetVkDevice(), mHandle,
+                                                            externalMemoryAllocation, 0),
+                                "vkBindBufferMemory (external)"));
+
+        // Success, acquire all the external objects.
+        mExternalAllocation = externalMemoryAllocation;
+        mSignalSemaphore = signalSemaphore;
+        mWaitRequirements = std::move(waitSemaphores);
+        return {};
+    }
+
+    MaybeError Buffer::SignalAndDestroy(VkSemaphore* outSignalSemaphore) {
+        Device* device = ToBackend(GetDevice());
+
+        if (mExternalState == ExternalState::Released) {
+            return DAWN_VALIDATION_ERROR("Can't export signal semaphore from signaled buffer");
+        }
+
+        if (mExternalAllocation == VK_NULL_HANDLE) {
+            return DAWN_VALIDATION_ERROR(
+                "Can't export signal semaphore from destroyed / non-external buffer");
+        }
+
+        ASSERT(mSignalSemaphore != VK_NULL_HANDLE);
+
+        // Release the buffer
+        mExternalState = ExternalState::PendingRelease;
+        TransitionUsageNow(device->GetPendingRecordingContext(), wgpu::BufferUsage::None);
+
+        // Queue submit to signal we are done with the buffer
+        device->GetPendingRecordingContext()->signalSemaphores.push_back(mSignalSemaphore);
+        DAWN_TRY(device->SubmitPendingCommands());
+
+        // Write out the signal semaphore
+        *outSignalSemaphore = mSignalSemaphore;
+        mSignalSemaphore = VK_NULL_HANDLE;
+
+        // Destroy the buffer so it can't be used again
+        DestroyInternal();
+        return {};
+    }
+
     Buffer::~Buffer() {
         DestroyInternal();
     }
@@ -192,16 +301,30 @@ namespace dawn_native { namespace vulkan {
 
     void Buffer::TransitionUsageNow(CommandRecordingContext* recordingContext,
                                     wgpu::BufferUsage usage) {
+        AcquireHeapMemory(recordingContext);
+
+        // Move required semaphores into waitSemaphores
+        if (!mWaitRequirements.empty()) {
+            recordingContext->waitSemaphores.insert(recordingContext->waitSemaphores.end(),
+                                                    mWaitRequirements.begin(),
+                                                    mWaitRequirements.end());
+            mWaitRequirements.clear();
+        }
+
+        // Queue family ownership transfers of wrapped buffers always need a barrier.
+        bool queueFamilyTransfer = mExternalState == ExternalState::PendingAcquire ||
+                                   mExternalState == ExternalState::PendingRelease;
+
         bool lastIncludesTarget = (mLastUsage & usage) == usage;
         bool lastReadOnly = (mLastUsage & kReadOnlyBufferUsages) == mLastUsage;
 
         // We can skip transitions to already current read-only usages.
-        if (lastIncludesTarget && lastReadOnly) {
+        if (lastIncludesTarget && lastReadOnly && !queueFamilyTransfer) {
             return;
         }
 
         // Special-case for the initial transition: Vulkan doesn't allow access flags to be 0.
-        if (mLastUsage == wgpu::BufferUsage::None) {
+        if (mLastUsage == wgpu::BufferUsage::None && !queueFamilyTransfer) {
             mLastUsage = usage;
             return;
         }
@@ -220,6 +343,26 @@ namespace dawn_native { namespace vulkan {
         barrier.offset = 0;
         barrier.size = GetSize();
 
+        if (mExternalState == ExternalState::PendingAcquire) {
+            // Transfer buffer from external queue to graphics queue
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_EXTERNAL_KHR;
+            barrier.dstQueueFamilyIndex = ToBackend(GetDevice())->GetGraphicsQueueFamily();
+            mExternalState = ExternalState::Acquired;
+        } else if (mExternalState == ExternalState::PendingRelease) {
+            // Transfer buffer from graphics queue to external queue
+            barrier.srcQueueFamilyIndex = ToBackend(GetDevice())->GetGraphicsQueueFamily();
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_EXTERNAL_KHR;
+            mExternalState = ExternalState::Released;
+        }
+
+        // The acquire and release barriers can have no previous or next usage.
+        if (srcStages == 0) {
+            srcStages = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+        }
+        if (dstStages == 0) {
+            dstStages = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+        }
+
         ToBackend(GetDevice())
             ->fn.CmdPipelineBarrier(recordingContext->commandBuffer, srcStages, dstStages, 0, 0,
                                     nullptr, 1, &barrier, 0, nullptr);
@@ -227,6 +370,17 @@ namespace dawn_native { namespace vulkan {
         mLastUsage = usage;
     }
 
+    void Buffer::AcquireHeapMemory(CommandRecordingContext* recordingContext) {
+        if (mHeap.Get() == nullptr ||
+            !mHeap->AcquireRange(recordingContext, this, Heap::Tiling::Linear,
+                                 mMemoryAllocation.GetOffset(), mHeapRangeSize)) {
+            return;
+        }
+
+        // The aliasing barrier already waited for the previous accesses to the memory.
+        mLastUsage = wgpu::BufferUsage::None;
+    }
+
     bool Buffer::IsMapWritable() const {
         // TODO(enga): Handle CPU-visible memory on UMA
         return mMemoryAllocation.GetMappedPointer() != nullptr;
@@ -270,12 +424,29 @@ namespace dawn_native { namespace vulkan {
     }
 
     void Buffer::DestroyImpl() {
-        ToBackend(GetDevice())->DeallocateMemory(&mMemoryAllocation);
+        Device* device = ToBackend(GetDevice());
+        if (device->IsToggleEnabled(Toggle::VulkanCacheDescriptorSets)) {
+            device->GetDescriptorSetCache()->InvalidateEntriesUsing(this);
+        }
+
+        device->DeallocateMemory(&mMemoryAllocation);
+
+        if (mHeap.Get() != nullptr) {
+            mHeap->ReleaseRanges(this);
+            mHeap = nullptr;
+        }
 
         if (mHandle != VK_NULL_HANDLE) {
-            ToBackend(GetDevice())->GetFencedDeleter()->DeleteWhenUnused(mHandle);
+            device->GetFencedDeleter()->DeleteWhenUnused(mHandle);
             mHandle = VK_NULL_HANDLE;
         }
+
+        if (mExternalAllocation != VK_NULL_HANDLE) {
+            device->GetFencedDeleter()->DeleteWhenUnused(mExternalAllocation);
+            mExternalAllocation = VK_NULL_HANDLE;
+        }
+        // If a signal semaphore exists it should be requested before we delete the buffer
+        ASSERT(mSignalSemaphore == VK_NULL_HANDLE);
     }
 
     // MapRequestTracker
@@ -20,15 +20,30 @@
 #include "common/SerialQueue.h"
 #include "common/vulkan_platform.h"
 #include "dawn_native/ResourceMemoryAllocation.h"
+#include "dawn_native/vulkan/HeapVk.h"
+#include "dawn_native/vulkan/external_memory/MemoryService.h"
+
+#include <vector>
 
 namespace dawn_native { namespace vulkan {
 
     struct CommandRecordingContext;
     class Device;
 
+    MaybeError ValidateVulkanBufferCanBeWrapped(const DeviceBase* device,
+                                                const BufferDescriptor* descriptor);
+
     class Buffer : public BufferBase {
       public:
         static ResultOrError<Buffer*> Create(Device* device, const BufferDescriptor* descriptor);
+
+        // Creates a buffer and initializes it with a VkBuffer created for external memory. The
+        // memory must then be bound via Buffer::BindExternalMemory.
+        static ResultOrError<Buffer*> CreateFromExternal(
+            Device* device,
+            const ExternalBufferDescriptor* descriptor,
+            const BufferDescriptor* bufferDescriptor,
+            external_memory::Service* externalMemoryService);
         ~Buffer();
 
         void OnMapReadCommandSerialFinished(uint32_t mapSerial, const void* data);
@@ -41,10 +56,24 @@ namespace dawn_native { namespace vulkan {
         // `commands`.
         // TODO(cwallez@chromium.org): coalesce barriers and do them early when possible.
         void TransitionUsageNow(CommandRecordingContext* recordingContext, wgpu::BufferUsage usage);
+        // Buffers placed in a heap must acquire their memory before using it, in case other
+        // resources of the heap overwrote it. Their content is then lost.
+        void AcquireHeapMemory(CommandRecordingContext* recordingContext);
+
+        // Eagerly transition the buffer for export.
+        MaybeError SignalAndDestroy(VkSemaphore* outSignalSemaphore);
+
+        // Binds externally allocated memory to the VkBuffer and on success, takes ownership of
+        // semaphores.
+        MaybeError BindExternalMemory(VkSemaphore signalSemaphore,
+                                      VkDeviceMemory externalMemoryAllocation,
+                                      std::vector<VkSemaphore> waitSemaphores);
 
       private:
         using BufferBase::BufferBase;
-        MaybeError Initialize();
+        MaybeError Initialize(const PlacedResourceDescriptor* placement);
+        MaybeError InitializeFromExternal(const ExternalBufferDescriptor* descriptor,
+                                          external_memory::Service* externalMemoryService);
 
         // Dawn API
         MaybeError MapReadAsyncImpl(uint32_t serial) override;
@@ -58,7 +87,27 @@ namespace dawn_native { namespace vulkan {
         VkBuffer mHandle = VK_NULL_HANDLE;
         ResourceMemoryAllocation mMemoryAllocation;
 
+        // The heap the buffer is placed in, if any, and the size of its memory in the heap.
+        Ref<Heap> mHeap;
+        uint64_t mHeapRangeSize = 0;
+
         wgpu::BufferUsage mLastUsage = wgpu::BufferUsage::None;
+
+        // The external memory is imported as a dedicated VkDeviceMemory that is owned by the
+        // buffer instead of being suballocated.
+        VkDeviceMemory mExternalAllocation = VK_NULL_HANDLE;
+
+        enum class ExternalState {
+            InternalOnly,
+            PendingAcquire,
+            Acquired,
+            PendingRelease,
+            Released
+        };
+        ExternalState mExternalState = ExternalState::InternalOnly;
+
+        VkSemaphore mSignalSemaphore = VK_NULL_HANDLE;
+        std::vector<VkSemaphore> mWaitRequirements;
     };
 
     class MapRequestTracker {
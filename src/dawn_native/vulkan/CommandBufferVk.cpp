@@ -18,12 +18,14 @@
 #include "dawn_native/CommandEncoder.h"
 #include "dawn_native/Commands.h"
 #include "dawn_native/RenderBundle.h"
+#include "dawn_native/vulkan/AdapterVk.h"
 #include "dawn_native/vulkan/BindGroupVk.h"
 #include "dawn_native/vulkan/BufferVk.h"
 #include "dawn_native/vulkan/CommandRecordingContext.h"
 #include "dawn_native/vulkan/ComputePipelineVk.h"
 #include "dawn_native/vulkan/DeviceVk.h"
 #include "dawn_native/vulkan/FencedDeleter.h"
+#include "dawn_native/vulkan/FramebufferCache.h"
 #include "dawn_native/vulkan/PipelineLayoutVk.h"
 #include "dawn_native/vulkan/RayTracingAccelerationContainerVk.h"
 #include "dawn_native/vulkan/RayTracingPipelineVk.h"
@@ -35,6 +37,8 @@
 #include "dawn_native/vulkan/UtilsVulkan.h"
 #include "dawn_native/vulkan/VulkanError.h"
 
+#include <algorithm>
+
 namespace dawn_native { namespace vulkan {
 
     namespace {
@@ -95,24 +99,94 @@ namespace dawn_native { namespace vulkan {
             return region;
         }
 
+        // The frontend considers bind groups inherited across pipeline layouts that have the same
+        // bind group layouts, but in Vulkan the layouts also need to use push descriptors for the
+        // same set. Returns the sets that need to be applied again because they didn't.
+        std::bitset<kMaxBindGroups> SetsDisturbedByPushDescriptors(
+            const PipelineLayoutBase* lastAppliedPipelineLayout,
+            const PipelineLayoutBase* pipelineLayout) {
+            std::bitset<kMaxBindGroups> disturbedSets;
+            if (lastAppliedPipelineLayout == nullptr ||
+                lastAppliedPipelineLayout == pipelineLayout) {
+                return disturbedSets;
+            }
+
+            // The layouts stop being compatible at the first set that uses push descriptors in
+            // only one of them.
+            uint32_t lastPushSet = ToBackend(lastAppliedPipelineLayout)->GetPushDescriptorSet();
+            uint32_t pushSet = ToBackend(pipelineLayout)->GetPushDescriptorSet();
+            if (lastPushSet != pushSet) {
+                for (uint32_t i = std::min(lastPushSet, pushSet); i < kMaxBindGroups; ++i) {
+                    disturbedSets.set(i);
+                }
+            }
+            return disturbedSets;
+        }
+
         void ApplyDescriptorSets(Device* device,
                                  VkCommandBuffer commands,
                                  VkPipelineBindPoint bindPoint,
-                                 VkPipelineLayout pipelineLayout,
+                                 const PipelineLayout* pipelineLayout,
                                  const std::bitset<kMaxBindGroups>& bindGroupsToApply,
                                  const std::array<BindGroupBase*, kMaxBindGroups>& bindGroups,
                                  const std::array<uint32_t, kMaxBindGroups>& dynamicOffsetCounts,
                                  const std::array<std::array<uint32_t, kMaxBindingsPerGroup>,
                                                   kMaxBindGroups>& dynamicOffsets) {
+            VkPipelineLayout layoutHandle = pipelineLayout->GetHandle();
+            uint32_t pushSet = pipelineLayout->GetPushDescriptorSet();
+
+            // Consecutive dirty sets are bound with a single call, the dynamic offsets of all the
+            // sets in the range are concatenated in set order.
+            std::array<VkDescriptorSet, kMaxBindGroups> sets;
+            std::array<uint32_t, kMaxBindGroups * kMaxBindingsPerGroup> rangeDynamicOffsets;
+            uint32_t firstSet = 0;
+            uint32_t setCount = 0;
+            uint32_t dynamicOffsetCount = 0;
+
+            auto FlushRange = [&]() {
+                if (setCount == 0) {
+                    return;
+                }
+                device->fn.CmdBindDescriptorSets(commands, bindPoint, layoutHandle, firstSet,
+                                                 setCount, sets.data(), dynamicOffsetCount,
+                                                 dynamicOffsetCount > 0
+                                                     ? rangeDynamicOffsets.data()
+                                                     : nullptr);
+                setCount = 0;
+                dynamicOffsetCount = 0;
+            };
+
             for (uint32_t dirtyIndex : IterateBitSet(bindGroupsToApply)) {
-                VkDescriptorSet set = ToBackend(bindGroups[dirtyIndex])->GetHandle();
-                const uint32_t* dynamicOffset = dynamicOffsetCounts[dirtyIndex] > 0
-                                                    ? dynamicOffsets[dirtyIndex].data()
-                                                    : nullptr;
-                device->fn.CmdBindDescriptorSets(commands, bindPoint, pipelineLayout, dirtyIndex, 1,
-                                                 &set, dynamicOffsetCounts[dirtyIndex],
-                                                 dynamicOffset);
+                BindGroup* bindGroup = ToBackend(bindGroups[dirtyIndex]);
+
+                if (dirtyIndex == pushSet) {
+                    FlushRange();
+                    bindGroup->PushDescriptorSet(commands, bindPoint, layoutHandle, dirtyIndex,
+                                                 dynamicOffsetCounts[dirtyIndex],
+                                                 dynamicOffsets[dirtyIndex].data());
+                    continue;
+                }
+
+                // Bind groups that use push descriptors only get a descriptor set the first time
+                // they are bound to a set that doesn't push them.
+                if (device->ConsumedError(bindGroup->EnsureDescriptorSet())) {
+                    FlushRange();
+                    continue;
+                }
+
+                if (setCount > 0 && dirtyIndex != firstSet + setCount) {
+                    FlushRange();
+                }
+                if (setCount == 0) {
+                    firstSet = dirtyIndex;
+                }
+
+                sets[setCount++] = bindGroup->GetHandle();
+                for (uint32_t i = 0; i < dynamicOffsetCounts[dirtyIndex]; ++i) {
+                    rangeDynamicOffsets[dynamicOffsetCount++] = dynamicOffsets[dirtyIndex][i];
+                }
             }
+            FlushRange();
         }
 
         class RenderDescriptorSetTracker : public BindGroupTrackerBase<true, uint32_t> {
@@ -122,9 +196,12 @@ namespace dawn_native { namespace vulkan {
             void Apply(Device* device,
                        CommandRecordingContext* recordingContext,
                        VkPipelineBindPoint bindPoint) {
+                std::bitset<kMaxBindGroups> bindGroupsToApply =
+                    mDirtyBindGroupsObjectChangedOrIsDynamic |
+                    (SetsDisturbedByPushDescriptors(mLastAppliedPipelineLayout, mPipelineLayout) &
+                     mBindGroupLayoutsMask);
                 ApplyDescriptorSets(device, recordingContext->commandBuffer, bindPoint,
-                                    ToBackend(mPipelineLayout)->GetHandle(),
-                                    mDirtyBindGroupsObjectChangedOrIsDynamic, mBindGroups,
+                                    ToBackend(mPipelineLayout), bindGroupsToApply, mBindGroups,
                                     mDynamicOffsetCounts, mDynamicOffsets);
                 DidApply();
             }
@@ -138,9 +215,12 @@ namespace dawn_native { namespace vulkan {
             void Apply(Device* device,
                        CommandRecordingContext* recordingContext,
                        VkPipelineBindPoint bindPoint) {
+                std::bitset<kMaxBindGroups> bindGroupsToApply =
+                    mDirtyBindGroupsObjectChangedOrIsDynamic |
+                    (SetsDisturbedByPushDescriptors(mLastAppliedPipelineLayout, mPipelineLayout) &
+                     mBindGroupLayoutsMask);
                 ApplyDescriptorSets(device, recordingContext->commandBuffer, bindPoint,
-                                    ToBackend(mPipelineLayout)->GetHandle(),
-                                    mDirtyBindGroupsObjectChangedOrIsDynamic, mBindGroups,
+                                    ToBackend(mPipelineLayout), bindGroupsToApply, mBindGroups,
                                     mDynamicOffsetCounts, mDynamicOffsets);
 
                 for (uint32_t index : IterateBitSet(mBindGroupLayoutsMask)) {
@@ -179,9 +259,12 @@ namespace dawn_native { namespace vulkan {
             void Apply(Device* device,
                        CommandRecordingContext* recordingContext,
                        VkPipelineBindPoint bindPoint) {
+                std::bitset<kMaxBindGroups> bindGroupsToApply =
+                    mDirtyBindGroupsObjectChangedOrIsDynamic |
+                    (SetsDisturbedByPushDescriptors(mLastAppliedPipelineLayout, mPipelineLayout) &
+                     mBindGroupLayoutsMask);
                 ApplyDescriptorSets(device, recordingContext->commandBuffer, bindPoint,
-                                    ToBackend(mPipelineLayout)->GetHandle(),
-                                    mDirtyBindGroupsObjectChangedOrIsDynamic, mBindGroups,
+                                    ToBackend(mPipelineLayout), bindGroupsToApply, mBindGroups,
                                     mDynamicOffsetCounts, mDynamicOffsets);
 
                 for (uint32_t index : IterateBitSet(mBindGroupLayoutsMask)) {
@@ -232,14 +315,16 @@ namespace dawn_native { namespace vulkan {
                     wgpu::LoadOp loadOp = attachmentInfo.loadOp;
 
                     query.SetColor(i, attachmentInfo.view->GetFormat().format, loadOp,
-                                   hasResolveTarget);
+                                   attachmentInfo.storeOp, hasResolveTarget);
                 }
 
                 if (renderPass->attachmentState->HasDepthStencilAttachment()) {
                     const auto& attachmentInfo = renderPass->depthStencilAttachment;
 
                     query.SetDepthStencil(attachmentInfo.view->GetTexture()->GetFormat().format,
-                                          attachmentInfo.depthLoadOp, attachmentInfo.stencilLoadOp);
+                                          attachmentInfo.depthLoadOp, attachmentInfo.depthStoreOp,
+                                          attachmentInfo.stencilLoadOp,
+                                          attachmentInfo.stencilStoreOp);
                 }
 
                 query.SetSampleCount(renderPass->attachmentState->GetSampleCount());
@@ -247,14 +332,17 @@ namespace dawn_native { namespace vulkan {
                 DAWN_TRY_ASSIGN(renderPassVK, device->GetRenderPassCache()->GetRenderPass(query));
             }
 
-            // Create a framebuffer that will be used once for the render pass and gather the clear
-            // values for the attachments at the same time.
+            // Query a framebuffer from the cache and gather the clear values for the attachments at
+            // the same time.
             std::array<VkClearValue, kMaxColorAttachments + 1> clearValues;
             VkFramebuffer framebuffer = VK_NULL_HANDLE;
             uint32_t attachmentCount = 0;
             {
-                // Fill in the attachment info that will be chained in the framebuffer create info.
-                std::array<VkImageView, kMaxColorAttachments * 2 + 1> attachments;
+                FramebufferCacheQuery query;
+                query.renderPass = renderPassVK;
+                query.width = renderPass->width;
+                query.height = renderPass->height;
+                auto& attachments = query.attachments;
 
                 for (uint32_t i :
                      IterateBitSet(renderPass->attachmentState->GetColorAttachmentsMask())) {
@@ -295,26 +383,8 @@ namespace dawn_native { namespace vulkan {
                     }
                 }
 
-                // Chain attachments and create the framebuffer
-                VkFramebufferCreateInfo createInfo;
-                createInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
-                createInfo.pNext = nullptr;
-                createInfo.flags = 0;
-                createInfo.renderPass = renderPassVK;
-                createInfo.attachmentCount = attachmentCount;
-                createInfo.pAttachments = attachments.data();
-                createInfo.width = renderPass->width;
-                createInfo.height = renderPass->height;
-                createInfo.layers = 1;
-
-                DAWN_TRY(
-                    CheckVkSuccess(device->fn.CreateFramebuffer(device->GetVkDevice(), &createInfo,
-                                                                nullptr, &framebuffer),
-                                   "CreateFramebuffer"));
-
-                // We don't reuse VkFramebuffers so mark the framebuffer for deletion as soon as the
-                // commands currently being recorded are finished.
-                device->GetFencedDeleter()->DeleteWhenUnused(framebuffer);
+                query.attachmentCount = attachmentCount;
+                DAWN_TRY_ASSIGN(framebuffer, device->GetFramebufferCache()->GetFramebuffer(query));
             }
 
             VkRenderPassBeginInfo beginInfo;
@@ -333,6 +403,92 @@ namespace dawn_native { namespace vulkan {
 
             return {};
         }
+
+        void RecordGenerateMipmaps(Device* device,
+                                   CommandRecordingContext* recordingContext,
+                                   GenerateMipmapsCmd* cmd) {
+            Texture* texture = ToBackend(cmd->texture.Get());
+            VkCommandBuffer commands = recordingContext->commandBuffer;
+            uint32_t layerCount = texture->GetArrayLayers();
+
+            texture->EnsureSubresourceContentInitialized(recordingContext, cmd->baseLevel, 1, 0,
+                                                         layerCount);
+            if (cmd->levelCount == 1) {
+                return;
+            }
+
+            // CopySrc | CopyDst maps to the GENERAL layout so each level can be read and written
+            // without changing its layout.
+            texture->TransitionUsageNow(recordingContext,
+                                        wgpu::TextureUsage::CopySrc | wgpu::TextureUsage::CopyDst);
+            texture->SetIsSubresourceContentInitialized(true, cmd->baseLevel + 1,
+                                                        cmd->levelCount - 1, 0, layerCount);
+
+            // All the formats that pass validation are renderable so they support blits, but not
+            // all of them support linear filtering.
+            VkFormatProperties properties;
+            device->fn.GetPhysicalDeviceFormatProperties(
+                ToBackend(device->GetAdapter())->GetPhysicalDevice(),
+                VulkanImageFormat(device, texture->GetFormat().format), &properties);
+            ASSERT((properties.optimalTilingFeatures & VK_FORMAT_FEATURE_BLIT_SRC_BIT) != 0);
+            ASSERT((properties.optimalTilingFeatures & VK_FORMAT_FEATURE_BLIT_DST_BIT) != 0);
+            VkFilter filter = (properties.optimalTilingFeatures &
+                               VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT) != 0
+                                  ? VK_FILTER_LINEAR
+                                  : VK_FILTER_NEAREST;
+
+            const Extent3D& size = texture->GetSize();
+            auto LevelCorner = [&size](uint32_t level) -> VkOffset3D {
+                return {static_cast<int32_t>(std::max(size.width >> level, 1u)),
+                        static_cast<int32_t>(std::max(size.height >> level, 1u)), 1};
+            };
+
+            for (uint32_t level = cmd->baseLevel + 1; level < cmd->baseLevel + cmd->levelCount;
+                 ++level) {
+                // Wait for the blit that wrote the source level. Only that level needs a barrier
+                // since the destination level hasn't been used since the transition above.
+                if (level > cmd->baseLevel + 1) {
+                    VkImageMemoryBarrier barrier;
+                    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+                    barrier.pNext = nullptr;
+                    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                    barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+                    barrier.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+                    barrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+                    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                    barrier.image = texture->GetHandle();
+                    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+                    barrier.subresourceRange.baseMipLevel = level - 1;
+                    barrier.subresourceRange.levelCount = 1;
+                    barrier.subresourceRange.baseArrayLayer = 0;
+                    barrier.subresourceRange.layerCount = layerCount;
+
+                    device->fn.CmdPipelineBarrier(commands, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                                  VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0,
+                                                  nullptr, 1, &barrier);
+                }
+
+                VkImageBlit region;
+                region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+                region.srcSubresource.mipLevel = level - 1;
+                region.srcSubresource.baseArrayLayer = 0;
+                region.srcSubresource.layerCount = layerCount;
+                region.srcOffsets[0] = {0, 0, 0};
+                region.srcOffsets[1] = LevelCorner(level - 1);
+
+                region.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+                region.dstSubresource.mipLevel = level;
+                region.dstSubresource.baseArrayLayer = 0;
+                region.dstSubresource.layerCount = layerCount;
+                region.dstOffsets[0] = {0, 0, 0};
+                region.dstOffsets[1] = LevelCorner(level);
+
+                device->fn.CmdBlitImage(commands, texture->GetHandle(), VK_IMAGE_LAYOUT_GENERAL,
+                                        texture->GetHandle(), VK_IMAGE_LAYOUT_GENERAL, 1, &region,
+                                        filter);
+            }
+        }
     }  // anonymous namespace
 
     // static
@@ -428,6 +584,7 @@ namespace dawn_native { namespace vulkan {
         };
         const std::vector<PassResourceUsage>& passResourceUsages = GetResourceUsages().perPass;
         size_t nextPassNumber = 0;
+        size_t nextRenderPassNumber = 0;
 
         bool hasBottomLevelContainerBuild = false;
         bool hasBottomLevelContainerUpdate = false;
@@ -634,7 +791,9 @@ namespace dawn_native { namespace vulkan {
 
                     if (IsCompleteSubresourceCopiedTo(dst.texture.Get(), copy->copySize,
                                                       subresource.mipLevel)) {
-                        // Since texture has been overwritten, it has been "initialized"
+                        // Since texture has been overwritten, it has been "initialized". Acquire
+                        // its heap memory first so that it doesn't lose that state afterwards.
+                        ToBackend(dst.texture)->AcquireHeapMemory(recordingContext);
                         dst.texture->SetIsSubresourceContentInitialized(
                             true, subresource.mipLevel, 1, subresource.baseArrayLayer, 1);
                     } else {
@@ -695,6 +854,7 @@ namespace dawn_native { namespace vulkan {
                     if (IsCompleteSubresourceCopiedTo(dst.texture.Get(), copy->copySize,
                                                       dst.mipLevel)) {
                         // Since destination texture has been overwritten, it has been "initialized"
+                        ToBackend(dst.texture)->AcquireHeapMemory(recordingContext);
                         dst.texture->SetIsSubresourceContentInitialized(true, dst.mipLevel, 1,
                                                                         dst.arrayLayer, 1);
                     } else {
@@ -742,15 +902,30 @@ namespace dawn_native { namespace vulkan {
 
                 } break;
 
+                case Command::GenerateMipmaps: {
+                    GenerateMipmapsCmd* cmd = mCommands.NextCommand<GenerateMipmapsCmd>();
+                    RecordGenerateMipmaps(device, recordingContext, cmd);
+                } break;
+
                 case Command::BeginRenderPass: {
                     BeginRenderPassCmd* cmd = mCommands.NextCommand<BeginRenderPassCmd>();
 
-                    TransitionForPass(recordingContext, passResourceUsages[nextPassNumber]);
+                    // Merged render passes are recorded in the same VkRenderPass as the previous
+                    // one, the frontend checked that they don't need any barriers.
+                    bool continuesPreviousPass =
+                        IsRenderPassMergedWithPrevious(nextRenderPassNumber);
+                    bool continuedByNextPass =
+                        IsRenderPassMergedWithPrevious(nextRenderPassNumber + 1);
+                    if (!continuesPreviousPass) {
+                        TransitionForPass(recordingContext, passResourceUsages[nextPassNumber]);
+                    }
 
                     LazyClearRenderPassAttachments(cmd);
-                    DAWN_TRY(RecordRenderPass(recordingContext, cmd));
+                    DAWN_TRY(RecordRenderPass(recordingContext, cmd, continuesPreviousPass,
+                                              continuedByNextPass));
 
                     nextPassNumber++;
+                    nextRenderPassNumber++;
                 } break;
 
                 case Command::BeginComputePass: {
@@ -812,7 +987,7 @@ namespace dawn_native { namespace vulkan {
                 case Command::SetBindGroup: {
                     SetBindGroupCmd* cmd = mCommands.NextCommand<SetBindGroupCmd>();
 
-                    BindGroup* bindGroup = ToBackend(cmd->group.Get());
+                    BindGroup* bindGroup = ToBackend(cmd->group);
                     uint32_t* dynamicOffsets = nullptr;
                     if (cmd->dynamicOffsetCount > 0) {
                         dynamicOffsets = mCommands.NextData<uint32_t>(cmd->dynamicOffsetCount);
@@ -824,7 +999,7 @@ namespace dawn_native { namespace vulkan {
 
                 case Command::SetComputePipeline: {
                     SetComputePipelineCmd* cmd = mCommands.NextCommand<SetComputePipelineCmd>();
-                    ComputePipeline* pipeline = ToBackend(cmd->pipeline).Get();
+                    ComputePipeline* pipeline = ToBackend(cmd->pipeline);
 
                     device->fn.CmdBindPipeline(commands, VK_PIPELINE_BIND_POINT_COMPUTE,
                                                pipeline->GetHandle());
@@ -938,7 +1113,7 @@ namespace dawn_native { namespace vulkan {
                 case Command::SetBindGroup: {
                     SetBindGroupCmd* cmd = mCommands.NextCommand<SetBindGroupCmd>();
 
-                    BindGroup* bindGroup = ToBackend(cmd->group.Get());
+                    BindGroup* bindGroup = ToBackend(cmd->group);
                     uint32_t* dynamicOffsets = nullptr;
                     if (cmd->dynamicOffsetCount > 0) {
                         dynamicOffsets = mCommands.NextData<uint32_t>(cmd->dynamicOffsetCount);
@@ -951,7 +1126,7 @@ namespace dawn_native { namespace vulkan {
                 case Command::SetRayTracingPipeline: {
                     SetRayTracingPipelineCmd* cmd =
                         mCommands.NextCommand<SetRayTracingPipelineCmd>();
-                    RayTracingPipeline* pipeline = ToBackend(cmd->pipeline).Get();
+                    RayTracingPipeline* pipeline = ToBackend(cmd->pipeline);
 
                     device->fn.CmdBindPipeline(commands, VK_PIPELINE_BIND_POINT_RAY_TRACING_NV,
                                                pipeline->GetHandle());
@@ -1017,11 +1192,15 @@ namespace dawn_native { namespace vulkan {
     }
 
     MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* recordingContext,
-                                               BeginRenderPassCmd* renderPassCmd) {
+                                               BeginRenderPassCmd* renderPassCmd,
+                                               bool continuesPreviousPass,
+                                               bool continuedByNextPass) {
         Device* device = ToBackend(GetDevice());
         VkCommandBuffer commands = recordingContext->commandBuffer;
 
-        DAWN_TRY(RecordBeginRenderPass(recordingContext, device, renderPassCmd));
+        if (!continuesPreviousPass) {
+            DAWN_TRY(RecordBeginRenderPass(recordingContext, device, renderPassCmd));
+        }
 
         // Set the default value for the dynamic state
         {
@@ -1147,7 +1326,7 @@ namespace dawn_native { namespace vulkan {
 
                 case Command::SetBindGroup: {
                     SetBindGroupCmd* cmd = iter->NextCommand<SetBindGroupCmd>();
-                    BindGroup* bindGroup = ToBackend(cmd->group.Get());
+                    BindGroup* bindGroup = ToBackend(cmd->group);
                     uint32_t* dynamicOffsets = nullptr;
                     if (cmd->dynamicOffsetCount > 0) {
                         dynamicOffsets = iter->NextData<uint32_t>(cmd->dynamicOffsetCount);
@@ -1172,7 +1351,7 @@ namespace dawn_native { namespace vulkan {
 
                 case Command::SetRenderPipeline: {
                     SetRenderPipelineCmd* cmd = iter->NextCommand<SetRenderPipelineCmd>();
-                    RenderPipeline* pipeline = ToBackend(cmd->pipeline).Get();
+                    RenderPipeline* pipeline = ToBackend(cmd->pipeline);
 
                     device->fn.CmdBindPipeline(commands, VK_PIPELINE_BIND_POINT_GRAPHICS,
                                                pipeline->GetHandle());
@@ -1200,7 +1379,9 @@ namespace dawn_native { namespace vulkan {
             switch (type) {
                 case Command::EndRenderPass: {
                     mCommands.NextCommand<EndRenderPassCmd>();
-                    device->fn.CmdEndRenderPass(commands);
+                    if (!continuedByNextPass) {
+                        device->fn.CmdEndRenderPass(commands);
+                    }
                     return {};
                 } break;
 
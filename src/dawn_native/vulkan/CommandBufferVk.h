@@ -45,7 +45,9 @@ namespace dawn_native { namespace vulkan {
         void RecordComputePass(CommandRecordingContext* recordingContext);
         void RecordRayTracingPass(CommandRecordingContext* recordingContext);
         MaybeError RecordRenderPass(CommandRecordingContext* recordingContext,
-                                    BeginRenderPassCmd* renderPass);
+                                    BeginRenderPassCmd* renderPass,
+                                    bool continuesPreviousPass,
+                                    bool continuedByNextPass);
         void RecordCopyImageWithTemporaryBuffer(CommandRecordingContext* recordingContext,
                                                 const TextureCopy& srcCopy,
                                                 const TextureCopy& dstCopy,
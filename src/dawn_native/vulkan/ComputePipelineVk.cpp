@@ -18,6 +18,7 @@
 #include "dawn_native/vulkan/FencedDeleter.h"
 #include "dawn_native/vulkan/PipelineLayoutVk.h"
 #include "dawn_native/vulkan/ShaderModuleVk.h"
+#include "dawn_native/vulkan/UtilsVulkan.h"
 #include "dawn_native/vulkan/VulkanError.h"
 
 namespace dawn_native { namespace vulkan {
@@ -47,7 +48,10 @@ namespace dawn_native { namespace vulkan {
         createInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
         createInfo.stage.module = ToBackend(descriptor->computeStage.module)->GetHandle();
         createInfo.stage.pName = descriptor->computeStage.entryPoint;
-        createInfo.stage.pSpecializationInfo = nullptr;
+
+        SpecializationInfoTemporaryAllocations specializationAllocations;
+        createInfo.stage.pSpecializationInfo =
+            ComputeSpecializationInfo(descriptor->computeStage, &specializationAllocations);
 
         Device* device = ToBackend(GetDevice());
         return CheckVkSuccess(
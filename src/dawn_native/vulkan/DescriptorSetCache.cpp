@@ -0,0 +1,212 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn_native/vulkan/DescriptorSetCache.h"
+
+#include "common/BitSetIterator.h"
+#include "common/HashUtils.h"
+#include "dawn_native/Buffer.h"
+#include "dawn_native/RayTracingAccelerationContainer.h"
+#include "dawn_native/Sampler.h"
+#include "dawn_native/Texture.h"
+#include "dawn_native/vulkan/BindGroupVk.h"
+
+#include <algorithm>
+
+namespace dawn_native { namespace vulkan {
+
+    namespace {
+
+        // Returns the resource whose destruction invalidates the descriptor of the binding.
+        // Destroying a texture invalidates the descriptors of all its views.
+        const ObjectBase* GetInvalidatingResource(const DescriptorSetCacheKey& key,
+                                                  uint32_t bindingIndex) {
+            const ObjectBase* resource = key.resources[bindingIndex];
+            if (key.layout->GetBindingInfo().types[bindingIndex] ==
+                wgpu::BindingType::SampledTexture) {
+                return static_cast<const TextureViewBase*>(resource)->GetTexture();
+            }
+            return resource;
+        }
+
+    }  // anonymous namespace
+
+    // DescriptorSetCacheKey
+
+    DescriptorSetCacheKey::DescriptorSetCacheKey(BindGroup* group) : layout(group->GetLayout()) {
+        const auto& layoutInfo = layout->GetBindingInfo();
+        for (uint32_t bindingIndex : IterateBitSet(layoutInfo.mask)) {
+            switch (layoutInfo.types[bindingIndex]) {
+                case wgpu::BindingType::UniformBuffer:
+                case wgpu::BindingType::StorageBuffer:
+                case wgpu::BindingType::ReadonlyStorageBuffer: {
+                    BufferBinding binding = group->GetBindingAsBufferBinding(bindingIndex);
+                    resources[bindingIndex] = binding.buffer;
+                    offsets[bindingIndex] = binding.offset;
+                    sizes[bindingIndex] = binding.size;
+                } break;
+
+                case wgpu::BindingType::Sampler:
+                    resources[bindingIndex] = group->GetBindingAsSampler(bindingIndex);
+                    break;
+
+                case wgpu::BindingType::SampledTexture:
+                    resources[bindingIndex] = group->GetBindingAsTextureView(bindingIndex);
+                    break;
+
+                case wgpu::BindingType::AccelerationContainer:
+                    resources[bindingIndex] =
+                        group->GetBindingAsRayTracingAccelerationContainer(bindingIndex);
+                    break;
+
+                default:
+                    UNREACHABLE();
+            }
+        }
+    }
+
+    // CachedDescriptorSet
+
+    CachedDescriptorSet::CachedDescriptorSet(DescriptorSetCache* cache,
+                                             const DescriptorSetCacheKey& key,
+                                             BindGroupLayout* layout,
+                                             DescriptorSetAllocation allocation)
+        : mCache(cache), mKey(key), mLayout(layout), mAllocation(allocation) {
+    }
+
+    CachedDescriptorSet::~CachedDescriptorSet() {
+        if (mIsCached) {
+            mCache->Uncache(this);
+        }
+        mLayout->Deallocate(&mAllocation);
+    }
+
+    VkDescriptorSet CachedDescriptorSet::GetHandle() const {
+        return mAllocation.set;
+    }
+
+    // DescriptorSetCache
+
+    DescriptorSetCache::DescriptorSetCache() {
+    }
+
+    DescriptorSetCache::~DescriptorSetCache() {
+        // Entries are owned by the bind groups using them, which must all be destroyed before the
+        // device.
+        ASSERT(mCache.empty());
+        ASSERT(mEntriesUsingResource.empty());
+    }
+
+    Ref<CachedDescriptorSet> DescriptorSetCache::Find(const DescriptorSetCacheKey& key) {
+        auto it = mCache.find(key);
+        if (it == mCache.end()) {
+            return nullptr;
+        }
+        return it->second;
+    }
+
+    Ref<CachedDescriptorSet> DescriptorSetCache::Insert(const DescriptorSetCacheKey& key,
+                                                        BindGroupLayout* layout,
+                                                        DescriptorSetAllocation allocation) {
+        ASSERT(mCache.find(key) == mCache.end());
+        Ref<CachedDescriptorSet> entry =
+            AcquireRef(new CachedDescriptorSet(this, key, layout, allocation));
+        mCache.emplace(key, entry.Get());
+
+        for (uint32_t bindingIndex : IterateBitSet(key.layout->GetBindingInfo().mask)) {
+            std::vector<CachedDescriptorSet*>& entries =
+                mEntriesUsingResource[GetInvalidatingResource(key, bindingIndex)];
+            // Entries using a resource in several bindings are only tracked once.
+            if (entries.empty() || entries.back() != entry.Get()) {
+                entries.push_back(entry.Get());
+            }
+        }
+        return entry;
+    }
+
+    void DescriptorSetCache::InvalidateEntriesUsing(const ObjectBase* resource) {
+        auto it = mEntriesUsingResource.find(resource);
+        if (it == mEntriesUsingResource.end()) {
+            return;
+        }
+        std::vector<CachedDescriptorSet*> entries = std::move(it->second);
+        mEntriesUsingResource.erase(it);
+
+        for (CachedDescriptorSet* entry : entries) {
+            const DescriptorSetCacheKey& key = entry->mKey;
+            for (uint32_t bindingIndex : IterateBitSet(key.layout->GetBindingInfo().mask)) {
+                const ObjectBase* otherResource = GetInvalidatingResource(key, bindingIndex);
+                if (otherResource != resource) {
+                    ForgetEntryUsingResource(entry, otherResource);
+                }
+            }
+
+            entry->mIsCached = false;
+            size_t removedCount = mCache.erase(key);
+            ASSERT(removedCount == 1);
+        }
+    }
+
+    void DescriptorSetCache::Uncache(CachedDescriptorSet* entry) {
+        ASSERT(entry->mIsCached);
+        const DescriptorSetCacheKey& key = entry->mKey;
+        for (uint32_t bindingIndex : IterateBitSet(key.layout->GetBindingInfo().mask)) {
+            ForgetEntryUsingResource(entry, GetInvalidatingResource(key, bindingIndex));
+        }
+
+        size_t removedCount = mCache.erase(key);
+        ASSERT(removedCount == 1);
+    }
+
+    void DescriptorSetCache::ForgetEntryUsingResource(CachedDescriptorSet* entry,
+                                                      const ObjectBase* resource) {
+        auto it = mEntriesUsingResource.find(resource);
+        // The entry was already forgotten if it uses the resource in several bindings.
+        if (it == mEntriesUsingResource.end()) {
+            return;
+        }
+
+        std::vector<CachedDescriptorSet*>& entries = it->second;
+        auto entryIt = std::find(entries.begin(), entries.end(), entry);
+        if (entryIt == entries.end()) {
+            return;
+        }
+        *entryIt = entries.back();
+        entries.pop_back();
+
+        if (entries.empty()) {
+            mEntriesUsingResource.erase(it);
+        }
+    }
+
+    size_t DescriptorSetCache::CacheFuncs::operator()(const DescriptorSetCacheKey& key) const {
+        const auto& layoutInfo = key.layout->GetBindingInfo();
+
+        size_t hash = Hash(key.layout);
+        for (uint32_t bindingIndex : IterateBitSet(layoutInfo.mask)) {
+            HashCombine(&hash, key.resources[bindingIndex], key.offsets[bindingIndex],
+                        key.sizes[bindingIndex]);
+        }
+        return hash;
+    }
+
+    bool DescriptorSetCache::CacheFuncs::operator()(const DescriptorSetCacheKey& a,
+                                                    const DescriptorSetCacheKey& b) const {
+        // Bindings outside of the layout's mask are zero-initialized so the arrays can be compared
+        // directly.
+        return a.layout == b.layout && a.resources == b.resources && a.offsets == b.offsets &&
+               a.sizes == b.sizes;
+    }
+
+}}  // namespace dawn_native::vulkan
@@ -0,0 +1,114 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_VULKAN_DESCRIPTORSETCACHE_H_
+#define DAWNNATIVE_VULKAN_DESCRIPTORSETCACHE_H_
+
+#include "common/Constants.h"
+#include "dawn_native/RefCounted.h"
+#include "dawn_native/vulkan/BindGroupLayoutVk.h"
+
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+namespace dawn_native { namespace vulkan {
+
+    class BindGroup;
+    class DescriptorSetCache;
+
+    // This is a key to query the DescriptorSetCache. It is sparse, only the bindings present in
+    // the layout's mask are meaningful and the other ones are zero-initialized. Resources are
+    // identified by their frontend object: they are kept alive by the bind groups that use the
+    // cached descriptor set, so the pointers cannot be recycled while the entry exists.
+    struct DescriptorSetCacheKey {
+        explicit DescriptorSetCacheKey(BindGroup* group);
+
+        BindGroupLayoutBase* layout = nullptr;
+        std::array<ObjectBase*, kMaxBindingsPerGroup> resources = {};
+        std::array<uint64_t, kMaxBindingsPerGroup> offsets = {};
+        std::array<uint64_t, kMaxBindingsPerGroup> sizes = {};
+    };
+
+    // A VkDescriptorSet shared by all the bind groups that have the same layout and resources.
+    // The descriptor set is returned to its layout when the last bind group referencing it is
+    // destroyed.
+    class CachedDescriptorSet : public RefCounted {
+      public:
+        CachedDescriptorSet(DescriptorSetCache* cache,
+                            const DescriptorSetCacheKey& key,
+                            BindGroupLayout* layout,
+                            DescriptorSetAllocation allocation);
+        ~CachedDescriptorSet();
+
+        VkDescriptorSet GetHandle() const;
+
+      private:
+        friend class DescriptorSetCache;
+
+        DescriptorSetCache* mCache;
+        DescriptorSetCacheKey mKey;
+        Ref<BindGroupLayout> mLayout;
+        DescriptorSetAllocation mAllocation;
+        // Cleared when the entry is invalidated, in which case it is no longer in the cache but
+        // still used by existing bind groups.
+        bool mIsCached = true;
+    };
+
+    // Lets bind groups with identical contents share a single VkDescriptorSet instead of
+    // allocating and writing a new one each time. This is only used when the
+    // vulkan_cache_descriptor_sets toggle is enabled.
+    class DescriptorSetCache {
+      public:
+        DescriptorSetCache();
+        ~DescriptorSetCache();
+
+        // Returns the descriptor set of a live bind group with the same contents as `key`, or
+        // nullptr on a cache miss.
+        Ref<CachedDescriptorSet> Find(const DescriptorSetCacheKey& key);
+
+        // Takes ownership of `allocation`, which must contain the descriptors described by `key`.
+        Ref<CachedDescriptorSet> Insert(const DescriptorSetCacheKey& key,
+                                        BindGroupLayout* layout,
+                                        DescriptorSetAllocation allocation);
+
+        // Called when the GPU objects backing a resource are destroyed: descriptor sets
+        // referencing them can no longer be handed out to new bind groups.
+        void InvalidateEntriesUsing(const ObjectBase* resource);
+
+      private:
+        friend class CachedDescriptorSet;
+        void Uncache(CachedDescriptorSet* entry);
+        void ForgetEntryUsingResource(CachedDescriptorSet* entry, const ObjectBase* resource);
+
+        struct CacheFuncs {
+            size_t operator()(const DescriptorSetCacheKey& key) const;
+            bool operator()(const DescriptorSetCacheKey& a, const DescriptorSetCacheKey& b) const;
+        };
+        using Cache = std::unordered_map<DescriptorSetCacheKey,
+                                         CachedDescriptorSet*,
+                                         CacheFuncs,
+                                         CacheFuncs>;
+
+        Cache mCache;
+
+        // The entries using each resource whose destruction invalidates them, so that
+        // InvalidateEntriesUsing doesn't have to look at the whole cache.
+        std::unordered_map<const ObjectBase*, std::vector<CachedDescriptorSet*>>
+            mEntriesUsingResource;
+    };
+
+}}  // namespace dawn_native::vulkan
+
+#endif  // DAWNNATIVE_VULKAN_DESCRIPTORSETCACHE_H_
@@ -14,6 +14,7 @@
 
 #include "dawn_native/vulkan/DeviceVk.h"
 
+#include "common/GPUInfo.h"
 #include "common/Platform.h"
 #include "dawn_native/BackendConnection.h"
 #include "dawn_native/Commands.h"
@@ -28,8 +29,12 @@
 #include "dawn_native/vulkan/BufferVk.h"
 #include "dawn_native/vulkan/CommandBufferVk.h"
 #include "dawn_native/vulkan/ComputePipelineVk.h"
+#include "dawn_native/vulkan/DescriptorSetCache.h"
 #include "dawn_native/vulkan/DescriptorSetService.h"
+#include "dawn_native/vulkan/FenceWatcher.h"
 #include "dawn_native/vulkan/FencedDeleter.h"
+#include "dawn_native/vulkan/FramebufferCache.h"
+#include "dawn_native/vulkan/HeapVk.h"
 #include "dawn_native/vulkan/PipelineLayoutVk.h"
 #include "dawn_native/vulkan/QueueVk.h"
 #include "dawn_native/vulkan/RayTracingAccelerationContainerVk.h"
@@ -45,6 +50,8 @@
 #include "dawn_native/vulkan/TextureVk.h"
 #include "dawn_native/vulkan/VulkanError.h"
 
+#include <algorithm>
+
 namespace dawn_native { namespace vulkan {
 
     Device::Device(Adapter* adapter, const DeviceDescriptor* descriptor)
@@ -71,8 +78,10 @@ namespace dawn_native { namespace vulkan {
         DAWN_TRY(functions->LoadDeviceProcs(mVkDevice, mDeviceInfo));
 
         GatherQueueFromDevice();
+        mDescriptorSetCache = std::make_unique<DescriptorSetCache>();
         mDescriptorSetService = std::make_unique<DescriptorSetService>(this);
         mDeleter = std::make_unique<FencedDeleter>(this);
+        mFramebufferCache = std::make_unique<FramebufferCache>(this);
         mMapRequestTracker = std::make_unique<MapRequestTracker>(this);
         mRenderPassCache = std::make_unique<RenderPassCache>(this);
         mResourceMemoryAllocator = std::make_unique<ResourceMemoryAllocator>(this);
@@ -92,6 +101,7 @@ namespace dawn_native { namespace vulkan {
     Device::~Device() {
         BaseDestructor();
 
+        mDescriptorSetCache = nullptr;
         mDescriptorSetService = nullptr;
 
         // We still need to properly handle Vulkan object deletion even if the device has been lost,
@@ -128,6 +138,12 @@ namespace dawn_native { namespace vulkan {
         const BindGroupDescriptor* descriptor) {
         return BindGroup::Create(this, descriptor);
     }
+    ResultOrError<BindGroupBase*> Device::CreateDerivedBindGroupImpl(
+        BindGroupBase* parent,
+        uint32_t bindingCount,
+        const BindGroupBinding* bindings) {
+        return BindGroup::CreateDerived(this, ToBackend(parent), bindingCount, bindings);
+    }
     ResultOrError<BindGroupLayoutBase*> Device::CreateBindGroupLayoutImpl(
         const BindGroupLayoutDescriptor* descriptor) {
         return BindGroupLayout::Create(this, descriptor);
@@ -143,6 +159,9 @@ namespace dawn_native { namespace vulkan {
         const ComputePipelineDescriptor* descriptor) {
         return ComputePipeline::Create(this, descriptor);
     }
+    ResultOrError<HeapBase*> Device::CreateHeapImpl(const HeapDescriptor* descriptor) {
+        return Heap::Create(this, descriptor);
+    }
     ResultOrError<PipelineLayoutBase*> Device::CreatePipelineLayoutImpl(
         const PipelineLayoutDescriptor* descriptor) {
         return PipelineLayout::Create(this, descriptor);
@@ -236,6 +255,10 @@ namespace dawn_native { namespace vulkan {
         return mMapRequestTracker.get();
     }
 
+    DescriptorSetCache* Device::GetDescriptorSetCache() const {
+        return mDescriptorSetCache.get();
+    }
+
     DescriptorSetService* Device::GetDescriptorSetService() const {
         return mDescriptorSetService.get();
     }
@@ -244,6 +267,10 @@ namespace dawn_native { namespace vulkan {
         return mDeleter.get();
     }
 
+    FramebufferCache* Device::GetFramebufferCache() const {
+        return mFramebufferCache.get();
+    }
+
     RenderPassCache* Device::GetRenderPassCache() const {
         return mRenderPassCache.get();
     }
@@ -292,7 +319,10 @@ namespace dawn_native { namespace vulkan {
         }
 
         mLastSubmittedSerial++;
-        mFencesInFlight.emplace(fence, mLastSubmittedSerial);
+        mFencesInFlight.emplace_back(fence, mLastSubmittedSerial);
+        if (mFenceWatcher != nullptr) {
+            mFenceWatcher->Watch(fence, mLastSubmittedSerial);
+        }
 
         CommandPoolAndBuffer submittedCommands = {mRecordingContext.commandPool,
                                                   mRecordingContext.commandBuffer};
@@ -363,6 +393,28 @@ namespace dawn_native { namespace vulkan {
             extensionsToRequest.push_back(kExtensionNameKhrGetMemoryRequirements2);
             usedKnobs.memoryRequirements2 = true;
         }
+        if (mDeviceInfo.pushDescriptor && IsToggleEnabled(Toggle::VulkanUsePushDescriptors)) {
+            extensionsToRequest.push_back(kExtensionNameKhrPushDescriptor);
+            usedKnobs.pushDescriptor = true;
+        }
+
+        VkPhysicalDeviceDescriptorIndexingFeaturesEXT descriptorIndexingFeatures = {};
+        if (IsExtensionEnabled(Extension::DescriptorIndexing)) {
+            ASSERT(mDeviceInfo.descriptorIndexing && mDeviceInfo.maintenance3);
+            extensionsToRequest.push_back(kExtensionNameKhrMaintenance3);
+            extensionsToRequest.push_back(kExtensionNameExtDescriptorIndexing);
+            usedKnobs.maintenance3 = true;
+            usedKnobs.descriptorIndexing = true;
+
+            descriptorIndexingFeatures.sType =
+                VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+            descriptorIndexingFeatures.runtimeDescriptorArray = VK_TRUE;
+            descriptorIndexingFeatures.descriptorBindingPartiallyBound = VK_TRUE;
+            descriptorIndexingFeatures.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+            descriptorIndexingFeatures.descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+            descriptorIndexingFeatures.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+            descriptorIndexingFeatures.shaderStorageBufferArrayNonUniformIndexing = VK_TRUE;
+        }
 
         // Always require independentBlend because it is a core Dawn feature
         usedKnobs.features.independentBlend = VK_TRUE;
@@ -411,7 +463,7 @@ namespace dawn_native { namespace vulkan {
 
         VkDeviceCreateInfo createInfo;
         createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-        createInfo.pNext = nullptr;
+        createInfo.pNext = usedKnobs.descriptorIndexing ? &descriptorIndexingFeatures : nullptr;
         createInfo.flags = 0;
         createInfo.queueCreateInfoCount = static_cast<uint32_t>(queuesToRequest.size());
         createInfo.pQueueCreateInfos = queuesToRequest.data();
@@ -438,6 +490,14 @@ namespace dawn_native { namespace vulkan {
 
         // By default try to use D32S8 for Depth24PlusStencil8
         SetToggle(Toggle::VulkanUseD32S8, true);
+
+        // Merging render passes only saves bandwidth on tile-based GPUs, on the others it
+        // only costs CPU time to find the passes to merge.
+        const PCIInfo& pciInfo = GetAdapter()->GetPCIInfo();
+        bool isTileBased = gpu_info::IsARM(pciInfo.vendorId) ||
+                           gpu_info::IsImgTec(pciInfo.vendorId) ||
+                           gpu_info::IsQualcomm(pciInfo.vendorId);
+        SetToggle(Toggle::MergeRenderPasses, isTileBased);
     }
 
     void Device::ApplyDepth24PlusS8Toggle() {
@@ -501,19 +561,27 @@ namespace dawn_native { namespace vulkan {
             VkFence fence = mFencesInFlight.front().first;
             Serial fenceSerial = mFencesInFlight.front().second;
 
-            VkResult result = VkResult::WrapUnsafe(
-                INJECT_ERROR_OR_RUN(fn.GetFenceStatus(mVkDevice, fence), VK_ERROR_DEVICE_LOST));
-            // TODO: Handle DeviceLost error.
-            ASSERT(result == VK_SUCCESS || result == VK_NOT_READY);
-
-            // Fence are added in order, so we can stop searching as soon
-            // as we see one that's not ready.
-            if (result == VK_NOT_READY) {
-                return;
+            if (mFenceWatcher != nullptr) {
+                // The fence watcher might be waiting on the fence, so it can only be reused once
+                // the watcher has seen it pass.
+                if (fenceSerial > mFenceWatcher->GetCompletedSerial()) {
+                    return;
+                }
+            } else {
+                VkResult result = VkResult::WrapUnsafe(INJECT_ERROR_OR_RUN(
+                    fn.GetFenceStatus(mVkDevice, fence), VK_ERROR_DEVICE_LOST));
+                // TODO: Handle DeviceLost error.
+                ASSERT(result == VK_SUCCESS || result == VK_NOT_READY);
+
+                // Fence are added in order, so we can stop searching as soon
+                // as we see one that's not ready.
+                if (result == VK_NOT_READY) {
+                    return;
+                }
             }
 
             mUnusedFences.push_back(fence);
-            mFencesInFlight.pop();
+            mFencesInFlight.pop_front();
 
             ASSERT(fenceSerial > mCompletedSerial);
             mCompletedSerial = fenceSerial;
@@ -724,12 +792,118 @@ namespace dawn_native { namespace vulkan {
         return result;
     }
 
+    MaybeError Device::ImportExternalBuffer(const ExternalBufferDescriptor* descriptor,
+                                            ExternalMemoryHandle memoryHandle,
+                                            VkBuffer buffer,
+                                            const std::vector<ExternalSemaphoreHandle>& waitHandles,
+                                            VkSemaphore* outSignalSemaphore,
+                                            VkDeviceMemory* outAllocation,
+                                            std::vector<VkSemaphore>* outWaitSemaphores) {
+        if (!mExternalSemaphoreService->Supported()) {
+            return DAWN_VALIDATION_ERROR("External semaphore usage not supported");
+        }
+
+        // Create an external semaphore to signal when the buffer is done being used
+        DAWN_TRY_ASSIGN(*outSignalSemaphore,
+                        mExternalSemaphoreService->CreateExportableSemaphore());
+
+        // Import the external buffer's memory
+        external_memory::MemoryImportParams importParams;
+        DAWN_TRY_ASSIGN(importParams,
+                        mExternalMemoryService->GetBufferMemoryImportParams(descriptor, buffer));
+        DAWN_TRY_ASSIGN(*outAllocation, mExternalMemoryService->ImportBufferMemory(
+                                            memoryHandle, importParams, buffer));
+
+        // Import semaphores we have to wait on before using the buffer
+        for (const ExternalSemaphoreHandle& handle : waitHandles) {
+            VkSemaphore semaphore = VK_NULL_HANDLE;
+            DAWN_TRY_ASSIGN(semaphore, mExternalSemaphoreService->ImportSemaphore(handle));
+            outWaitSemaphores->push_back(semaphore);
+        }
+
+        return {};
+    }
+
+    MaybeError Device::SignalAndExportExternalBuffer(Buffer* buffer,
+                                                     ExternalSemaphoreHandle* outHandle) {
+        DAWN_TRY(ValidateObject(buffer));
+
+        VkSemaphore outSignalSemaphore;
+        DAWN_TRY(buffer->SignalAndDestroy(&outSignalSemaphore));
+
+        // This has to happen right after SignalAndDestroy, since the semaphore will be
+        // deleted when the fenced deleter runs after the queue submission
+        DAWN_TRY_ASSIGN(*outHandle, mExternalSemaphoreService->ExportSemaphore(outSignalSemaphore));
+
+        return {};
+    }
+
+    BufferBase* Device::CreateBufferWrappingVulkanMemory(
+        const ExternalBufferDescriptor* descriptor,
+        ExternalMemoryHandle memoryHandle,
+        const std::vector<ExternalSemaphoreHandle>& waitHandles) {
+        const BufferDescriptor* bufferDescriptor =
+            reinterpret_cast<const BufferDescriptor*>(descriptor->cBufferDescriptor);
+
+        // Initial validation
+        if (ConsumedError(ValidateVulkanBufferCanBeWrapped(this, bufferDescriptor))) {
+            return nullptr;
+        }
+        if (ConsumedError(ValidateBufferDescriptor(this, bufferDescriptor))) {
+            return nullptr;
+        }
+
+        VkSemaphore signalSemaphore = VK_NULL_HANDLE;
+        VkDeviceMemory allocation = VK_NULL_HANDLE;
+        std::vector<VkSemaphore> waitSemaphores;
+        waitSemaphores.reserve(waitHandles.size());
+
+        // Cleanup in case of a failure, the buffer creation doesn't acquire the external objects
+        // if a failure happens.
+        Buffer* result = nullptr;
+        if (ConsumedError(Buffer::CreateFromExternal(this, descriptor, bufferDescriptor,
+                                                     mExternalMemoryService.get()),
+                          &result) ||
+            ConsumedError(ImportExternalBuffer(descriptor, memoryHandle, result->GetHandle(),
+                                               waitHandles, &signalSemaphore, &allocation,
+                                               &waitSemaphores)) ||
+            ConsumedError(result->BindExternalMemory(signalSemaphore, allocation, waitSemaphores))) {
+            // Delete the Buffer if it was created
+            if (result != nullptr) {
+                delete result;
+            }
+
+            // Clear the signal semaphore
+            fn.DestroySemaphore(GetVkDevice(), signalSemaphore, nullptr);
+
+            // Clear buffer memory
+            fn.FreeMemory(GetVkDevice(), allocation, nullptr);
+
+            // Clear any wait semaphores we were able to import
+            for (VkSemaphore semaphore : waitSemaphores) {
+                fn.DestroySemaphore(GetVkDevice(), semaphore, nullptr);
+            }
+            return nullptr;
+        }
+
+        return result;
+    }
+
     ResultOrError<ResourceMemoryAllocation> Device::AllocateMemory(
         VkMemoryRequirements requirements,
         bool mappable) {
         return mResourceMemoryAllocator->Allocate(requirements, mappable);
     }
 
+    ResultOrError<ResourceMemoryAllocation> Device::AllocateMemoryForTransientAttachment(
+        VkMemoryRequirements requirements) {
+        return mResourceMemoryAllocator->AllocateForTransientAttachment(requirements);
+    }
+
+    ResultOrError<ResourceMemoryAllocation> Device::AllocateMemoryForHeap(uint64_t size) {
+        return mResourceMemoryAllocator->AllocateForHeap(size);
+    }
+
     void Device::DeallocateMemory(ResourceMemoryAllocation* allocation) {
         mResourceMemoryAllocator->Deallocate(allocation);
     }
@@ -742,6 +916,47 @@ namespace dawn_native { namespace vulkan {
         return mResourceMemoryAllocator.get();
     }
 
+    ResultOrError<bool> Device::WaitForSerialImpl(Serial serial, uint64_t timeoutNs) {
+        CheckPassedFences();
+        if (mCompletedSerial >= serial) {
+            return true;
+        }
+
+        if (mFenceWatcher != nullptr) {
+            bool completed = mFenceWatcher->WaitForSerial(serial, timeoutNs);
+            CheckPassedFences();
+            return completed;
+        }
+
+        // Fences pass in order so waiting on the first fence of a serial at least `serial` is
+        // enough.
+        auto it = std::find_if(mFencesInFlight.begin(), mFencesInFlight.end(),
+                               [serial](const std::pair<VkFence, Serial>& fenceAndSerial) {
+                                   return fenceAndSerial.second >= serial;
+                               });
+        ASSERT(it != mFencesInFlight.end());
+        VkFence fence = it->first;
+
+        VkResult result = VkResult::WrapUnsafe(INJECT_ERROR_OR_RUN(
+            fn.WaitForFences(mVkDevice, 1, &fence, true, timeoutNs), VK_ERROR_DEVICE_LOST));
+        if (result == VK_TIMEOUT) {
+            return false;
+        }
+        DAWN_TRY(CheckVkSuccess(result, "vkWaitForFences"));
+
+        CheckPassedFences();
+        return true;
+    }
+
+    bool Device::StartSignalingCompletion(PollableEvent* event) {
+        ASSERT(mFenceWatcher == nullptr);
+        mFenceWatcher = std::make_unique<FenceWatcher>(this, event, mCompletedSerial);
+        for (const std::pair<VkFence, Serial>& fenceAndSerial : mFencesInFlight) {
+            mFenceWatcher->Watch(fenceAndSerial.first, fenceAndSerial.second);
+        }
+        return true;
+    }
+
     MaybeError Device::WaitForIdleForDestruction() {
         VkResult waitIdleResult = VkResult::WrapUnsafe(fn.QueueWaitIdle(mQueue));
         // Ignore the result of QueueWaitIdle: it can return OOM which we can't really do anything
@@ -749,6 +964,9 @@ namespace dawn_native { namespace vulkan {
         // (so they are as good as waited on) or success.
         DAWN_UNUSED(waitIdleResult);
 
+        // All the fences passed so the fence watcher stops immediately.
+        mFenceWatcher = nullptr;
+
         CheckPassedFences();
 
         // Make sure all fences are complete by explicitly waiting on them all
@@ -768,15 +986,27 @@ namespace dawn_native { namespace vulkan {
             ASSERT(result == VK_SUCCESS);
             fn.DestroyFence(mVkDevice, fence, nullptr);
 
-            mFencesInFlight.pop();
+            mFencesInFlight.pop_front();
             mCompletedSerial = fenceSerial;
         }
         return {};
     }
 
+    void Device::ResetForTestingImpl() {
+        // The framebuffers are cached per texture view, so they are all evicted once the objects
+        // of the test are released, and cached descriptor sets are owned by bind groups. The
+        // render passes only depend on the formats and operations of the attachments, so
+        // keeping them for the next test isn't observable.
+        ASSERT(mFramebufferCache->GetCachedFramebufferCountForTesting() == 0);
+    }
+
     void Device::Destroy() {
         ASSERT(mLossStatus != LossStatus::AlreadyLost);
 
+        // Stop the fence watcher before any fence is destroyed. Its remaining fences pass since
+        // either the queue is idle or the device is lost.
+        mFenceWatcher = nullptr;
+
         // Immediately tag the recording context as unused so we don't try to submit it in Tick.
         mRecordingContext.used = false;
         fn.DestroyCommandPool(mVkDevice, mRecordingContext.commandPool, nullptr);
@@ -815,8 +1045,9 @@ namespace dawn_native { namespace vulkan {
 
         mMapRequestTracker = nullptr;
 
-        // The VkRenderPasses in the cache can be destroyed immediately since all commands referring
-        // to them are guaranteed to be finished executing.
+        // The VkFramebuffers and VkRenderPasses in the caches can be destroyed immediately since all
+        // commands referring to them are guaranteed to be finished executing.
+        mFramebufferCache = nullptr;
         mRenderPassCache = nullptr;
     }
 
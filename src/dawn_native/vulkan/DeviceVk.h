@@ -28,16 +28,19 @@
 #include "dawn_native/vulkan/external_memory/MemoryService.h"
 #include "dawn_native/vulkan/external_semaphore/SemaphoreService.h"
 
+#include <deque>
 #include <memory>
-#include <queue>
 
 namespace dawn_native { namespace vulkan {
 
     class Adapter;
     class BufferUploader;
+    class DescriptorSetCache;
     class DescriptorSetService;
     struct ExternalImageDescriptor;
     class FencedDeleter;
+    class FenceWatcher;
+    class FramebufferCache;
     class MapRequestTracker;
     class RenderPassCache;
     class ResourceMemoryAllocator;
@@ -59,8 +62,10 @@ namespace dawn_native { namespace vulkan {
         VkQueue GetQueue() const;
 
         BufferUploader* GetBufferUploader() const;
+        DescriptorSetCache* GetDescriptorSetCache() const;
         DescriptorSetService* GetDescriptorSetService() const;
         FencedDeleter* GetFencedDeleter() const;
+        FramebufferCache* GetFramebufferCache() const;
         MapRequestTracker* GetMapRequestTracker() const;
         RenderPassCache* GetRenderPassCache() const;
 
@@ -78,6 +83,14 @@ namespace dawn_native { namespace vulkan {
         MaybeError SignalAndExportExternalTexture(Texture* texture,
                                                   ExternalSemaphoreHandle* outHandle);
 
+        BufferBase* CreateBufferWrappingVulkanMemory(
+            const ExternalBufferDescriptor* descriptor,
+            ExternalMemoryHandle memoryHandle,
+            const std::vector<ExternalSemaphoreHandle>& waitHandles);
+
+        MaybeError SignalAndExportExternalBuffer(Buffer* buffer,
+                                                 ExternalSemaphoreHandle* outHandle);
+
         // Dawn API
         CommandBufferBase* CreateCommandBuffer(CommandEncoder* encoder,
                                                const CommandBufferDescriptor* descriptor) override;
@@ -95,6 +108,9 @@ namespace dawn_native { namespace vulkan {
 
         ResultOrError<ResourceMemoryAllocation> AllocateMemory(VkMemoryRequirements requirements,
                                                                bool mappable);
+        ResultOrError<ResourceMemoryAllocation> AllocateMemoryForTransientAttachment(
+            VkMemoryRequirements requirements);
+        ResultOrError<ResourceMemoryAllocation> AllocateMemoryForHeap(uint64_t size);
         void DeallocateMemory(ResourceMemoryAllocation* allocation);
 
         int FindBestMemoryTypeIndex(VkMemoryRequirements requirements, bool mappable);
@@ -110,11 +126,16 @@ namespace dawn_native { namespace vulkan {
             const RayTracingPipelineDescriptor* descriptor) override;
         ResultOrError<BindGroupBase*> CreateBindGroupImpl(
             const BindGroupDescriptor* descriptor) override;
+        ResultOrError<BindGroupBase*> CreateDerivedBindGroupImpl(
+            BindGroupBase* parent,
+            uint32_t bindingCount,
+            const BindGroupBinding* bindings) override;
         ResultOrError<BindGroupLayoutBase*> CreateBindGroupLayoutImpl(
             const BindGroupLayoutDescriptor* descriptor) override;
         ResultOrError<BufferBase*> CreateBufferImpl(const BufferDescriptor* descriptor) override;
         ResultOrError<ComputePipelineBase*> CreateComputePipelineImpl(
             const ComputePipelineDescriptor* descriptor) override;
+        ResultOrError<HeapBase*> CreateHeapImpl(const HeapDescriptor* descriptor) override;
         ResultOrError<PipelineLayoutBase*> CreatePipelineLayoutImpl(
             const PipelineLayoutDescriptor* descriptor) override;
         ResultOrError<QueueBase*> CreateQueueImpl() override;
@@ -138,6 +159,9 @@ namespace dawn_native { namespace vulkan {
 
         void Destroy() override;
         MaybeError WaitForIdleForDestruction() override;
+        void ResetForTestingImpl() override;
+        ResultOrError<bool> WaitForSerialImpl(Serial serial, uint64_t timeoutNs) override;
+        bool StartSignalingCompletion(PollableEvent* event) override;
 
         // To make it easier to use fn it is a public const member. However
         // the Device is allowed to mutate them through these private methods.
@@ -148,8 +172,10 @@ namespace dawn_native { namespace vulkan {
         uint32_t mQueueFamily = 0;
         VkQueue mQueue = VK_NULL_HANDLE;
 
+        std::unique_ptr<DescriptorSetCache> mDescriptorSetCache;
         std::unique_ptr<DescriptorSetService> mDescriptorSetService;
         std::unique_ptr<FencedDeleter> mDeleter;
+        std::unique_ptr<FramebufferCache> mFramebufferCache;
         std::unique_ptr<MapRequestTracker> mMapRequestTracker;
         std::unique_ptr<ResourceMemoryAllocator> mResourceMemoryAllocator;
         std::unique_ptr<RenderPassCache> mRenderPassCache;
@@ -164,9 +190,11 @@ namespace dawn_native { namespace vulkan {
         // This works only because we have a single queue. Each submit to a queue is associated
         // to a serial and a fence, such that when the fence is "ready" we know the operations
         // have finished.
-        std::queue<std::pair<VkFence, Serial>> mFencesInFlight;
+        std::deque<std::pair<VkFence, Serial>> mFencesInFlight;
         // Fences in the unused list aren't reset yet.
         std::vector<VkFence> mUnusedFences;
+        // Only created when the completion fd is requested.
+        std::unique_ptr<FenceWatcher> mFenceWatcher;
         Serial mCompletedSerial = 0;
         Serial mLastSubmittedSerial = 0;
 
@@ -190,6 +218,13 @@ namespace dawn_native { namespace vulkan {
                                        VkSemaphore* outSignalSemaphore,
                                        VkDeviceMemory* outAllocation,
                                        std::vector<VkSemaphore>* outWaitSemaphores);
+        MaybeError ImportExternalBuffer(const ExternalBufferDescriptor* descriptor,
+                                        ExternalMemoryHandle memoryHandle,
+                                        VkBuffer buffer,
+                                        const std::vector<ExternalSemaphoreHandle>& waitHandles,
+                                        VkSemaphore* outSignalSemaphore,
+                                        VkDeviceMemory* outAllocation,
+                                        std::vector<VkSemaphore>* outWaitSemaphores);
     };
 
 }}  // namespace dawn_native::vulkan
@@ -0,0 +1,99 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn_native/vulkan/FenceWatcher.h"
+
+#include "common/Assert.h"
+#include "dawn_native/PollableEvent.h"
+#include "dawn_native/vulkan/DeviceVk.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace dawn_native { namespace vulkan {
+
+    namespace {
+
+        // Longer timeouts are clamped so that computing the deadline can't overflow.
+        constexpr uint64_t kMaxTimeoutNs = uint64_t(3600) * 1000 * 1000 * 1000;
+
+    }  // anonymous namespace
+
+    FenceWatcher::FenceWatcher(Device* device, PollableEvent* event, Serial completedSerial)
+        : mDevice(device), mEvent(event), mCompletedSerial(completedSerial) {
+        mThread = std::thread(&FenceWatcher::ThreadMain, this);
+    }
+
+    FenceWatcher::~FenceWatcher() {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStopping = true;
+        }
+        mCondition.notify_all();
+        mThread.join();
+    }
+
+    void FenceWatcher::Watch(VkFence fence, Serial serial) {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            ASSERT(serial > mCompletedSerial);
+            mFences.emplace(fence, serial);
+        }
+        mCondition.notify_all();
+    }
+
+    Serial FenceWatcher::GetCompletedSerial() {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mCompletedSerial;
+    }
+
+    bool FenceWatcher::WaitForSerial(Serial serial, uint64_t timeoutNs) {
+        std::unique_lock<std::mutex> lock(mMutex);
+        auto IsCompleted = [this, serial]() { return mCompletedSerial >= serial; };
+
+        if (timeoutNs == UINT64_MAX) {
+            mCondition.wait(lock, IsCompleted);
+            return true;
+        }
+        return mCondition.wait_for(
+            lock, std::chrono::nanoseconds(std::min(timeoutNs, kMaxTimeoutNs)), IsCompleted);
+    }
+
+    void FenceWatcher::ThreadMain() {
+        std::unique_lock<std::mutex> lock(mMutex);
+        while (true) {
+            mCondition.wait(lock, [this]() { return mStopping || !mFences.empty(); });
+            if (mFences.empty()) {
+                return;
+            }
+
+            VkFence fence = mFences.front().first;
+            Serial fenceSerial = mFences.front().second;
+
+            lock.unlock();
+            VkResult result = VkResult::WrapUnsafe(
+                mDevice->fn.WaitForFences(mDevice->GetVkDevice(), 1, &fence, true, UINT64_MAX));
+            // The fence will never pass if the device is lost, so consider it passed to avoid
+            // blocking waiters and the destruction of the device.
+            ASSERT(result == VK_SUCCESS || result == VK_ERROR_DEVICE_LOST);
+            lock.lock();
+
+            mFences.pop();
+            mCompletedSerial = fenceSerial;
+            mCondition.notify_all();
+            mEvent->Signal();
+        }
+    }
+
+}}  // namespace dawn_native::vulkan
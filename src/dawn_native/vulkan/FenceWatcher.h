@@ -0,0 +1,68 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_VULKAN_FENCEWATCHER_H_
+#define DAWNNATIVE_VULKAN_FENCEWATCHER_H_
+
+#include "common/Serial.h"
+#include "common/vulkan_platform.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+namespace dawn_native {
+    class PollableEvent;
+}  // namespace dawn_native
+
+namespace dawn_native { namespace vulkan {
+
+    class Device;
+
+    // FenceWatcher waits on the submitted fences on its own thread and signals the device's
+    // completion event as soon as each of them passes, so that the application doesn't need to
+    // tick the device to know when callbacks are ready. While it runs it is the only one waiting
+    // on the fences: the device must not reset a fence before the watcher has seen it pass.
+    class FenceWatcher {
+      public:
+        FenceWatcher(Device* device, PollableEvent* event, Serial completedSerial);
+        // Waits for the remaining fences to pass, which they do once the queue is idle or the
+        // device is lost.
+        ~FenceWatcher();
+
+        void Watch(VkFence fence, Serial serial);
+        Serial GetCompletedSerial();
+        // Blocks until the fence of `serial` passed or `timeoutNs` nanoseconds elapsed and
+        // returns whether it passed.
+        bool WaitForSerial(Serial serial, uint64_t timeoutNs);
+
+      private:
+        void ThreadMain();
+
+        Device* mDevice = nullptr;
+        PollableEvent* mEvent = nullptr;
+
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+        std::queue<std::pair<VkFence, Serial>> mFences;
+        Serial mCompletedSerial = 0;
+        bool mStopping = false;
+
+        std::thread mThread;
+    };
+
+}}  // namespace dawn_native::vulkan
+
+#endif  // DAWNNATIVE_VULKAN_FENCEWATCHER_H_
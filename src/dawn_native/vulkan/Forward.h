@@ -27,6 +27,7 @@ namespace dawn_native { namespace vulkan {
     class CommandBuffer;
     class ComputePipeline;
     class Device;
+    class Heap;
     class PipelineLayout;
     class Queue;
     class RayTracingAccelerationContainer;
@@ -49,6 +50,7 @@ namespace dawn_native { namespace vulkan {
         using CommandBufferType = CommandBuffer;
         using ComputePipelineType = ComputePipeline;
         using DeviceType = Device;
+        using HeapType = Heap;
         using PipelineLayoutType = PipelineLayout;
         using QueueType = Queue;
         using RayTracingAccelerationContainerType = RayTracingAccelerationContainer;
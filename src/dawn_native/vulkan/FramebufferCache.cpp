@@ -0,0 +1,171 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn_native/vulkan/FramebufferCache.h"
+
+#include "common/HashUtils.h"
+#include "dawn_native/vulkan/DeviceVk.h"
+#include "dawn_native/vulkan/FencedDeleter.h"
+#include "dawn_native/vulkan/VulkanError.h"
+#include "dawn_platform/DawnPlatform.h"
+#include "dawn_platform/tracing/TraceEvent.h"
+
+namespace dawn_native { namespace vulkan {
+
+    FramebufferCache::FramebufferCache(Device* device) : mDevice(device) {
+    }
+
+    FramebufferCache::~FramebufferCache() {
+        for (auto it : mCache) {
+            mDevice->fn.DestroyFramebuffer(mDevice->GetVkDevice(), it.second, nullptr);
+        }
+        mCache.clear();
+    }
+
+    ResultOrError<VkFramebuffer> FramebufferCache::GetFramebuffer(
+        const FramebufferCacheQuery& query) {
+        auto it = mCache.find(query);
+        if (it != mCache.end()) {
+            return VkFramebuffer(it->second);
+        }
+
+        VkFramebuffer framebuffer;
+        DAWN_TRY_ASSIGN(framebuffer, CreateFramebufferForQuery(query));
+        mCache.emplace(query, framebuffer);
+        for (uint32_t i = 0; i < query.attachmentCount; ++i) {
+            mQueriesUsingView[query.attachments[i].GetU64()].push_back(query);
+        }
+        mCreationCount++;
+
+        // Profiles show the framebuffers created in each frame as the increase of the creation
+        // count over the frame.
+        TRACE_COUNTER1(mDevice->GetPlatform(), General, "FramebufferCache::CreationCount",
+                       mCreationCount);
+        TRACE_COUNTER1(mDevice->GetPlatform(), General, "FramebufferCache::CachedCount",
+                       mCache.size());
+        return framebuffer;
+    }
+
+    void FramebufferCache::OnViewDestroyed(VkImageView view) {
+        auto queriesIt = mQueriesUsingView.find(view.GetU64());
+        if (queriesIt == mQueriesUsingView.end()) {
+            return;
+        }
+
+        // Take the queries out first because forgetting them for the other attachments modifies
+        // mQueriesUsingView.
+        std::vector<FramebufferCacheQuery> queries = std::move(queriesIt->second);
+        mQueriesUsingView.erase(queriesIt);
+
+        for (const FramebufferCacheQuery& query : queries) {
+            auto it = mCache.find(query);
+            if (it == mCache.end()) {
+                // The view is used more than once in the query and it was already evicted.
+                continue;
+            }
+            mDevice->GetFencedDeleter()->DeleteWhenUnused(it->second);
+            mCache.erase(it);
+            TRACE_COUNTER1(mDevice->GetPlatform(), General, "FramebufferCache::CachedCount",
+                           mCache.size());
+
+            for (uint32_t i = 0; i < query.attachmentCount; ++i) {
+                if (query.attachments[i] != view) {
+                    ForgetQueryUsingView(query, query.attachments[i]);
+                }
+            }
+        }
+    }
+
+    void FramebufferCache::ForgetQueryUsingView(const FramebufferCacheQuery& query,
+                                                VkImageView view) {
+        auto queriesIt = mQueriesUsingView.find(view.GetU64());
+        if (queriesIt == mQueriesUsingView.end()) {
+            return;
+        }
+
+        std::vector<FramebufferCacheQuery>& queries = queriesIt->second;
+        CacheFuncs equal;
+        for (size_t i = 0; i < queries.size(); ++i) {
+            if (equal(queries[i], query)) {
+                queries[i] = queries.back();
+                queries.pop_back();
+                break;
+            }
+        }
+        if (queries.empty()) {
+            mQueriesUsingView.erase(queriesIt);
+        }
+    }
+
+    uint64_t FramebufferCache::GetCreationCount() const {
+        return mCreationCount;
+    }
+
+    size_t FramebufferCache::GetCachedFramebufferCountForTesting() const {
+        return mCache.size();
+    }
+
+    size_t FramebufferCache::GetTrackedQueryCountForTesting() const {
+        size_t count = 0;
+        for (const auto& it : mQueriesUsingView) {
+            count += it.second.size();
+        }
+        return count;
+    }
+
+    ResultOrError<VkFramebuffer> FramebufferCache::CreateFramebufferForQuery(
+        const FramebufferCacheQuery& query) const {
+        VkFramebufferCreateInfo createInfo;
+        createInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = 0;
+        createInfo.renderPass = query.renderPass;
+        createInfo.attachmentCount = query.attachmentCount;
+        createInfo.pAttachments = query.attachments.data();
+        createInfo.width = query.width;
+        createInfo.height = query.height;
+        createInfo.layers = 1;
+
+        VkFramebuffer framebuffer;
+        DAWN_TRY(CheckVkSuccess(mDevice->fn.CreateFramebuffer(mDevice->GetVkDevice(), &createInfo,
+                                                              nullptr, &framebuffer),
+                                "CreateFramebuffer"));
+        return framebuffer;
+    }
+
+    size_t FramebufferCache::CacheFuncs::operator()(const FramebufferCacheQuery& query) const {
+        size_t hash = Hash(query.renderPass.GetU64());
+        HashCombine(&hash, query.attachmentCount, query.width, query.height);
+        for (uint32_t i = 0; i < query.attachmentCount; ++i) {
+            HashCombine(&hash, query.attachments[i].GetU64());
+        }
+        return hash;
+    }
+
+    bool FramebufferCache::CacheFuncs::operator()(const FramebufferCacheQuery& a,
+                                                  const FramebufferCacheQuery& b) const {
+        if (a.renderPass != b.renderPass || a.attachmentCount != b.attachmentCount ||
+            a.width != b.width || a.height != b.height) {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < a.attachmentCount; ++i) {
+            if (a.attachments[i] != b.attachments[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+}}  // namespace dawn_native::vulkan
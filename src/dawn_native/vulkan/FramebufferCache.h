@@ -0,0 +1,84 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_VULKAN_FRAMEBUFFERCACHE_H_
+#define DAWNNATIVE_VULKAN_FRAMEBUFFERCACHE_H_
+
+#include "common/Constants.h"
+#include "common/vulkan_platform.h"
+#include "dawn_native/Error.h"
+
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+namespace dawn_native { namespace vulkan {
+
+    class Device;
+
+    // The key to query the FramebufferCache. The attachments are in the "color-depthstencil-resolve"
+    // order used by the RenderPassCache, only the first |attachmentCount| ones are relevant.
+    struct FramebufferCacheQuery {
+        VkRenderPass renderPass = VK_NULL_HANDLE;
+        uint32_t attachmentCount = 0;
+        std::array<VkImageView, kMaxColorAttachments * 2 + 1> attachments;
+        uint32_t width = 0;
+        uint32_t height = 0;
+    };
+
+    // Caches VkFramebuffers so that render passes using the same attachments every frame don't
+    // create and destroy a framebuffer each time. VkRenderPasses are never destroyed before the
+    // device, so the framebuffers only need to be invalidated when one of their views is destroyed.
+    class FramebufferCache {
+      public:
+        FramebufferCache(Device* device);
+        ~FramebufferCache();
+
+        ResultOrError<VkFramebuffer> GetFramebuffer(const FramebufferCacheQuery& query);
+
+        // Removes the framebuffers using |view| from the cache. They are deleted once the commands
+        // using them are finished.
+        void OnViewDestroyed(VkImageView view);
+
+        // The number of VkFramebuffers created since the creation of the device.
+        uint64_t GetCreationCount() const;
+
+        size_t GetCachedFramebufferCountForTesting() const;
+        // The number of (view, query) pairs used to find the framebuffers to invalidate.
+        size_t GetTrackedQueryCountForTesting() const;
+
+      private:
+        ResultOrError<VkFramebuffer> CreateFramebufferForQuery(
+            const FramebufferCacheQuery& query) const;
+        void ForgetQueryUsingView(const FramebufferCacheQuery& query, VkImageView view);
+
+        struct CacheFuncs {
+            size_t operator()(const FramebufferCacheQuery& query) const;
+            bool operator()(const FramebufferCacheQuery& a, const FramebufferCacheQuery& b) const;
+        };
+        using Cache =
+            std::unordered_map<FramebufferCacheQuery, VkFramebuffer, CacheFuncs, CacheFuncs>;
+
+        Device* mDevice = nullptr;
+        Cache mCache;
+        // The queries of the framebuffers using each view, to invalidate them without going
+        // through the whole cache. Evicting a framebuffer removes its query for all of its views
+        // so that this only tracks cached framebuffers. Views are keyed by their 64bit handle.
+        std::unordered_map<uint64_t, std::vector<FramebufferCacheQuery>> mQueriesUsingView;
+        uint64_t mCreationCount = 0;
+    };
+
+}}  // namespace dawn_native::vulkan
+
+#endif  // DAWNNATIVE_VULKAN_FRAMEBUFFERCACHE_H_
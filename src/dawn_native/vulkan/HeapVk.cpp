@@ -0,0 +1,138 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dawn_native/vulkan/HeapVk.h"
+
+#include "dawn_native/vulkan/CommandRecordingContext.h"
+#include "dawn_native/vulkan/DeviceVk.h"
+#include "dawn_native/vulkan/ResourceHeapVk.h"
+
+#include <algorithm>
+
+namespace dawn_native { namespace vulkan {
+
+    // static
+    ResultOrError<Heap*> Heap::Create(Device* device, const HeapDescriptor* descriptor) {
+        std::unique_ptr<Heap> heap = std::make_unique<Heap>(device, descriptor);
+        DAWN_TRY(heap->Initialize());
+        return heap.release();
+    }
+
+    MaybeError Heap::Initialize() {
+        // Same as for buffers, avoid passing sizes close to the maximum VkDeviceSize to drivers.
+        if (GetSize() & (uint64_t(3) << uint64_t(62))) {
+            return DAWN_OUT_OF_MEMORY_ERROR("Heap size is HUGE and could cause overflows");
+        }
+
+        Device* device = ToBackend(GetDevice());
+        DAWN_TRY_ASSIGN(mMemoryAllocation, device->AllocateMemoryForHeap(GetSize()));
+        mBufferImageGranularity =
+            device->GetDeviceInfo().properties.limits.bufferImageGranularity;
+        return {};
+    }
+
+    Heap::~Heap() {
+        // The resources placed in the heap keep a reference to it so they are all destroyed.
+        ToBackend(GetDevice())->DeallocateMemory(&mMemoryAllocation);
+    }
+
+    ResultOrError<ResourceMemoryAllocation> Heap::PlaceResource(
+        const VkMemoryRequirements& requirements,
+        uint64_t offset) const {
+        ResourceHeap* resourceHeap = ToBackend(mMemoryAllocation.GetResourceHeap());
+        if ((requirements.memoryTypeBits & (1u << resourceHeap->GetMemoryType())) == 0) {
+            return DAWN_VALIDATION_ERROR("The resource can't be placed in the memory of the heap");
+        }
+
+        if (offset % requirements.alignment != 0) {
+            return DAWN_VALIDATION_ERROR("Placed resource offset isn't aligned enough");
+        }
+
+        if (offset > GetSize() || requirements.size > GetSize() - offset) {
+            return DAWN_VALIDATION_ERROR("Placed resource doesn't fit in the heap");
+        }
+
+        AllocationInfo info;
+        info.mMethod = AllocationMethod::kPlaced;
+        return ResourceMemoryAllocation(info, offset, resourceHeap);
+    }
+
+    bool Heap::AcquireRange(CommandRecordingContext* recordingContext,
+                            const void* resource,
+                            Tiling tiling,
+                            uint64_t offset,
+                            uint64_t size) {
+        uint64_t granularity = mBufferImageGranularity;
+        auto Overlaps = [tiling, offset, size, granularity](const Range& range) {
+            if (range.tiling == tiling) {
+                return range.offset < offset + size && offset < range.offset + range.size;
+            }
+            // Compare the pages of bufferImageGranularity bytes the ranges touch instead.
+            uint64_t firstPage = offset / granularity;
+            uint64_t lastPage = (offset + size - 1) / granularity;
+            uint64_t rangeFirstPage = range.offset / granularity;
+            uint64_t rangeLastPage = (range.offset + range.size - 1) / granularity;
+            return rangeFirstPage <= lastPage && firstPage <= rangeLastPage;
+        };
+
+        bool usedByOtherResource = false;
+        bool usedByResource = false;
+        for (const Range& range : mUsedRanges) {
+            if (Overlaps(range)) {
+                if (range.resource == resource) {
+                    usedByResource = true;
+                } else {
+                    usedByOtherResource = true;
+                }
+            }
+        }
+
+        if (!usedByOtherResource) {
+            if (!usedByResource) {
+                mUsedRanges.push_back({resource, tiling, offset, size});
+            }
+            return false;
+        }
+
+        // The resources that used the range lose their content, they will acquire it again
+        // before their next use.
+        mUsedRanges.erase(std::remove_if(mUsedRanges.begin(), mUsedRanges.end(), Overlaps),
+                          mUsedRanges.end());
+        mUsedRanges.push_back({resource, tiling, offset, size});
+
+        // We don't track how the memory was used by the other resources, so wait for all the
+        // previous commands and make all their writes available.
+        VkMemoryBarrier barrier;
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.pNext = nullptr;
+        barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+
+        ToBackend(GetDevice())
+            ->fn.CmdPipelineBarrier(recordingContext->commandBuffer,
+                                    VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                    VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &barrier, 0, nullptr,
+                                    0, nullptr);
+        return true;
+    }
+
+    void Heap::ReleaseRanges(const void* resource) {
+        for (Range& range : mUsedRanges) {
+            if (range.resource == resource) {
+                range.resource = nullptr;
+            }
+        }
+    }
+
+}}  // namespace dawn_native::vulkan
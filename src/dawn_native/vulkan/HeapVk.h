@@ -0,0 +1,80 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DAWNNATIVE_VULKAN_HEAPVK_H_
+#define DAWNNATIVE_VULKAN_HEAPVK_H_
+
+#include "dawn_native/Heap.h"
+
+#include "common/vulkan_platform.h"
+#include "dawn_native/Error.h"
+#include "dawn_native/ResourceMemoryAllocation.h"
+
+#include <vector>
+
+namespace dawn_native { namespace vulkan {
+
+    struct CommandRecordingContext;
+    class Device;
+
+    class Heap : public HeapBase {
+      public:
+        static ResultOrError<Heap*> Create(Device* device, const HeapDescriptor* descriptor);
+        ~Heap();
+
+        // Returns the memory of a resource with these requirements placed at `offset`, or a
+        // validation error if it doesn't fit or can't use the memory type of the heap.
+        ResultOrError<ResourceMemoryAllocation> PlaceResource(
+            const VkMemoryRequirements& requirements,
+            uint64_t offset) const;
+
+        // Buffers are linear resources and textures are optimal ones. Linear and optimal resources
+        // alias when they share a page of bufferImageGranularity bytes, even if their memory
+        // ranges don't overlap.
+        enum class Tiling { Linear, Optimal };
+
+        // Called before `resource` uses its memory [offset, offset + size). If another resource
+        // used memory aliasing it since the last call for `resource`, records a barrier that
+        // makes the previous accesses available and returns true: the caller must then consider
+        // its content as undefined.
+        bool AcquireRange(CommandRecordingContext* recordingContext,
+                          const void* resource,
+                          Tiling tiling,
+                          uint64_t offset,
+                          uint64_t size);
+        // Called when `resource` is destroyed. Its range still counts as used so that the next
+        // resource using that memory waits for its accesses.
+        void ReleaseRanges(const void* resource);
+
+      private:
+        using HeapBase::HeapBase;
+        MaybeError Initialize();
+
+        ResourceMemoryAllocation mMemoryAllocation;
+
+        struct Range {
+            // nullptr once the resource is destroyed.
+            const void* resource;
+            Tiling tiling;
+            uint64_t offset;
+            uint64_t size;
+        };
+        // The ranges of memory last used by each resource, they never alias.
+        std::vector<Range> mUsedRanges;
+        uint64_t mBufferImageGranularity = 1;
+    };
+
+}}  // namespace dawn_native::vulkan
+
+#endif  // DAWNNATIVE_VULKAN_HEAPVK_H_
@@ -18,6 +18,7 @@
 #include "dawn_native/vulkan/FencedDeleter.h"
 #include "dawn_native/vulkan/TextureVk.h"
 
+#include <algorithm>
 #include <limits>
 
 namespace dawn_native { namespace vulkan {
@@ -26,26 +27,37 @@ namespace dawn_native { namespace vulkan {
 
         bool chooseSwapPresentMode(const std::vector<VkPresentModeKHR>& availablePresentModes,
                                    bool turnOffVsync,
+                                   bool useMailbox,
                                    VkPresentModeKHR* presentMode) {
+            auto IsAvailable = [&](VkPresentModeKHR mode) {
+                return std::find(availablePresentModes.begin(), availablePresentModes.end(),
+                                 mode) != availablePresentModes.end();
+            };
+
             if (turnOffVsync) {
-                for (const auto& availablePresentMode : availablePresentModes) {
-                    if (availablePresentMode == VK_PRESENT_MODE_IMMEDIATE_KHR) {
-                        *presentMode = availablePresentMode;
-                        return true;
-                    }
+                if (IsAvailable(VK_PRESENT_MODE_IMMEDIATE_KHR)) {
+                    *presentMode = VK_PRESENT_MODE_IMMEDIATE_KHR;
+                    return true;
                 }
                 return false;
             }
 
+            // FIFO is always supported so it is the fallback when MAILBOX isn't.
+            if (useMailbox && IsAvailable(VK_PRESENT_MODE_MAILBOX_KHR)) {
+                *presentMode = VK_PRESENT_MODE_MAILBOX_KHR;
+                return true;
+            }
+
             *presentMode = VK_PRESENT_MODE_FIFO_KHR;
             return true;
         }
 
         bool ChooseSurfaceConfig(const VulkanSurfaceInfo& info,
                                  NativeSwapChainImpl::ChosenConfig* config,
-                                 bool turnOffVsync) {
+                                 bool turnOffVsync,
+                                 bool useMailbox) {
             VkPresentModeKHR presentMode;
-            if (!chooseSwapPresentMode(info.presentModes, turnOffVsync, &presentMode)) {
+            if (!chooseSwapPresentMode(info.presentModes, turnOffVsync, useMailbox, &presentMode)) {
                 return false;
             }
             // TODO(cwallez@chromium.org): For now this is hardcoded to what works with one NVIDIA
@@ -85,7 +97,8 @@ namespace dawn_native { namespace vulkan {
             ASSERT(false);
         }
 
-        if (!ChooseSurfaceConfig(mInfo, &mConfig, mDevice->IsToggleEnabled(Toggle::TurnOffVsync))) {
+        if (!ChooseSurfaceConfig(mInfo, &mConfig, mDevice->IsToggleEnabled(Toggle::TurnOffVsync),
+                                 mDevice->IsToggleEnabled(Toggle::VulkanUseMailboxPresentMode))) {
             ASSERT(false);
         }
     }
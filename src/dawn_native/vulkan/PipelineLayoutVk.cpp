@@ -37,11 +37,31 @@ namespace dawn_native { namespace vulkan {
         // TODO(cwallez@chromium.org) Vulkan doesn't allow holes in this array, should we expose
         // this constraints at the Dawn level?
         uint32_t numSetLayouts = 0;
+        uint32_t pushSetLayout = 0;
+        bool pushSetHasDynamicOffsets = false;
         std::array<VkDescriptorSetLayout, kMaxBindGroups> setLayouts;
         for (uint32_t setIndex : IterateBitSet(GetBindGroupLayoutsMask())) {
-            setLayouts[numSetLayouts] = ToBackend(GetBindGroupLayout(setIndex))->GetHandle();
+            const BindGroupLayout* bindGroupLayout = ToBackend(GetBindGroupLayout(setIndex));
+
+            // Only one set can use push descriptors. Prefer the last one with dynamic offsets,
+            // which is usually the per-object uniform buffer whose offset changes for each draw,
+            // and otherwise the last one since the sets with higher indices change more often.
+            if (bindGroupLayout->CanUsePushDescriptors()) {
+                bool hasDynamicOffsets = bindGroupLayout->GetBindingInfo().hasDynamicOffset.any();
+                if (hasDynamicOffsets || !pushSetHasDynamicOffsets) {
+                    mPushDescriptorSet = setIndex;
+                    pushSetLayout = numSetLayouts;
+                    pushSetHasDynamicOffsets = hasDynamicOffsets;
+                }
+            }
+
+            setLayouts[numSetLayouts] = bindGroupLayout->GetHandle();
             numSetLayouts++;
         }
+        if (mPushDescriptorSet != kMaxBindGroups) {
+            setLayouts[pushSetLayout] =
+                ToBackend(GetBindGroupLayout(mPushDescriptorSet))->GetPushHandle();
+        }
 
         VkPipelineLayoutCreateInfo createInfo;
         createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
@@ -69,4 +89,8 @@ namespace dawn_native { namespace vulkan {
         return mHandle;
     }
 
+    uint32_t PipelineLayout::GetPushDescriptorSet() const {
+        return mPushDescriptorSet;
+    }
+
 }}  // namespace dawn_native::vulkan
@@ -32,11 +32,16 @@ namespace dawn_native { namespace vulkan {
 
         VkPipelineLayout GetHandle() const;
 
+        // The set whose descriptors are pushed in the command buffer instead of being bound from
+        // the descriptor set of the bind group, or kMaxBindGroups if there is none.
+        uint32_t GetPushDescriptorSet() const;
+
       private:
         using PipelineLayoutBase::PipelineLayoutBase;
         MaybeError Initialize();
 
         VkPipelineLayout mHandle = VK_NULL_HANDLE;
+        uint32_t mPushDescriptorSet = kMaxBindGroups;
     };
 
 }}  // namespace dawn_native::vulkan
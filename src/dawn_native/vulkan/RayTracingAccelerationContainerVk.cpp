@@ -15,6 +15,7 @@
 #include "dawn_native/vulkan/RayTracingAccelerationContainerVk.h"
 #include "dawn_native/vulkan/ResourceHeapVk.h"
 
+#include "dawn_native/vulkan/DescriptorSetCache.h"
 #include "dawn_native/vulkan/DeviceVk.h"
 #include "dawn_native/vulkan/FencedDeleter.h"
 #include "dawn_native/vulkan/UtilsVulkan.h"
@@ -181,6 +182,9 @@ namespace dawn_native { namespace vulkan {
 
     void RayTracingAccelerationContainer::DestroyImpl() {
         Device* device = ToBackend(GetDevice());
+        if (device->IsToggleEnabled(Toggle::VulkanCacheDescriptorSets)) {
+            device->GetDescriptorSetCache()->InvalidateEntriesUsing(this);
+        }
         DestroyScratchBuildMemory();
         if (mScratchMemory.result.buffer != VK_NULL_HANDLE) {
             Buffer* buffer = mScratchMemory.result.allocation.Get();
@@ -33,6 +33,19 @@ namespace dawn_native { namespace vulkan {
                     UNREACHABLE();
             }
         }
+
+        // The content of attachments with the Clear store op is discarded, the frontend takes care
+        // of clearing them before they are used again.
+        VkAttachmentStoreOp VulkanAttachmentStoreOp(wgpu::StoreOp op) {
+            switch (op) {
+                case wgpu::StoreOp::Store:
+                    return VK_ATTACHMENT_STORE_OP_STORE;
+                case wgpu::StoreOp::Clear:
+                    return VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                default:
+                    UNREACHABLE();
+            }
+        }
     }  // anonymous namespace
 
     // RenderPassCacheQuery
@@ -40,20 +53,26 @@ namespace dawn_native { namespace vulkan {
     void RenderPassCacheQuery::SetColor(uint32_t index,
                                         wgpu::TextureFormat format,
                                         wgpu::LoadOp loadOp,
+                                        wgpu::StoreOp storeOp,
                                         bool hasResolveTarget) {
         colorMask.set(index);
         colorFormats[index] = format;
         colorLoadOp[index] = loadOp;
+        colorStoreOp[index] = storeOp;
         resolveTargetMask[index] = hasResolveTarget;
     }
 
     void RenderPassCacheQuery::SetDepthStencil(wgpu::TextureFormat format,
                                                wgpu::LoadOp depthLoadOp,
-                                               wgpu::LoadOp stencilLoadOp) {
+                                               wgpu::StoreOp depthStoreOp,
+                                               wgpu::LoadOp stencilLoadOp,
+                                               wgpu::StoreOp stencilStoreOp) {
         hasDepthStencil = true;
         depthStencilFormat = format;
         this->depthLoadOp = depthLoadOp;
+        this->depthStoreOp = depthStoreOp;
         this->stencilLoadOp = stencilLoadOp;
+        this->stencilStoreOp = stencilStoreOp;
     }
 
     void RenderPassCacheQuery::SetSampleCount(uint32_t sampleCount) {
@@ -111,7 +130,7 @@ namespace dawn_native { namespace vulkan {
             attachmentDesc.format = VulkanImageFormat(mDevice, query.colorFormats[i]);
             attachmentDesc.samples = vkSampleCount;
             attachmentDesc.loadOp = VulkanAttachmentLoadOp(query.colorLoadOp[i]);
-            attachmentDesc.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+            attachmentDesc.storeOp = VulkanAttachmentStoreOp(query.colorStoreOp[i]);
             attachmentDesc.initialLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
             attachmentDesc.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
 
@@ -132,9 +151,9 @@ namespace dawn_native { namespace vulkan {
             attachmentDesc.format = VulkanImageFormat(mDevice, query.depthStencilFormat);
             attachmentDesc.samples = vkSampleCount;
             attachmentDesc.loadOp = VulkanAttachmentLoadOp(query.depthLoadOp);
-            attachmentDesc.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+            attachmentDesc.storeOp = VulkanAttachmentStoreOp(query.depthStoreOp);
             attachmentDesc.stencilLoadOp = VulkanAttachmentLoadOp(query.stencilLoadOp);
-            attachmentDesc.stencilStoreOp = VK_ATTACHMENT_STORE_OP_STORE;
+            attachmentDesc.stencilStoreOp = VulkanAttachmentStoreOp(query.stencilStoreOp);
             attachmentDesc.initialLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
             attachmentDesc.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
 
@@ -205,12 +224,14 @@ namespace dawn_native { namespace vulkan {
         HashCombine(&hash, Hash(query.resolveTargetMask));
 
         for (uint32_t i : IterateBitSet(query.colorMask)) {
-            HashCombine(&hash, query.colorFormats[i], query.colorLoadOp[i]);
+            HashCombine(&hash, query.colorFormats[i], query.colorLoadOp[i],
+                        query.colorStoreOp[i]);
         }
 
         HashCombine(&hash, query.hasDepthStencil);
         if (query.hasDepthStencil) {
-            HashCombine(&hash, query.depthStencilFormat, query.depthLoadOp, query.stencilLoadOp);
+            HashCombine(&hash, query.depthStencilFormat, query.depthLoadOp, query.depthStoreOp,
+                        query.stencilLoadOp, query.stencilStoreOp);
         }
 
         HashCombine(&hash, query.sampleCount);
@@ -234,7 +255,8 @@ namespace dawn_native { namespace vulkan {
 
         for (uint32_t i : IterateBitSet(a.colorMask)) {
             if ((a.colorFormats[i] != b.colorFormats[i]) ||
-                (a.colorLoadOp[i] != b.colorLoadOp[i])) {
+                (a.colorLoadOp[i] != b.colorLoadOp[i]) ||
+                (a.colorStoreOp[i] != b.colorStoreOp[i])) {
                 return false;
             }
         }
@@ -245,7 +267,8 @@ namespace dawn_native { namespace vulkan {
 
         if (a.hasDepthStencil) {
             if ((a.depthStencilFormat != b.depthStencilFormat) ||
-                (a.depthLoadOp != b.depthLoadOp) || (a.stencilLoadOp != b.stencilLoadOp)) {
+                (a.depthLoadOp != b.depthLoadOp) || (a.depthStoreOp != b.depthStoreOp) ||
+                (a.stencilLoadOp != b.stencilLoadOp) || (a.stencilStoreOp != b.stencilStoreOp)) {
                 return false;
             }
         }
@@ -37,21 +37,27 @@ namespace dawn_native { namespace vulkan {
         void SetColor(uint32_t index,
                       wgpu::TextureFormat format,
                       wgpu::LoadOp loadOp,
+                      wgpu::StoreOp storeOp,
                       bool hasResolveTarget);
         void SetDepthStencil(wgpu::TextureFormat format,
                              wgpu::LoadOp depthLoadOp,
-                             wgpu::LoadOp stencilLoadOp);
+                             wgpu::StoreOp depthStoreOp,
+                             wgpu::LoadOp stencilLoadOp,
+                             wgpu::StoreOp stencilStoreOp);
         void SetSampleCount(uint32_t sampleCount);
 
         std::bitset<kMaxColorAttachments> colorMask;
         std::bitset<kMaxColorAttachments> resolveTargetMask;
         std::array<wgpu::TextureFormat, kMaxColorAttachments> colorFormats;
         std::array<wgpu::LoadOp, kMaxColorAttachments> colorLoadOp;
+        std::array<wgpu::StoreOp, kMaxColorAttachments> colorStoreOp;
 
         bool hasDepthStencil = false;
         wgpu::TextureFormat depthStencilFormat;
         wgpu::LoadOp depthLoadOp;
+        wgpu::StoreOp depthStoreOp;
         wgpu::LoadOp stencilLoadOp;
+        wgpu::StoreOp stencilStoreOp;
 
         uint32_t sampleCount;
     };
@@ -333,12 +333,15 @@ namespace dawn_native { namespace vulkan {
         Device* device = ToBackend(GetDevice());
 
         VkPipelineShaderStageCreateInfo shaderStages[2];
+        SpecializationInfoTemporaryAllocations vertexSpecializationAllocations;
+        SpecializationInfoTemporaryAllocations fragmentSpecializationAllocations;
         {
             shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
             shaderStages[0].pNext = nullptr;
             shaderStages[0].flags = 0;
             shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
-            shaderStages[0].pSpecializationInfo = nullptr;
+            shaderStages[0].pSpecializationInfo = ComputeSpecializationInfo(
+                descriptor->vertexStage, &vertexSpecializationAllocations);
             shaderStages[0].module = ToBackend(descriptor->vertexStage.module)->GetHandle();
             shaderStages[0].pName = descriptor->vertexStage.entryPoint;
 
@@ -346,7 +349,8 @@ namespace dawn_native { namespace vulkan {
             shaderStages[1].pNext = nullptr;
             shaderStages[1].flags = 0;
             shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-            shaderStages[1].pSpecializationInfo = nullptr;
+            shaderStages[1].pSpecializationInfo = ComputeSpecializationInfo(
+                *descriptor->fragmentStage, &fragmentSpecializationAllocations);
             shaderStages[1].module = ToBackend(descriptor->fragmentStage->module)->GetHandle();
             shaderStages[1].pName = descriptor->fragmentStage->entryPoint;
         }
@@ -455,19 +459,21 @@ namespace dawn_native { namespace vulkan {
         dynamic.dynamicStateCount = sizeof(dynamicStates) / sizeof(dynamicStates[0]);
         dynamic.pDynamicStates = dynamicStates;
 
-        // Get a VkRenderPass that matches the attachment formats for this pipeline, load ops don't
-        // matter so set them all to LoadOp::Load
+        // Get a VkRenderPass that matches the attachment formats for this pipeline, load and store
+        // ops don't matter so set them all to LoadOp::Load and StoreOp::Store
         VkRenderPass renderPass = VK_NULL_HANDLE;
         {
             RenderPassCacheQuery query;
 
             for (uint32_t i : IterateBitSet(GetColorAttachmentsMask())) {
-                query.SetColor(i, GetColorAttachmentFormat(i), wgpu::LoadOp::Load, false);
+                query.SetColor(i, GetColorAttachmentFormat(i), wgpu::LoadOp::Load,
+                               wgpu::StoreOp::Store, false);
             }
 
             if (HasDepthStencilAttachment()) {
                 query.SetDepthStencil(GetDepthStencilFormat(), wgpu::LoadOp::Load,
-                                      wgpu::LoadOp::Load);
+                                      wgpu::StoreOp::Store, wgpu::LoadOp::Load,
+                                      wgpu::StoreOp::Store);
             }
 
             query.SetSampleCount(GetSampleCount());
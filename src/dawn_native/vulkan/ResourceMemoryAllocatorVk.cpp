@@ -139,6 +139,113 @@ namespace dawn_native { namespace vulkan {
         }
     }
 
+    ResultOrError<ResourceMemoryAllocation> ResourceMemoryAllocator::AllocateForTransientAttachment(
+        const VkMemoryRequirements& requirements) {
+        int memoryType = FindLazilyAllocatedTypeIndex(requirements);
+        if (memoryType < 0) {
+            return Allocate(requirements, false);
+        }
+
+        // Lazily allocated memory is only committed when the render pass needs it so give each
+        // attachment its own heap instead of sub-allocating from a big one.
+        std::unique_ptr<ResourceHeapBase> resourceHeap;
+        DAWN_TRY_ASSIGN(resourceHeap,
+                        mAllocatorsPerType[memoryType]->AllocateResourceHeap(requirements.size));
+
+        AllocationInfo info;
+        info.mMethod = AllocationMethod::kDirect;
+        return ResourceMemoryAllocation(info, /*offset*/ 0, resourceHeap.release());
+    }
+
+    ResultOrError<ResourceMemoryAllocation> ResourceMemoryAllocator::AllocateForHeap(
+        uint64_t size) {
+        // Both textures and buffers can be placed in a heap so its memory type must be usable by
+        // both. Vulkan only gives the memory requirements of existing resources, so query them
+        // for a representative color image and non-mappable buffer. Resources with other
+        // requirements, like depth-stencil images on some drivers, fail to be placed.
+        VkMemoryRequirements imageRequirements;
+        DAWN_TRY_ASSIGN(imageRequirements, GetRepresentativeImageRequirements());
+        VkMemoryRequirements bufferRequirements;
+        DAWN_TRY_ASSIGN(bufferRequirements, GetRepresentativeBufferRequirements());
+
+        VkMemoryRequirements requirements;
+        requirements.size = size;
+        requirements.alignment = 1;
+        requirements.memoryTypeBits =
+            imageRequirements.memoryTypeBits & bufferRequirements.memoryTypeBits;
+        if (requirements.memoryTypeBits == 0) {
+            return DAWN_OUT_OF_MEMORY_ERROR("No memory type can hold both textures and buffers");
+        }
+
+        int memoryType = FindBestTypeIndex(requirements, false);
+        ASSERT(memoryType >= 0);
+
+        std::unique_ptr<ResourceHeapBase> resourceHeap;
+        DAWN_TRY_ASSIGN(resourceHeap, mAllocatorsPerType[memoryType]->AllocateResourceHeap(size));
+
+        AllocationInfo info;
+        info.mMethod = AllocationMethod::kDirect;
+        return ResourceMemoryAllocation(info, /*offset*/ 0, resourceHeap.release());
+    }
+
+    ResultOrError<VkMemoryRequirements>
+    ResourceMemoryAllocator::GetRepresentativeImageRequirements() const {
+        VkImageCreateInfo createInfo;
+        createInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = 0;
+        createInfo.imageType = VK_IMAGE_TYPE_2D;
+        createInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+        createInfo.extent = {1, 1, 1};
+        createInfo.mipLevels = 1;
+        createInfo.arrayLayers = 1;
+        createInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+        createInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        createInfo.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT |
+                           VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+        createInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        createInfo.queueFamilyIndexCount = 0;
+        createInfo.pQueueFamilyIndices = nullptr;
+        createInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+        VkImage image = VK_NULL_HANDLE;
+        DAWN_TRY(CheckVkSuccess(
+            mDevice->fn.CreateImage(mDevice->GetVkDevice(), &createInfo, nullptr, &image),
+            "CreateImage"));
+
+        // The image is never used by commands so it can be destroyed immediately.
+        VkMemoryRequirements requirements;
+        mDevice->fn.GetImageMemoryRequirements(mDevice->GetVkDevice(), image, &requirements);
+        mDevice->fn.DestroyImage(mDevice->GetVkDevice(), image, nullptr);
+        return requirements;
+    }
+
+    ResultOrError<VkMemoryRequirements>
+    ResourceMemoryAllocator::GetRepresentativeBufferRequirements() const {
+        VkBufferCreateInfo createInfo;
+        createInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = 0;
+        createInfo.size = 4;
+        createInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+                           VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+                           VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT |
+                           VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+        createInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        createInfo.queueFamilyIndexCount = 0;
+        createInfo.pQueueFamilyIndices = nullptr;
+
+        VkBuffer buffer = VK_NULL_HANDLE;
+        DAWN_TRY(CheckVkSuccess(
+            mDevice->fn.CreateBuffer(mDevice->GetVkDevice(), &createInfo, nullptr, &buffer),
+            "CreateBuffer"));
+
+        VkMemoryRequirements requirements;
+        mDevice->fn.GetBufferMemoryRequirements(mDevice->GetVkDevice(), buffer, &requirements);
+        mDevice->fn.DestroyBuffer(mDevice->GetVkDevice(), buffer, nullptr);
+        return requirements;
+    }
+
     void ResourceMemoryAllocator::Deallocate(ResourceMemoryAllocation* allocation) {
         switch (allocation->GetInfo().mMethod) {
             // Some memory allocation can never be initialized, for example when wrapping
@@ -146,6 +253,10 @@ namespace dawn_native { namespace vulkan {
             case AllocationMethod::kInvalid:
                 break;
 
+            // Placed resources don't own their memory, the heap frees it when it is destroyed.
+            case AllocationMethod::kPlaced:
+                break;
+
             // For direct allocation we can put the memory for deletion immediately and the fence
             // deleter will make sure the resources are freed before the memory.
             case AllocationMethod::kDirect:
@@ -237,4 +348,17 @@ namespace dawn_native { namespace vulkan {
         return bestType;
     }
 
+    int ResourceMemoryAllocator::FindLazilyAllocatedTypeIndex(VkMemoryRequirements requirements) {
+        const VulkanDeviceInfo& info = mDevice->GetDeviceInfo();
+
+        for (size_t i = 0; i < info.memoryTypes.size(); ++i) {
+            if ((requirements.memoryTypeBits & (1 << i)) != 0 &&
+                (info.memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT) !=
+                    0) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
 }}  // namespace dawn_native::vulkan
@@ -34,13 +34,25 @@ namespace dawn_native { namespace vulkan {
 
         ResultOrError<ResourceMemoryAllocation> Allocate(const VkMemoryRequirements& requirements,
                                                          bool mappable);
+        // Allocates the memory of an image created with VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT
+        // from a lazily allocated memory type if there is one, so that tilers don't need to back
+        // it with memory at all.
+        ResultOrError<ResourceMemoryAllocation> AllocateForTransientAttachment(
+            const VkMemoryRequirements& requirements);
+        // Allocates the memory of a Heap that resources get placed in by the application. It is
+        // never sub-allocated.
+        ResultOrError<ResourceMemoryAllocation> AllocateForHeap(uint64_t size);
         void Deallocate(ResourceMemoryAllocation* allocation);
 
         void Tick(Serial completedSerial);
 
         int FindBestTypeIndex(VkMemoryRequirements requirements, bool mappable);
+        int FindLazilyAllocatedTypeIndex(VkMemoryRequirements requirements);
 
       private:
+        ResultOrError<VkMemoryRequirements> GetRepresentativeImageRequirements() const;
+        ResultOrError<VkMemoryRequirements> GetRepresentativeBufferRequirements() const;
+
         Device* mDevice;
 
         class SingleTypeAllocator;
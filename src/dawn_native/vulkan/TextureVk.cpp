@@ -22,8 +22,10 @@
 #include "dawn_native/vulkan/AdapterVk.h"
 #include "dawn_native/vulkan/BufferVk.h"
 #include "dawn_native/vulkan/CommandRecordingContext.h"
+#include "dawn_native/vulkan/DescriptorSetCache.h"
 #include "dawn_native/vulkan/DeviceVk.h"
 #include "dawn_native/vulkan/FencedDeleter.h"
+#include "dawn_native/vulkan/FramebufferCache.h"
 #include "dawn_native/vulkan/ResourceHeapVk.h"
 #include "dawn_native/vulkan/StagingBufferVk.h"
 #include "dawn_native/vulkan/UtilsVulkan.h"
@@ -354,6 +356,9 @@ namespace dawn_native { namespace vulkan {
                 flags |= VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
             }
         }
+        if (usage & wgpu::TextureUsage::TransientAttachment) {
+            flags |= VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+        }
 
         return flags;
     }
@@ -371,6 +376,10 @@ namespace dawn_native { namespace vulkan {
 
     MaybeError ValidateVulkanImageCanBeWrapped(const DeviceBase*,
                                                const TextureDescriptor* descriptor) {
+        if (descriptor->nextInChain != nullptr) {
+            return DAWN_VALIDATION_ERROR("Wrapped textures can't be placed in a heap");
+        }
+
         if (descriptor->dimension != wgpu::TextureDimension::e2D) {
             return DAWN_VALIDATION_ERROR("Texture must be 2D");
         }
@@ -410,7 +419,8 @@ namespace dawn_native { namespace vulkan {
     ResultOrError<Texture*> Texture::Create(Device* device, const TextureDescriptor* descriptor) {
         std::unique_ptr<Texture> texture =
             std::make_unique<Texture>(device, descriptor, TextureState::OwnedInternal);
-        DAWN_TRY(texture->InitializeAsInternalTexture());
+        DAWN_TRY(texture->InitializeAsInternalTexture(
+            GetPlacedResourceDescriptor(descriptor->nextInChain)));
         return texture.release();
     }
 
@@ -426,7 +436,7 @@ namespace dawn_native { namespace vulkan {
         return texture.release();
     }
 
-    MaybeError Texture::InitializeAsInternalTexture() {
+    MaybeError Texture::InitializeAsInternalTexture(const PlacedResourceDescriptor* placement) {
         Device* device = ToBackend(GetDevice());
 
         // Create the Vulkan image "container". We don't need to check that the format supports the
@@ -457,8 +467,12 @@ namespace dawn_native { namespace vulkan {
 
         // We always set VK_IMAGE_USAGE_TRANSFER_DST_BIT unconditionally beause the Vulkan images
         // that are used in vkCmdClearColorImage() must have been created with this flag, which is
-        // also required for the implementation of robust resource initialization.
-        createInfo.usage |= VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        // also required for the implementation of robust resource initialization. Transient
+        // attachments can't have it but they are always cleared by the render pass instead.
+        bool isTransient = GetUsage() & wgpu::TextureUsage::TransientAttachment;
+        if (!isTransient) {
+            createInfo.usage |= VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        }
 
         DAWN_TRY(CheckVkSuccess(
             device->fn.CreateImage(device->GetVkDevice(), &createInfo, nullptr, &mHandle),
@@ -468,7 +482,17 @@ namespace dawn_native { namespace vulkan {
         VkMemoryRequirements requirements;
         device->fn.GetImageMemoryRequirements(device->GetVkDevice(), mHandle, &requirements);
 
-        DAWN_TRY_ASSIGN(mMemoryAllocation, device->AllocateMemory(requirements, false));
+        if (placement != nullptr) {
+            mHeap = ToBackend(placement->heap);
+            mHeapRangeSize = requirements.size;
+            DAWN_TRY_ASSIGN(mMemoryAllocation,
+                            mHeap->PlaceResource(requirements, placement->offset));
+        } else if (isTransient) {
+            DAWN_TRY_ASSIGN(mMemoryAllocation,
+                            device->AllocateMemoryForTransientAttachment(requirements));
+        } else {
+            DAWN_TRY_ASSIGN(mMemoryAllocation, device->AllocateMemory(requirements, false));
+        }
 
         DAWN_TRY(CheckVkSuccess(
             device->fn.BindImageMemory(device->GetVkDevice(), mHandle,
@@ -476,7 +500,8 @@ namespace dawn_native { namespace vulkan {
                                        mMemoryAllocation.GetOffset()),
             "BindImageMemory"));
 
-        if (device->IsToggleEnabled(Toggle::NonzeroClearResourcesOnCreationForTesting)) {
+        if (device->IsToggleEnabled(Toggle::NonzeroClearResourcesOnCreationForTesting) &&
+            !isTransient) {
             DAWN_TRY(ClearTexture(ToBackend(GetDevice())->GetPendingRecordingContext(), 0,
                                   GetNumMipLevels(), 0, GetArrayLayers(),
                                   TextureBase::ClearValue::NonZero));
@@ -583,10 +608,19 @@ namespace dawn_native { namespace vulkan {
         if (GetTextureState() == TextureState::OwnedInternal) {
             Device* device = ToBackend(GetDevice());
 
+            if (device->IsToggleEnabled(Toggle::VulkanCacheDescriptorSets)) {
+                device->GetDescriptorSetCache()->InvalidateEntriesUsing(this);
+            }
+
             // For textures created from a VkImage, the allocation if kInvalid so the Device knows
             // to skip the deallocation of the (absence of) VkDeviceMemory.
             device->DeallocateMemory(&mMemoryAllocation);
 
+            if (mHeap.Get() != nullptr) {
+                mHeap->ReleaseRanges(this);
+                mHeap = nullptr;
+            }
+
             if (mHandle != VK_NULL_HANDLE) {
                 device->GetFencedDeleter()->DeleteWhenUnused(mHandle);
             }
@@ -612,6 +646,8 @@ namespace dawn_native { namespace vulkan {
 
     void Texture::TransitionUsageNow(CommandRecordingContext* recordingContext,
                                      wgpu::TextureUsage usage) {
+        AcquireHeapMemory(recordingContext);
+
         // Avoid encoding barriers when it isn't needed.
         bool lastReadOnly = (mLastUsage & kReadOnlyTextureUsages) == mLastUsage;
         if (lastReadOnly && mLastUsage == usage && mLastExternalState == mExternalState) {
@@ -761,6 +797,8 @@ namespace dawn_native { namespace vulkan {
                                                       uint32_t levelCount,
                                                       uint32_t baseArrayLayer,
                                                       uint32_t layerCount) {
+        AcquireHeapMemory(recordingContext);
+
         if (!GetDevice()->IsToggleEnabled(Toggle::LazyClearResourceOnFirstUse)) {
             return;
         }
@@ -780,6 +818,20 @@ namespace dawn_native { namespace vulkan {
         }
     }
 
+    void Texture::AcquireHeapMemory(CommandRecordingContext* recordingContext) {
+        // Textures are always created with VK_IMAGE_TILING_OPTIMAL.
+        if (mHeap.Get() == nullptr ||
+            !mHeap->AcquireRange(recordingContext, this, Heap::Tiling::Optimal,
+                                 mMemoryAllocation.GetOffset(), mHeapRangeSize)) {
+            return;
+        }
+
+        // Another resource overwrote the memory: the image goes back to the undefined layout and
+        // will be cleared before it is read.
+        mLastUsage = wgpu::TextureUsage::None;
+        SetIsSubresourceContentInitialized(false, 0, GetNumMipLevels(), 0, GetArrayLayers());
+    }
+
     // static
     ResultOrError<TextureView*> TextureView::Create(TextureBase* texture,
                                                     const TextureViewDescriptor* descriptor) {
@@ -815,6 +867,14 @@ namespace dawn_native { namespace vulkan {
         Device* device = ToBackend(GetTexture()->GetDevice());
 
         if (mHandle != VK_NULL_HANDLE) {
+            // Only views of attachments can be in cached framebuffers. The cache is already gone
+            // if the device was destroyed first.
+            FramebufferCache* framebufferCache = device->GetFramebufferCache();
+            if ((GetTexture()->GetUsage() & wgpu::TextureUsage::OutputAttachment) &&
+                framebufferCache != nullptr) {
+                framebufferCache->OnViewDestroyed(mHandle);
+            }
+
             device->GetFencedDeleter()->DeleteWhenUnused(mHandle);
             mHandle = VK_NULL_HANDLE;
         }
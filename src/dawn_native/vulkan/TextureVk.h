@@ -20,6 +20,7 @@
 #include "common/vulkan_platform.h"
 #include "dawn_native/ResourceMemoryAllocation.h"
 #include "dawn_native/vulkan/ExternalHandle.h"
+#include "dawn_native/vulkan/HeapVk.h"
 #include "dawn_native/vulkan/external_memory/MemoryService.h"
 
 namespace dawn_native { namespace vulkan {
@@ -68,6 +69,9 @@ namespace dawn_native { namespace vulkan {
                                                  uint32_t levelCount,
                                                  uint32_t baseArrayLayer,
                                                  uint32_t layerCount);
+        // Textures placed in a heap must acquire their memory before using it, in case other
+        // resources of the heap overwrote it. Their content is then lost.
+        void AcquireHeapMemory(CommandRecordingContext* recordingContext);
 
         MaybeError SignalAndDestroy(VkSemaphore* outSignalSemaphore);
         // Binds externally allocated memory to the VkImage and on success, takes ownership of
@@ -79,7 +83,7 @@ namespace dawn_native { namespace vulkan {
 
       private:
         using TextureBase::TextureBase;
-        MaybeError InitializeAsInternalTexture();
+        MaybeError InitializeAsInternalTexture(const PlacedResourceDescriptor* placement);
 
         MaybeError InitializeFromExternal(const ExternalImageDescriptor* descriptor,
                                           external_memory::Service* externalMemoryService);
@@ -96,6 +100,10 @@ namespace dawn_native { namespace vulkan {
         ResourceMemoryAllocation mMemoryAllocation;
         VkDeviceMemory mExternalAllocation = VK_NULL_HANDLE;
 
+        // The heap the texture is placed in, if any, and the size of its memory in the heap.
+        Ref<Heap> mHeap;
+        uint64_t mHeapRangeSize = 0;
+
         enum class ExternalState {
             InternalOnly,
             PendingAcquire,
@@ -16,6 +16,7 @@
 
 #include "common/Assert.h"
 #include "dawn_native/Format.h"
+#include "dawn_native/ShaderModule.h"
 #include "dawn_native/vulkan/BufferVk.h"
 #include "dawn_native/vulkan/DeviceVk.h"
 #include "dawn_native/vulkan/ResourceHeapVk.h"
@@ -193,6 +194,35 @@ namespace dawn_native { namespace vulkan {
     // the image refers to the virtual size, while Dawn validates texture copy extent with the
     // physical size, so we need to re-calculate the texture copy extent to ensure it should fit
     // in the virtual size of the subresource.
+    const VkSpecializationInfo* ComputeSpecializationInfo(
+        const ProgrammableStageDescriptor& stage,
+        SpecializationInfoTemporaryAllocations* allocations) {
+        if (stage.constantCount == 0) {
+            return nullptr;
+        }
+
+        // All the types of constants we support are 32-bit so each one uses one word of data.
+        const ShaderModuleBase::SpecializationConstantTypes& constantTypes =
+            stage.module->GetSpecializationConstantTypes();
+        allocations->entries.resize(stage.constantCount);
+        allocations->data.resize(stage.constantCount);
+        for (uint32_t i = 0; i < stage.constantCount; ++i) {
+            const SpecializationConstant& constant = stage.constants[i];
+            SpecializationConstantType type = constantTypes.at(constant.id);
+
+            allocations->entries[i].constantID = constant.id;
+            allocations->entries[i].offset = i * sizeof(uint32_t);
+            allocations->entries[i].size = sizeof(uint32_t);
+            allocations->data[i] = GetSpecializationConstantBits(type, constant.value);
+        }
+
+        allocations->info.mapEntryCount = stage.constantCount;
+        allocations->info.pMapEntries = allocations->entries.data();
+        allocations->info.dataSize = stage.constantCount * sizeof(uint32_t);
+        allocations->info.pData = allocations->data.data();
+        return &allocations->info;
+    }
+
     Extent3D ComputeTextureCopyExtent(const TextureCopy& textureCopy, const Extent3D& copySize) {
         Extent3D validTextureCopyExtent = copySize;
         const TextureBase* texture = textureCopy.texture.Get();
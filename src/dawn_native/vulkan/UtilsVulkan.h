@@ -22,6 +22,8 @@
 #include "dawn_native/vulkan/BufferVk.h"
 #include "dawn_native/vulkan/VulkanError.h"
 
+#include <vector>
+
 namespace dawn_native { namespace vulkan {
 
     VkCompareOp ToVulkanCompareOp(wgpu::CompareFunction op);
@@ -40,6 +42,17 @@ namespace dawn_native { namespace vulkan {
     VkRayTracingShaderGroupTypeNV ToVulkanShaderBindingTableGroupType(
         wgpu::RayTracingShaderBindingTableGroupType type);
 
+    // The storage pointed to by a VkSpecializationInfo, it must outlive the pipeline creation.
+    struct SpecializationInfoTemporaryAllocations {
+        VkSpecializationInfo info;
+        std::vector<VkSpecializationMapEntry> entries;
+        std::vector<uint32_t> data;
+    };
+    // Returns nullptr if no specialization constants are set on the stage.
+    const VkSpecializationInfo* ComputeSpecializationInfo(
+        const ProgrammableStageDescriptor& stage,
+        SpecializationInfoTemporaryAllocations* allocations);
+
     Extent3D ComputeTextureCopyExtent(const TextureCopy& textureCopy, const Extent3D& copySize);
     VkBufferImageCopy ComputeBufferImageCopyRegion(const BufferCopy& bufferCopy,
                                                    const TextureCopy& textureCopy,
@@ -22,6 +22,7 @@
 #include "dawn_native/VulkanBackend.h"
 
 #include "common/SwapChainUtils.h"
+#include "dawn_native/vulkan/BufferVk.h"
 #include "dawn_native/vulkan/DeviceVk.h"
 #include "dawn_native/vulkan/NativeSwapChainImplVk.h"
 #include "dawn_native/vulkan/TextureVk.h"
@@ -76,6 +77,22 @@ namespace dawn_native { namespace vulkan {
         : ExternalImageDescriptorFD(ExternalImageDescriptorType::DmaBuf) {
     }
 
+    ExternalBufferDescriptor::ExternalBufferDescriptor(ExternalImageDescriptorType type)
+        : type(type) {
+    }
+
+    ExternalBufferDescriptorFD::ExternalBufferDescriptorFD(ExternalImageDescriptorType type)
+        : ExternalBufferDescriptor(type) {
+    }
+
+    ExternalBufferDescriptorOpaqueFD::ExternalBufferDescriptorOpaqueFD()
+        : ExternalBufferDescriptorFD(ExternalImageDescriptorType::OpaqueFD) {
+    }
+
+    ExternalBufferDescriptorDmaBuf::ExternalBufferDescriptorDmaBuf()
+        : ExternalBufferDescriptorFD(ExternalImageDescriptorType::DmaBuf) {
+    }
+
     int ExportSignalSemaphoreOpaqueFD(WGPUDevice cDevice, WGPUTexture cTexture) {
         Device* device = reinterpret_cast<Device*>(cDevice);
         Texture* texture = reinterpret_cast<Texture*>(cTexture);
@@ -108,6 +125,39 @@ namespace dawn_native { namespace vulkan {
                 return nullptr;
         }
     }
+
+    int ExportBufferSignalSemaphoreOpaqueFD(WGPUDevice cDevice, WGPUBuffer cBuffer) {
+        Device* device = reinterpret_cast<Device*>(cDevice);
+        Buffer* buffer = reinterpret_cast<Buffer*>(cBuffer);
+
+        if (!buffer) {
+            return -1;
+        }
+
+        ExternalSemaphoreHandle outHandle;
+        if (device->ConsumedError(device->SignalAndExportExternalBuffer(buffer, &outHandle))) {
+            return -1;
+        }
+
+        return outHandle;
+    }
+
+    WGPUBuffer WrapVulkanBuffer(WGPUDevice cDevice, const ExternalBufferDescriptor* descriptor) {
+        Device* device = reinterpret_cast<Device*>(cDevice);
+
+        switch (descriptor->type) {
+            case ExternalImageDescriptorType::OpaqueFD:
+            case ExternalImageDescriptorType::DmaBuf: {
+                const ExternalBufferDescriptorFD* fdDescriptor =
+                    static_cast<const ExternalBufferDescriptorFD*>(descriptor);
+                BufferBase* buffer = device->CreateBufferWrappingVulkanMemory(
+                    descriptor, fdDescriptor->memoryFD, fdDescriptor->waitFDs);
+                return reinterpret_cast<WGPUBuffer>(buffer);
+            }
+            default:
+                return nullptr;
+        }
+    }
 #endif
 
 }}  // namespace dawn_native::vulkan
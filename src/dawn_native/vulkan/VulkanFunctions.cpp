@@ -281,6 +281,10 @@ namespace dawn_native { namespace vulkan {
             GET_DEVICE_PROC(QueuePresentKHR);
         }
 
+        if (deviceInfo.pushDescriptor) {
+            GET_DEVICE_PROC(CmdPushDescriptorSetKHR);
+        }
+
         if (deviceInfo.rayTracingNV) {
             GET_DEVICE_PROC(CmdTraceRaysNV);
             GET_DEVICE_PROC(CreateRayTracingPipelinesNV);
@@ -250,6 +250,9 @@ namespace dawn_native { namespace vulkan {
         PFN_vkAcquireNextImageKHR AcquireNextImageKHR = nullptr;
         PFN_vkQueuePresentKHR QueuePresentKHR = nullptr;
 
+        // VK_KHR_push_descriptor
+        PFN_vkCmdPushDescriptorSetKHR CmdPushDescriptorSetKHR = nullptr;
+
         // VK_KHR_external_memory_fd
         PFN_vkGetMemoryFdKHR GetMemoryFdKHR = nullptr;
         PFN_vkGetMemoryFdPropertiesKHR GetMemoryFdPropertiesKHR = nullptr;
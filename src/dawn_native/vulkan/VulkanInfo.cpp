@@ -81,6 +81,9 @@ namespace dawn_native { namespace vulkan {
     const char kExtensionNameKhrMaintenance1[] = "VK_KHR_maintenance1";
     const char kExtensionNameNvRayTracing[] = "VK_NV_ray_tracing";
     const char kExtensionNameKhrGetMemoryRequirements2[] = "VK_KHR_get_memory_requirements2";
+    const char kExtensionNameKhrMaintenance3[] = "VK_KHR_maintenance3";
+    const char kExtensionNameExtDescriptorIndexing[] = "VK_EXT_descriptor_indexing";
+    const char kExtensionNameKhrPushDescriptor[] = "VK_KHR_push_descriptor";
 
     ResultOrError<VulkanGlobalInfo> GatherGlobalInfo(const Backend& backend) {
         VulkanGlobalInfo info = {};
@@ -322,9 +325,45 @@ namespace dawn_native { namespace vulkan {
                 if (IsExtensionName(extension, kExtensionNameKhrGetMemoryRequirements2)) {
                     info.memoryRequirements2 = true;
                 }
+                if (IsExtensionName(extension, kExtensionNameKhrMaintenance3)) {
+                    info.maintenance3 = true;
+                }
+                if (IsExtensionName(extension, kExtensionNameExtDescriptorIndexing)) {
+                    info.descriptorIndexing = true;
+                }
+                if (IsExtensionName(extension, kExtensionNameKhrPushDescriptor)) {
+                    info.pushDescriptor = true;
+                }
             }
         }
 
+        // Gather the descriptor indexing features and limits, which requires
+        // VK_KHR_get_physical_device_properties2 or Vulkan 1.1.
+        if (info.descriptorIndexing && info.maintenance3 &&
+            vkFunctions.GetPhysicalDeviceFeatures2KHR != nullptr) {
+            info.descriptorIndexingFeatures.sType =
+                VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+            info.descriptorIndexingFeatures.pNext = nullptr;
+
+            VkPhysicalDeviceFeatures2 features2 = {};
+            features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+            features2.pNext = &info.descriptorIndexingFeatures;
+            vkFunctions.GetPhysicalDeviceFeatures2KHR(physicalDevice, &features2);
+            info.descriptorIndexingFeatures.pNext = nullptr;
+
+            info.descriptorIndexingProperties.sType =
+                VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT;
+            info.descriptorIndexingProperties.pNext = nullptr;
+
+            VkPhysicalDeviceProperties2 properties2 = {};
+            properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+            properties2.pNext = &info.descriptorIndexingProperties;
+            vkFunctions.GetPhysicalDeviceProperties2KHR(physicalDevice, &properties2);
+            info.descriptorIndexingProperties.pNext = nullptr;
+        } else {
+            info.descriptorIndexing = false;
+        }
+
         // TODO(cwallez@chromium.org): gather info about formats
 
         return info;
@@ -55,6 +55,9 @@ namespace dawn_native { namespace vulkan {
     extern const char kExtensionNameKhrMaintenance1[];
     extern const char kExtensionNameNvRayTracing[];
     extern const char kExtensionNameKhrGetMemoryRequirements2[];
+    extern const char kExtensionNameKhrMaintenance3[];
+    extern const char kExtensionNameExtDescriptorIndexing[];
+    extern const char kExtensionNameKhrPushDescriptor[];
 
     // Global information - gathered before the instance is created
     struct VulkanGlobalKnobs {
@@ -105,12 +108,19 @@ namespace dawn_native { namespace vulkan {
         bool maintenance1 = false;
         bool rayTracingNV = false;
         bool memoryRequirements2 = false;
+        bool maintenance3 = false;
+        bool descriptorIndexing = false;
+        bool pushDescriptor = false;
     };
 
     struct VulkanDeviceInfo : VulkanDeviceKnobs {
         VkPhysicalDeviceProperties properties;
         std::vector<VkQueueFamilyProperties> queueFamilies;
 
+        // Only gathered when the descriptorIndexing extension is present.
+        VkPhysicalDeviceDescriptorIndexingFeaturesEXT descriptorIndexingFeatures;
+        VkPhysicalDeviceDescriptorIndexingPropertiesEXT descriptorIndexingProperties;
+
         std::vector<VkMemoryType> memoryTypes;
         std::vector<VkMemoryHeap> memoryHeaps;
 
@@ -62,6 +62,25 @@ namespace dawn_native { namespace vulkan { namespace external_memory {
         ResultOrError<VkImage> CreateImage(const ExternalImageDescriptor* descriptor,
                                            const VkImageCreateInfo& baseCreateInfo);
 
+        // True if the device reports it supports importing external memory for buffers with
+        // the given usage.
+        bool SupportsImportBufferMemory(VkBufferUsageFlags usage, VkBufferCreateFlags flags);
+
+        // Returns the parameters required for importing memory for a buffer
+        ResultOrError<MemoryImportParams> GetBufferMemoryImportParams(
+            const ExternalBufferDescriptor* descriptor,
+            VkBuffer buffer);
+
+        // Given an external handle pointing to memory, import it into a VkDeviceMemory that can
+        // be bound to the buffer
+        ResultOrError<VkDeviceMemory> ImportBufferMemory(ExternalMemoryHandle handle,
+                                                         const MemoryImportParams& importParams,
+                                                         VkBuffer buffer);
+
+        // Create a VkBuffer for the given handle type
+        ResultOrError<VkBuffer> CreateBuffer(const ExternalBufferDescriptor* descriptor,
+                                             const VkBufferCreateInfo& baseCreateInfo);
+
       private:
         Device* mDevice = nullptr;
 
@@ -269,4 +269,122 @@ namespace dawn_native { namespace vulkan { namespace external_memory {
         return image;
     }
 
+    bool Service::SupportsImportBufferMemory(VkBufferUsageFlags usage, VkBufferCreateFlags flags) {
+        // Early out before we try using extension functions
+        if (!mSupported) {
+            return false;
+        }
+
+        VkPhysicalDeviceExternalBufferInfo externalBufferInfo;
+        externalBufferInfo.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_BUFFER_INFO_KHR;
+        externalBufferInfo.pNext = nullptr;
+        externalBufferInfo.flags = flags;
+        externalBufferInfo.usage = usage;
+        externalBufferInfo.handleType = VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT;
+
+        VkExternalBufferProperties externalBufferProperties;
+        externalBufferProperties.sType = VK_STRUCTURE_TYPE_EXTERNAL_BUFFER_PROPERTIES_KHR;
+        externalBufferProperties.pNext = nullptr;
+
+        mDevice->fn.GetPhysicalDeviceExternalBufferPropertiesKHR(
+            ToBackend(mDevice->GetAdapter())->GetPhysicalDevice(), &externalBufferInfo,
+            &externalBufferProperties);
+
+        VkFlags memoryFlags =
+            externalBufferProperties.externalMemoryProperties.externalMemoryFeatures;
+        return (memoryFlags & VK_EXTERNAL_MEMORY_FEATURE_IMPORTABLE_BIT_KHR) &&
+               !(memoryFlags & VK_EXTERNAL_MEMORY_FEATURE_DEDICATED_ONLY_BIT_KHR);
+    }
+
+    ResultOrError<MemoryImportParams> Service::GetBufferMemoryImportParams(
+        const ExternalBufferDescriptor* descriptor,
+        VkBuffer buffer) {
+        if (descriptor->type != ExternalImageDescriptorType::DmaBuf) {
+            return DAWN_VALIDATION_ERROR("ExternalBufferDescriptor is not a dma-buf descriptor");
+        }
+        const ExternalBufferDescriptorDmaBuf* dmaBufDescriptor =
+            static_cast<const ExternalBufferDescriptorDmaBuf*>(descriptor);
+        VkDevice device = mDevice->GetVkDevice();
+
+        // Get the valid memory types for the VkBuffer.
+        VkMemoryRequirements memoryRequirements;
+        mDevice->fn.GetBufferMemoryRequirements(device, buffer, &memoryRequirements);
+
+        VkMemoryFdPropertiesKHR fdProperties;
+        fdProperties.sType = VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR;
+        fdProperties.pNext = nullptr;
+
+        // Get the valid memory types that the external memory can be imported as.
+        mDevice->fn.GetMemoryFdPropertiesKHR(device, VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT,
+                                             dmaBufDescriptor->memoryFD, &fdProperties);
+        // Choose the best memory type that satisfies both the buffer's constraint and the
+        // import's constraint.
+        memoryRequirements.memoryTypeBits &= fdProperties.memoryTypeBits;
+        int memoryTypeIndex =
+            mDevice->FindBestMemoryTypeIndex(memoryRequirements, false /** mappable */);
+        if (memoryTypeIndex == -1) {
+            return DAWN_VALIDATION_ERROR("Unable to find appropriate memory type for import");
+        }
+        MemoryImportParams params = {memoryRequirements.size,
+                                     static_cast<uint32_t>(memoryTypeIndex)};
+        return params;
+    }
+
+    ResultOrError<VkDeviceMemory> Service::ImportBufferMemory(
+        ExternalMemoryHandle handle,
+        const MemoryImportParams& importParams,
+        VkBuffer buffer) {
+        if (handle < 0) {
+            return DAWN_VALIDATION_ERROR("Trying to import memory with invalid handle");
+        }
+
+        VkMemoryRequirements requirements;
+        mDevice->fn.GetBufferMemoryRequirements(mDevice->GetVkDevice(), buffer, &requirements);
+        if (requirements.size > importParams.allocationSize) {
+            return DAWN_VALIDATION_ERROR("Requested allocation size is too small for buffer");
+        }
+
+        VkMemoryDedicatedAllocateInfo memoryDedicatedAllocateInfo;
+        memoryDedicatedAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+        memoryDedicatedAllocateInfo.pNext = nullptr;
+        memoryDedicatedAllocateInfo.image = VK_NULL_HANDLE;
+        memoryDedicatedAllocateInfo.buffer = buffer;
+
+        VkImportMemoryFdInfoKHR importMemoryFdInfo;
+        importMemoryFdInfo.sType = VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR;
+        importMemoryFdInfo.pNext = &memoryDedicatedAllocateInfo;
+        importMemoryFdInfo.handleType = VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT;
+        importMemoryFdInfo.fd = handle;
+
+        VkMemoryAllocateInfo allocateInfo;
+        allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocateInfo.pNext = &importMemoryFdInfo;
+        allocateInfo.allocationSize = importParams.allocationSize;
+        allocateInfo.memoryTypeIndex = importParams.memoryTypeIndex;
+
+        VkDeviceMemory allocatedMemory = VK_NULL_HANDLE;
+        DAWN_TRY(CheckVkSuccess(mDevice->fn.AllocateMemory(mDevice->GetVkDevice(), &allocateInfo,
+                                                           nullptr, &allocatedMemory),
+                                "vkAllocateMemory"));
+        return allocatedMemory;
+    }
+
+    ResultOrError<VkBuffer> Service::CreateBuffer(const ExternalBufferDescriptor* descriptor,
+                                                  const VkBufferCreateInfo& baseCreateInfo) {
+        VkExternalMemoryBufferCreateInfo externalMemoryBufferCreateInfo;
+        externalMemoryBufferCreateInfo.sType =
+            VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO_KHR;
+        externalMemoryBufferCreateInfo.pNext = nullptr;
+        externalMemoryBufferCreateInfo.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT;
+
+        VkBufferCreateInfo createInfo = baseCreateInfo;
+        createInfo.pNext = &externalMemoryBufferCreateInfo;
+
+        VkBuffer buffer;
+        DAWN_TRY(CheckVkSuccess(
+            mDevice->fn.CreateBuffer(mDevice->GetVkDevice(), &createInfo, nullptr, &buffer),
+            "vkCreateBuffer"));
+        return buffer;
+    }
+
 }}}  // namespace dawn_native::vulkan::external_memory
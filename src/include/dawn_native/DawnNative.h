@@ -81,6 +81,23 @@ namespace dawn_native {
     // creation of device.
     using ExtensionInfo = ToggleInfo;
 
+    // Called with the content of each frame presented to a headless swap chain, once it has been
+    // read back. Rows of texels are bytesPerRow apart in data, which is only valid for the duration
+    // of the callback.
+    using HeadlessFrameCallback = void (*)(uint64_t frameIndex,
+                                           const void* data,
+                                           uint64_t dataLength,
+                                           uint32_t bytesPerRow,
+                                           void* userdata);
+
+    struct HeadlessSwapChainDescriptor {
+        // The number of frames that can be in flight between Present and the frame callback.
+        // Frames presented while all of them are in flight are not read back.
+        uint32_t frameCount = 3;
+        HeadlessFrameCallback callback = nullptr;
+        void* userdata = nullptr;
+    };
+
     // An adapter is an object that represent on possibility of creating devices in the system.
     // Most of the time it will represent a combination of a physical GPU and an API. Not that the
     // same GPU can be represented by multiple adapters but on different APIs.
@@ -172,9 +189,65 @@ namespace dawn_native {
     // Query the names of all the toggles that are enabled in device
     DAWN_NATIVE_EXPORT std::vector<const char*> GetTogglesUsed(WGPUDevice device);
 
+    // Timings of a frame presented to a swap chain, in seconds from an arbitrary origin.
+    struct SwapChainFrameStatistics {
+        uint64_t frameIndex = 0;
+        // When GetCurrentTextureView returned the texture for the frame.
+        double acquireTime = 0;
+        // When the frame was submitted with Present.
+        double presentTime = 0;
+        // When the device noticed that the GPU work submitted up to the frame completed.
+        double gpuCompleteTime = 0;
+    };
+
+    // Limits how many presented frames can have GPU work in flight. When the limit is reached,
+    // GetCurrentTextureView blocks until the GPU completes the frame presented maxFrameLatency
+    // frames ago. A value of 0 means there is no limit, which is the default.
+    DAWN_NATIVE_EXPORT void SetSwapChainMaxFrameLatency(WGPUSwapChain swapChain,
+                                                        uint32_t maxFrameLatency);
+
+    // Returns the statistics of the most recent frame whose GPU work completed, or false if there
+    // is no such frame yet.
+    DAWN_NATIVE_EXPORT bool GetSwapChainFrameStatistics(WGPUSwapChain swapChain,
+                                                        SwapChainFrameStatistics* statistics);
+
+    // Creates a swap chain that isn't tied to a window surface and instead reads back the
+    // presented frames asynchronously. Frame callbacks are called during Device::Tick.
+    DAWN_NATIVE_EXPORT WGPUSwapChain
+    CreateHeadlessSwapChain(WGPUDevice device, const HeadlessSwapChainDescriptor* descriptor);
+
+    // Returns the descriptors of the render and compute pipelines created by the device while the
+    // "record_pipeline_manifest" toggle is enabled, serialized so that the application can save
+    // them and give them to WarmUpPipelines on a later run. The manifest is only valid for the
+    // same version of Dawn.
+    DAWN_NATIVE_EXPORT std::vector<uint8_t> GetPipelineManifest(WGPUDevice device);
+
+    // Creates the pipelines of a manifest returned by GetPipelineManifest, for example while the
+    // application starts. The device keeps them until it is destroyed, so creating a pipeline
+    // with the same descriptor later returns it without compiling shaders. Errors creating the
+    // pipelines are reported like for other creations. Returns false if the manifest is invalid.
+    DAWN_NATIVE_EXPORT bool WarmUpPipelines(WGPUDevice device, const void* manifest, size_t size);
+
+    // Submits the pending commands of the device and blocks until the GPU finished executing all
+    // its work or `timeoutNs` nanoseconds elapsed, then ticks the device so that the callbacks of
+    // the completed work are called. Returns whether all the work completed. Use UINT64_MAX to
+    // wait without a timeout.
+    DAWN_NATIVE_EXPORT bool WaitForIdle(WGPUDevice device, uint64_t timeoutNs);
+
+    // Returns a file descriptor that becomes readable when GPU work of the device completes, so
+    // that applications can wait for it with poll or epoll and then tick the device to call the
+    // callbacks. Ticking the device resets it. The device owns the file descriptor. Returns -1
+    // when the platform or the backend doesn't support it: only Linux has it, and only the
+    // Vulkan and null backends signal it.
+    DAWN_NATIVE_EXPORT int GetCompletionFd(WGPUDevice device);
+
     // Backdoor to get the number of lazy clears for testing
     DAWN_NATIVE_EXPORT size_t GetLazyClearCountForTesting(WGPUDevice device);
 
+    // Backdoor to prepare a device for another test once all its objects were released. Returns
+    // false if the device can't be reused.
+    DAWN_NATIVE_EXPORT bool ResetDeviceForTesting(WGPUDevice device);
+
     // Backdoor to get the order of the ProcMap for testing
     DAWN_NATIVE_EXPORT std::vector<const char*> GetProcMapNamesForTesting();
 
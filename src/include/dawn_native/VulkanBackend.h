@@ -43,6 +43,16 @@ namespace dawn_native { namespace vulkan {
         ExternalImageDescriptor(ExternalImageDescriptorType type);
     };
 
+    // Common properties of external buffers, they use the same handle types as external images
+    struct DAWN_NATIVE_EXPORT ExternalBufferDescriptor {
+      public:
+        const ExternalImageDescriptorType type;         // Must match the subclass
+        const WGPUBufferDescriptor* cBufferDescriptor;  // Must match buffer creation params
+
+      protected:
+        ExternalBufferDescriptor(ExternalImageDescriptorType type);
+    };
+
     DAWN_NATIVE_EXPORT VkInstance GetInstance(WGPUDevice device);
 
     DAWN_NATIVE_EXPORT PFN_vkVoidFunction GetInstanceProcAddr(WGPUDevice device, const char* pName);
@@ -80,6 +90,30 @@ namespace dawn_native { namespace vulkan {
             uint64_t drmModifier;  // DRM modifier of the buffer
         };
 
+        // Common properties of external buffers represented by FDs
+        struct DAWN_NATIVE_EXPORT ExternalBufferDescriptorFD : ExternalBufferDescriptor {
+          public:
+            int memoryFD;  // A file descriptor from an export of the memory of the buffer
+            std::vector<int> waitFDs;  // File descriptors of semaphores which will be waited on
+
+          protected:
+            ExternalBufferDescriptorFD(ExternalImageDescriptorType type);
+        };
+
+        // Descriptor for opaque file descriptor buffer import
+        struct DAWN_NATIVE_EXPORT ExternalBufferDescriptorOpaqueFD : ExternalBufferDescriptorFD {
+            ExternalBufferDescriptorOpaqueFD();
+
+            VkDeviceSize allocationSize;  // Must match VkMemoryAllocateInfo from buffer creation
+            uint32_t memoryTypeIndex;     // Must match VkMemoryAllocateInfo from buffer creation
+        };
+
+        // Descriptor for dma-buf file descriptor buffer import. The allocation size and memory
+        // type are queried from the file descriptor.
+        struct DAWN_NATIVE_EXPORT ExternalBufferDescriptorDmaBuf : ExternalBufferDescriptorFD {
+            ExternalBufferDescriptorDmaBuf();
+        };
+
         // Exports a signal semaphore from a wrapped texture. This must be called on wrapped
         // textures before they are destroyed. On failure, returns -1
         DAWN_NATIVE_EXPORT int ExportSignalSemaphoreOpaqueFD(WGPUDevice cDevice,
@@ -91,6 +125,18 @@ namespace dawn_native { namespace vulkan {
         // On failure, returns a nullptr.
         DAWN_NATIVE_EXPORT WGPUTexture WrapVulkanImage(WGPUDevice cDevice,
                                                        const ExternalImageDescriptor* descriptor);
+
+        // Exports a signal semaphore from a wrapped buffer. This must be called on wrapped
+        // buffers before they are destroyed. On failure, returns -1
+        DAWN_NATIVE_EXPORT int ExportBufferSignalSemaphoreOpaqueFD(WGPUDevice cDevice,
+                                                                   WGPUBuffer cBuffer);
+
+        // Imports external memory into a Vulkan buffer without copying it. Like WrapVulkanImage,
+        // the buffer waits on the provided synchronization primitives before its first use.
+        // Wrapped buffers can't be mapped since the memory isn't guaranteed to be host visible.
+        // On failure, returns a nullptr.
+        DAWN_NATIVE_EXPORT WGPUBuffer WrapVulkanBuffer(WGPUDevice cDevice,
+                                                       const ExternalBufferDescriptor* descriptor);
 #endif  // __linux__
 }}  // namespace dawn_native::vulkan
 
@@ -24,14 +24,15 @@
 #include "dawn_native/DawnNative.h"
 #include "dawn_wire/WireClient.h"
 #include "dawn_wire/WireServer.h"
-#include "utils/SystemUtils.h"
 #include "utils/TerribleCommandBuffer.h"
 #include "utils/WGPUHelpers.h"
 
 #include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <sstream>
+#include <type_traits>
 #include <unordered_map>
 
 #ifdef DAWN_ENABLE_BACKEND_OPENGL
@@ -73,11 +74,34 @@ namespace {
         }
     }
 
+    // Devices are reused between tests with the same backend, toggles and extensions. The adapter
+    // chosen for a backend is the same for the whole run.
+    std::string GetReusedDeviceKey(wgpu::BackendType backendType,
+                                   const dawn_native::DeviceDescriptor& descriptor) {
+        std::ostringstream key;
+        key << ParamName(backendType);
+        for (const char* toggle : descriptor.forceEnabledToggles) {
+            key << " +" << toggle;
+        }
+        for (const char* toggle : descriptor.forceDisabledToggles) {
+            key << " -" << toggle;
+        }
+        for (const char* extension : descriptor.requiredExtensions) {
+            key << " " << extension;
+        }
+        return key.str();
+    }
+
     struct MapReadUserdata {
         DawnTestBase* test;
         size_t slot;
     };
 
+    // Readback slots are at least this big so that most tests only need one of them.
+    constexpr uint64_t kMinReadbackSlotSize = 1024 * 1024;
+    // Satisfies the buffer offset alignment of both buffer-to-buffer and texture-to-buffer copies.
+    constexpr uint64_t kReadbackOffsetAlignment = 256;
+
     DawnTestEnvironment* gTestEnv = nullptr;
 
 }  // namespace
@@ -149,6 +173,11 @@ DawnTestEnvironment::DawnTestEnvironment(int argc, char** argv) {
             continue;
         }
 
+        if (strcmp("--reuse-devices", argv[i]) == 0) {
+            mReuseDevices = true;
+            continue;
+        }
+
         constexpr const char kVendorIdFilterArg[] = "--adapter-vendor-id=";
         if (strstr(argv[i], kVendorIdFilterArg) == argv[i]) {
             const char* vendorIdFilter = argv[i] + strlen(kVendorIdFilterArg);
@@ -184,6 +213,8 @@ DawnTestEnvironment::DawnTestEnvironment(int argc, char** argv) {
                    "(defaults to no capture)\n"
                    "  --skip-validation: Skip Dawn validation\n"
                    "  --use-spvc: Use spvc for accessing spirv-cross\n"
+                   "  --reuse-devices: Reuse devices between tests with the same toggles and "
+                   "extensions\n"
                    "  --adapter-vendor-id: Select adapter by vendor id to run end2end tests"
                    "on multi-GPU systems \n";
             continue;
@@ -217,6 +248,9 @@ void DawnTestEnvironment::SetUp() {
                     << "\n"
                        "UseSpvc: "
                     << (mUseSpvc ? "true" : "false")
+                    << "\n"
+                       "ReuseDevices: "
+                    << (mReuseDevices ? "true" : "false")
                     << "\n"
                        "BeginCaptureOnStartup: "
                     << (mBeginCaptureOnStartup ? "true" : "false")
@@ -249,6 +283,12 @@ void DawnTestEnvironment::SetUp() {
 }
 
 void DawnTestEnvironment::TearDown() {
+    // The reused devices must be destroyed before their instance.
+    for (const auto& it : mReusedDevices) {
+        dawn_native::GetProcs().deviceRelease(it.second);
+    }
+    mReusedDevices.clear();
+
     // When Vulkan validation layers are enabled, it's unsafe to call Vulkan APIs in the destructor
     // of a static/global variable, so the instance must be manually released beforehand.
     mInstance.reset();
@@ -289,6 +329,42 @@ const char* DawnTestEnvironment::GetWireTraceDir() const {
     return mWireTraceDir.c_str();
 }
 
+bool DawnTestEnvironment::ReusesDevices() const {
+    return mReuseDevices;
+}
+
+WGPUDevice DawnTestEnvironment::AcquireReusedDevice(
+    const std::string& key,
+    dawn_native::Adapter adapter,
+    const dawn_native::DeviceDescriptor* descriptor) {
+    auto it = mReusedDevices.find(key);
+    if (it == mReusedDevices.end()) {
+        WGPUDevice device = adapter.CreateDevice(descriptor);
+        if (device == nullptr) {
+            return nullptr;
+        }
+        it = mReusedDevices.emplace(key, device).first;
+    }
+
+    dawn_native::GetProcs().deviceReference(it->second);
+    return it->second;
+}
+
+void DawnTestEnvironment::ResetReusedDevice(const std::string& key) {
+    auto it = mReusedDevices.find(key);
+    ASSERT(it != mReusedDevices.end());
+
+    // Tests that lose their device opt out of device reuse, so a device that can't be reset
+    // means that the test leaked objects. The device is dropped so that the next tests still
+    // start from a clean device.
+    if (!dawn_native::ResetDeviceForTesting(it->second)) {
+        ADD_FAILURE() << "The device of the test can't be reused because it is lost or objects "
+                         "created by the test are still alive";
+        dawn_native::GetProcs().deviceRelease(it->second);
+        mReusedDevices.erase(it);
+    }
+}
+
 void DawnTestEnvironment::DiscoverOpenGLAdapter() {
 #ifdef DAWN_ENABLE_BACKEND_OPENGL
     if (!glfwInit()) {
@@ -345,6 +421,11 @@ DawnTestBase::~DawnTestBase() {
     }
 
     dawnProcSetProcs(nullptr);
+
+    // The test released all its objects so the device can be prepared for the next test.
+    if (!mReusedDeviceKey.empty()) {
+        gTestEnv->ResetReusedDevice(mReusedDeviceKey);
+    }
 }
 
 bool DawnTestBase::IsD3D12() const {
@@ -443,6 +524,10 @@ const wgpu::AdapterProperties& DawnTestBase::GetAdapterProperties() const {
     return mAdapterProperties;
 }
 
+bool DawnTestBase::CanReuseDevice() const {
+    return true;
+}
+
 // This function can only be called after SetUp() because it requires mBackendAdapter to be
 // initialized.
 bool DawnTestBase::SupportsExtensions(const std::vector<const char*>& extensions) {
@@ -524,7 +609,15 @@ void DawnTestBase::SetUp() {
         deviceDescriptor.forceEnabledToggles.push_back(kUseSpvcToggle);
     }
 
-    backendDevice = mBackendAdapter.CreateDevice(&deviceDescriptor);
+    if (gTestEnv->ReusesDevices() && CanReuseDevice()) {
+        std::string key = GetReusedDeviceKey(backendType, deviceDescriptor);
+        backendDevice = gTestEnv->AcquireReusedDevice(key, mBackendAdapter, &deviceDescriptor);
+        if (backendDevice != nullptr) {
+            mReusedDeviceKey = std::move(key);
+        }
+    } else {
+        backendDevice = mBackendAdapter.CreateDevice(&deviceDescriptor);
+    }
     ASSERT_NE(nullptr, backendDevice);
 
     backendProcs = dawn_native::GetProcs();
@@ -703,7 +796,11 @@ void DawnTestBase::WaitABit() {
     device.Tick();
     FlushWire();
 
-    utils::USleep(100);
+    // Sleep until the GPU work completes instead of spinning. The wait is bounded because the
+    // test might be waiting on the wire instead.
+    constexpr uint64_t kTimeoutNs = 10 * 1000 * 1000;
+    dawn_native::WaitForIdle(backendDevice, kTimeoutNs);
+    FlushWire();
 }
 
 void DawnTestBase::FlushWire() {
@@ -716,14 +813,30 @@ void DawnTestBase::FlushWire() {
 }
 
 DawnTestBase::ReadbackReservation DawnTestBase::ReserveReadback(uint64_t readbackSize) {
-    // For now create a new MapRead buffer for each readback
-    // TODO(cwallez@chromium.org): eventually make bigger buffers and allocate linearly?
+    // Expectations are suballocated linearly from large MapRead buffers so that a test only
+    // needs to map a handful of buffers at the end, instead of one per expectation. Offsets are
+    // aligned so that they are valid for both buffer-to-buffer and texture-to-buffer copies.
+    if (!mReadbackSlots.empty()) {
+        ReadbackSlot& lastSlot = mReadbackSlots.back();
+        uint64_t offset = Align(lastSlot.usedSize, kReadbackOffsetAlignment);
+        if (offset + readbackSize <= lastSlot.bufferSize) {
+            lastSlot.usedSize = offset + readbackSize;
+
+            ReadbackReservation reservation;
+            reservation.buffer = lastSlot.buffer;
+            reservation.slot = mReadbackSlots.size() - 1;
+            reservation.offset = offset;
+            return reservation;
+        }
+    }
+
     wgpu::BufferDescriptor descriptor;
-    descriptor.size = readbackSize;
+    descriptor.size = std::max(readbackSize, kMinReadbackSlotSize);
     descriptor.usage = wgpu::BufferUsage::MapRead | wgpu::BufferUsage::CopyDst;
 
     ReadbackSlot slot;
-    slot.bufferSize = readbackSize;
+    slot.bufferSize = descriptor.size;
+    slot.usedSize = readbackSize;
     slot.buffer = device.CreateBuffer(&descriptor);
 
     ReadbackReservation reservation;
@@ -786,9 +899,8 @@ void DawnTestBase::ResolveExpectations() {
             uint32_t packedSize = rowCount * expectation.rowBytes;
             packedData.resize(packedSize);
             for (uint32_t r = 0; r < rowCount; ++r) {
-                for (uint32_t i = 0; i < expectation.rowBytes; ++i) {
-                    packedData[i + r * expectation.rowBytes] = data[i + r * expectation.rowPitch];
-                }
+                memcpy(&packedData[r * expectation.rowBytes], &data[r * expectation.rowPitch],
+                       expectation.rowBytes);
             }
             data = packedData.data();
             size = packedSize;
@@ -872,6 +984,13 @@ namespace detail {
 
         const T* actual = static_cast<const T*>(data);
 
+        // Most expectations pass, so first compare the whole range at once and only look for the
+        // first mismatching element on failure. Floats are excluded since bitwise equality doesn't
+        // match operator== for NaNs.
+        if (!std::is_floating_point<T>::value && memcmp(actual, mExpected.data(), size) == 0) {
+            return testing::AssertionSuccess();
+        }
+
         for (size_t i = 0; i < mExpected.size(); ++i) {
             if (actual[i] != mExpected[i]) {
                 testing::AssertionResult result = testing::AssertionFailure()
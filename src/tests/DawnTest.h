@@ -23,6 +23,7 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -151,6 +152,16 @@ class DawnTestEnvironment : public testing::Environment {
     bool HasVendorIdFilter() const;
     uint32_t GetVendorIdFilter() const;
     const char* GetWireTraceDir() const;
+    bool ReusesDevices() const;
+
+    // Returns a reference to a device created on the adapter for the key. The device is kept and
+    // returned again to the next tests using the same key, as long as it can be reset.
+    WGPUDevice AcquireReusedDevice(const std::string& key,
+                                   dawn_native::Adapter adapter,
+                                   const dawn_native::DeviceDescriptor* descriptor);
+    // Called once a test released all the objects of a reused device to reset it for the next
+    // test, or to forget it if it can't be reused.
+    void ResetReusedDevice(const std::string& key);
 
   protected:
     std::unique_ptr<dawn_native::Instance> mInstance;
@@ -166,6 +177,8 @@ class DawnTestEnvironment : public testing::Environment {
     bool mHasVendorIdFilter = false;
     uint32_t mVendorIdFilter = 0;
     std::string mWireTraceDir;
+    bool mReuseDevices = false;
+    std::unordered_map<std::string, WGPUDevice> mReusedDevices;
 };
 
 class DawnTestBase {
@@ -245,8 +258,14 @@ class DawnTestBase {
 
     const wgpu::AdapterProperties& GetAdapterProperties() const;
 
+    // Tests that need a fresh device, for example because they lose it, return false. Only used
+    // when devices are reused with --reuse-devices.
+    virtual bool CanReuseDevice() const;
+
   private:
     DawnTestParam mParam;
+    // The key of the reused device, empty if the test has its own device.
+    std::string mReusedDeviceKey;
 
     // Things used to set up testing through the Wire.
     std::unique_ptr<dawn_wire::WireServer> mWireServer;
@@ -262,10 +281,12 @@ class DawnTestBase {
     bool mExpectError = false;
     bool mError = false;
 
-    // MapRead buffers used to get data for the expectations
+    // MapRead buffers used to get data for the expectations. Each slot holds the data for many
+    // expectations, suballocated linearly.
     struct ReadbackSlot {
         wgpu::Buffer buffer;
         uint64_t bufferSize;
+        uint64_t usedSize;
         const void* mappedData = nullptr;
     };
     std::vector<ReadbackSlot> mReadbackSlots;
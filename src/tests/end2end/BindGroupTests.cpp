@@ -780,4 +780,190 @@ TEST_P(BindGroupTests, BindGroupLayoutVisibilityCanBeNone) {
     queue.Submit(1, &commands);
 }
 
-DAWN_INSTANTIATE_TEST(BindGroupTests, D3D12Backend, MetalBackend, OpenGLBackend, VulkanBackend);
+// Test that bind groups created with the same layout and resources can be used together, and that
+// destroying a resource used by one of them doesn't affect bind groups created afterwards. This
+// exercises sharing of descriptor sets when the backend caches them.
+TEST_P(BindGroupTests, IdenticalBindGroups) {
+    utils::BasicRenderPass renderPass = utils::CreateBasicRenderPass(device, kRTSize, kRTSize);
+
+    wgpu::BindGroupLayout layout = utils::MakeBindGroupLayout(
+        device, {{0, wgpu::ShaderStage::Fragment, wgpu::BindingType::UniformBuffer}});
+    wgpu::RenderPipeline pipeline =
+        MakeTestPipeline(renderPass, {wgpu::BindingType::UniformBuffer}, {layout});
+
+    std::array<float, 4> red = {1, 0, 0, 0};
+    std::array<float, 4> green = {0, 1, 0, 0};
+    wgpu::Buffer redBuffer =
+        utils::CreateBufferFromData(device, &red, sizeof(red), wgpu::BufferUsage::Uniform);
+
+    wgpu::BindGroup redGroup0 = utils::MakeBindGroup(device, layout, {{0, redBuffer, 0, 16}});
+    wgpu::BindGroup redGroup1 = utils::MakeBindGroup(device, layout, {{0, redBuffer, 0, 16}});
+
+    // Release one of the identical bind groups before it is used, the other one must still work.
+    redGroup0 = nullptr;
+
+    // Destroy the buffer of a bind group, then make a new identical-looking bind group with a
+    // buffer created afterwards, which may reuse the allocation of the destroyed buffer: it must
+    // not pick up the stale descriptors.
+    wgpu::Buffer tmpBuffer =
+        utils::CreateBufferFromData(device, &red, sizeof(red), wgpu::BufferUsage::Uniform);
+    wgpu::BindGroup tmpGroup = utils::MakeBindGroup(device, layout, {{0, tmpBuffer, 0, 16}});
+    tmpBuffer.Destroy();
+    wgpu::Buffer greenBuffer =
+        utils::CreateBufferFromData(device, &green, sizeof(green), wgpu::BufferUsage::Uniform);
+    wgpu::BindGroup greenGroup0 = utils::MakeBindGroup(device, layout, {{0, greenBuffer, 0, 16}});
+    wgpu::BindGroup greenGroup1 = utils::MakeBindGroup(device, layout, {{0, greenBuffer, 0, 16}});
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+    pass.SetPipeline(pipeline);
+    pass.SetBindGroup(0, redGroup1);
+    pass.Draw(3, 1, 0, 0);
+    pass.SetBindGroup(0, greenGroup0);
+    pass.Draw(3, 1, 0, 0);
+    pass.SetBindGroup(0, greenGroup1);
+    pass.Draw(3, 1, 0, 0);
+    pass.EndPass();
+
+    wgpu::CommandBuffer commands = encoder.Finish();
+    queue.Submit(1, &commands);
+
+    RGBA8 filled(255, 255, 0, 0);
+    RGBA8 notFilled(0, 0, 0, 0);
+    int min = 1, max = kRTSize - 3;
+    EXPECT_PIXEL_RGBA8_EQ(filled, renderPass.color, min, min);
+    EXPECT_PIXEL_RGBA8_EQ(notFilled, renderPass.color, max, max);
+}
+
+// Test that a derived bind group uses the replaced bindings and keeps the other ones from its
+// parent, and that the parent is unaffected.
+TEST_P(BindGroupTests, DerivedBindGroup) {
+    utils::BasicRenderPass renderPass = utils::CreateBasicRenderPass(device, kRTSize, kRTSize);
+
+    wgpu::ShaderModule vsModule = MakeSimpleVSModule();
+    wgpu::ShaderModule fsModule =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Fragment, R"(
+        #version 450
+        layout(std140, set = 0, binding = 0) uniform UniformBuffer0 {
+            vec4 color;
+        } buffer0;
+        layout(std140, set = 0, binding = 1) uniform UniformBuffer1 {
+            vec4 color;
+        } buffer1;
+        layout(location = 0) out vec4 fragColor;
+        void main() {
+            fragColor = buffer0.color + buffer1.color;
+        })");
+
+    wgpu::BindGroupLayout layout = utils::MakeBindGroupLayout(
+        device, {
+                    {0, wgpu::ShaderStage::Fragment, wgpu::BindingType::UniformBuffer},
+                    {1, wgpu::ShaderStage::Fragment, wgpu::BindingType::UniformBuffer},
+                });
+
+    utils::ComboRenderPipelineDescriptor pipelineDescriptor(device);
+    pipelineDescriptor.layout = MakeBasicPipelineLayout(device, {layout});
+    pipelineDescriptor.vertexStage.module = vsModule;
+    pipelineDescriptor.cFragmentStage.module = fsModule;
+    pipelineDescriptor.cColorStates[0].format = renderPass.colorFormat;
+    wgpu::RenderPipeline pipeline = device.CreateRenderPipeline(&pipelineDescriptor);
+
+    std::array<float, 4> red = {1, 0, 0, 1};
+    std::array<float, 4> green = {0, 1, 0, 0};
+    std::array<float, 4> blue = {0, 0, 1, 0};
+    std::array<float, 4> black = {0, 0, 0, 0};
+    wgpu::Buffer redBuffer =
+        utils::CreateBufferFromData(device, &red, sizeof(red), wgpu::BufferUsage::Uniform);
+    wgpu::Buffer greenBuffer =
+        utils::CreateBufferFromData(device, &green, sizeof(green), wgpu::BufferUsage::Uniform);
+    wgpu::Buffer blueBuffer =
+        utils::CreateBufferFromData(device, &blue, sizeof(blue), wgpu::BufferUsage::Uniform);
+    wgpu::Buffer blackBuffer =
+        utils::CreateBufferFromData(device, &black, sizeof(black), wgpu::BufferUsage::Uniform);
+
+    wgpu::BindGroup parent =
+        utils::MakeBindGroup(device, layout, {{0, redBuffer, 0, 16}, {1, blackBuffer, 0, 16}});
+
+    // Replace binding 1 and then derive again from the derived bind group to replace binding 0.
+    wgpu::BindGroupBinding binding =
+        utils::BindingInitializationHelper(1, greenBuffer, 0, 16).GetAsBinding();
+    wgpu::BindGroup redGreen = parent.CreateDerived(1, &binding);
+    binding = utils::BindingInitializationHelper(0, blueBuffer, 0, 16).GetAsBinding();
+    wgpu::BindGroup blueGreen = redGreen.CreateDerived(1, &binding);
+
+    auto DrawWithBindGroup = [&](const wgpu::BindGroup& bindGroup, RGBA8 expected) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+        pass.SetPipeline(pipeline);
+        pass.SetBindGroup(0, bindGroup);
+        pass.Draw(3, 1, 0, 0);
+        pass.EndPass();
+
+        wgpu::CommandBuffer commands = encoder.Finish();
+        queue.Submit(1, &commands);
+
+        EXPECT_PIXEL_RGBA8_EQ(expected, renderPass.color, 1, 1);
+    };
+
+    DrawWithBindGroup(parent, RGBA8(255, 0, 0, 255));
+    DrawWithBindGroup(redGreen, RGBA8(255, 255, 0, 255));
+    DrawWithBindGroup(blueGreen, RGBA8(0, 255, 255, 0));
+}
+
+// Test a bind group used at the same set by two pipeline layouts that only differ by the sets
+// after it. With vulkan_use_push_descriptors the last set of each layout uses push descriptors, so
+// the bind group is bound from a descriptor set in the first layout and pushed in the second.
+TEST_P(BindGroupTests, SameSetInLayoutsWithDifferentSetCounts) {
+    utils::BasicRenderPass renderPass = utils::CreateBasicRenderPass(device, kRTSize, kRTSize);
+
+    wgpu::BindGroupLayout layout = utils::MakeBindGroupLayout(
+        device, {{0, wgpu::ShaderStage::Fragment, wgpu::BindingType::UniformBuffer}});
+    wgpu::RenderPipeline twoSetsPipeline = MakeTestPipeline(
+        renderPass, {wgpu::BindingType::UniformBuffer, wgpu::BindingType::UniformBuffer},
+        {layout, layout});
+    wgpu::RenderPipeline oneSetPipeline =
+        MakeTestPipeline(renderPass, {wgpu::BindingType::UniformBuffer}, {layout});
+
+    // The colors are exactly representable in RGBA8Unorm so that the blended sum is exact.
+    std::array<float, 4> red = {64.f / 255.f, 0, 0, 0};
+    std::array<float, 4> green = {0, 1, 0, 1};
+    wgpu::Buffer redBuffer =
+        utils::CreateBufferFromData(device, &red, sizeof(red), wgpu::BufferUsage::Uniform);
+    wgpu::Buffer greenBuffer =
+        utils::CreateBufferFromData(device, &green, sizeof(green), wgpu::BufferUsage::Uniform);
+    wgpu::BindGroup redGroup = utils::MakeBindGroup(device, layout, {{0, redBuffer, 0, 16}});
+    wgpu::BindGroup greenGroup = utils::MakeBindGroup(device, layout, {{0, greenBuffer, 0, 16}});
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+    pass.SetPipeline(twoSetsPipeline);
+    pass.SetBindGroup(0, redGroup);
+    pass.SetBindGroup(1, greenGroup);
+    pass.Draw(3, 1, 0, 0);
+
+    // The bind group at set 0 is inherited by the frontend and must still be used.
+    pass.SetPipeline(oneSetPipeline);
+    pass.Draw(3, 1, 0, 0);
+
+    // And again when going back to the first layout.
+    pass.SetPipeline(twoSetsPipeline);
+    pass.Draw(3, 1, 0, 0);
+    pass.EndPass();
+
+    wgpu::CommandBuffer commands = encoder.Finish();
+    queue.Submit(1, &commands);
+
+    RGBA8 filled(192, 255, 0, 255);
+    RGBA8 notFilled(0, 0, 0, 0);
+    int min = 1, max = kRTSize - 3;
+    EXPECT_PIXEL_RGBA8_EQ(filled, renderPass.color, min, min);
+    EXPECT_PIXEL_RGBA8_EQ(notFilled, renderPass.color, max, max);
+}
+
+DAWN_INSTANTIATE_TEST(BindGroupTests,
+                      D3D12Backend,
+                      MetalBackend,
+                      OpenGLBackend,
+                      VulkanBackend,
+                      ForceToggles(VulkanBackend, {"vulkan_cache_descriptor_sets"}, {}),
+                      ForceToggles(VulkanBackend, {"vulkan_use_push_descriptors"}, {}));
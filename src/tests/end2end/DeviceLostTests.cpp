@@ -47,6 +47,10 @@ class DeviceLostTest : public DawnTest {
         mockDeviceLostCallback = nullptr;
     }
 
+    bool CanReuseDevice() const override {
+        return false;
+    }
+
     void SetCallbackAndLoseForTesting() {
         device.SetDeviceLostCallback(ToMockDeviceLostCallback, this);
         EXPECT_CALL(*mockDeviceLostCallback, Call(_, this)).Times(1);
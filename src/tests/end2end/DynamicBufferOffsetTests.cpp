@@ -403,8 +403,42 @@ TEST_P(DynamicBufferOffsetTests, UpdateDynamicOffsetsMultipleTimesComputePipelin
     EXPECT_BUFFER_U32_RANGE_EQ(expectedData.data(), mStorageBuffers[1], 0, expectedData.size());
 }
 
+// Setting the same bindgroup repeatedly with the same or restored dynamic offsets, as done when
+// drawing many objects out of the same dynamic uniform buffer.
+TEST_P(DynamicBufferOffsetTests, RedundantDynamicOffsetsRenderPipeline) {
+    wgpu::RenderPipeline pipeline = CreateRenderPipeline();
+
+    utils::BasicRenderPass renderPass = utils::CreateBasicRenderPass(device, kRTSize, kRTSize);
+
+    wgpu::CommandEncoder commandEncoder = device.CreateCommandEncoder();
+    std::array<uint32_t, 2> offsets = {kMinDynamicBufferOffsetAlignment,
+                                       kMinDynamicBufferOffsetAlignment};
+    std::array<uint32_t, 2> testOffsets = {0, 0};
+
+    wgpu::RenderPassEncoder renderPassEncoder =
+        commandEncoder.BeginRenderPass(&renderPass.renderPassInfo);
+    renderPassEncoder.SetPipeline(pipeline);
+    renderPassEncoder.SetBindGroup(0, mBindGroups[0], offsets.size(), offsets.data());
+    renderPassEncoder.Draw(3, 1, 0, 0);
+    renderPassEncoder.SetBindGroup(0, mBindGroups[0], offsets.size(), offsets.data());
+    renderPassEncoder.Draw(3, 1, 0, 0);
+    // Changing the offsets and restoring them before drawing must still use the restored ones.
+    renderPassEncoder.SetBindGroup(0, mBindGroups[0], testOffsets.size(), testOffsets.data());
+    renderPassEncoder.SetBindGroup(0, mBindGroups[0], offsets.size(), offsets.data());
+    renderPassEncoder.Draw(3, 1, 0, 0);
+    renderPassEncoder.EndPass();
+    wgpu::CommandBuffer commands = commandEncoder.Finish();
+    queue.Submit(1, &commands);
+
+    std::vector<uint32_t> expectedData = {6, 8};
+    EXPECT_PIXEL_RGBA8_EQ(RGBA8(5, 6, 255, 255), renderPass.color, 0, 0);
+    EXPECT_BUFFER_U32_RANGE_EQ(expectedData.data(), mStorageBuffers[1],
+                               kMinDynamicBufferOffsetAlignment, expectedData.size());
+}
+
 DAWN_INSTANTIATE_TEST(DynamicBufferOffsetTests,
                       D3D12Backend,
                       MetalBackend,
                       OpenGLBackend,
-                      VulkanBackend);
+                      VulkanBackend,
+                      ForceToggles(VulkanBackend, {"vulkan_use_push_descriptors"}, {}));
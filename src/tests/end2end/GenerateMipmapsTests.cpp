@@ -0,0 +1,197 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/DawnTest.h"
+
+#include "common/Constants.h"
+#include "utils/WGPUHelpers.h"
+
+#include <array>
+
+namespace {
+
+    constexpr uint32_t kSize = 8;
+    constexpr uint32_t kMipLevelCount = 4;
+
+}  // anonymous namespace
+
+// The tests fill a level with four quadrants of uniform values. Every 2x2 block that gets
+// downsampled is uniform until the quadrants are a single texel, so the expected content of the
+// levels doesn't depend on whether the backend filters linearly or with nearest filtering.
+class GenerateMipmapsTest : public DawnTest {
+  protected:
+    void TestSetUp() override {
+        // D3D12 rejects mipmap generation.
+        DAWN_SKIP_TEST_IF(IsD3D12());
+    }
+
+    wgpu::Texture CreateTexture(wgpu::TextureFormat format) {
+        wgpu::TextureDescriptor descriptor;
+        descriptor.dimension = wgpu::TextureDimension::e2D;
+        descriptor.size = {kSize, kSize, 1};
+        descriptor.format = format;
+        descriptor.mipLevelCount = kMipLevelCount;
+        descriptor.usage = wgpu::TextureUsage::CopySrc | wgpu::TextureUsage::CopyDst;
+        return device.CreateTexture(&descriptor);
+    }
+
+    template <typename T>
+    static std::vector<T> QuadrantsData(uint32_t size,
+                                        uint32_t texelsPerRow,
+                                        const std::array<T, 4>& quadrants,
+                                        T defaultValue = {}) {
+        std::vector<T> data(texelsPerRow * size, defaultValue);
+        for (uint32_t y = 0; y < size; ++y) {
+            for (uint32_t x = 0; x < size; ++x) {
+                data[y * texelsPerRow + x] = quadrants[(y * 2 / size) * 2 + x * 2 / size];
+            }
+        }
+        return data;
+    }
+
+    template <typename T>
+    void UploadQuadrants(const wgpu::Texture& texture,
+                         uint32_t level,
+                         const std::array<T, 4>& quadrants) {
+        uint32_t size = kSize >> level;
+        uint32_t texelsPerRow = kTextureRowPitchAlignment / sizeof(T);
+        std::vector<T> data = QuadrantsData(size, texelsPerRow, quadrants);
+
+        wgpu::Buffer buffer = utils::CreateBufferFromData(
+            device, data.data(), data.size() * sizeof(T), wgpu::BufferUsage::CopySrc);
+        wgpu::BufferCopyView bufferCopyView =
+            utils::CreateBufferCopyView(buffer, 0, kTextureRowPitchAlignment, 0);
+        wgpu::TextureCopyView textureCopyView =
+            utils::CreateTextureCopyView(texture, level, 0, {0, 0, 0});
+        wgpu::Extent3D copySize = {size, size, 1};
+
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        encoder.CopyBufferToTexture(&bufferCopyView, &textureCopyView, &copySize);
+        wgpu::CommandBuffer commands = encoder.Finish();
+        queue.Submit(1, &commands);
+    }
+
+    void GenerateMipmaps(const wgpu::Texture& texture, uint32_t baseLevel, uint32_t levelCount) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        encoder.GenerateMipmaps(texture, baseLevel, levelCount);
+        wgpu::CommandBuffer commands = encoder.Finish();
+        queue.Submit(1, &commands);
+    }
+
+    void ExpectLevel(const wgpu::Texture& texture,
+                     uint32_t level,
+                     const std::vector<RGBA8>& expected) {
+        uint32_t size = kSize >> level;
+        EXPECT_TEXTURE_RGBA8_EQ(expected.data(), texture, 0, 0, size, size, level, 0);
+    }
+
+    void ExpectLevel(const wgpu::Texture& texture,
+                     uint32_t level,
+                     const std::vector<float>& expected) {
+        uint32_t size = kSize >> level;
+        EXPECT_TEXTURE_FLOAT_EQ(expected.data(), texture, 0, 0, size, size, level, 0);
+    }
+
+    template <typename T>
+    void ExpectQuadrants(const wgpu::Texture& texture,
+                         uint32_t level,
+                         const std::array<T, 4>& quadrants) {
+        uint32_t size = kSize >> level;
+        ExpectLevel(texture, level, QuadrantsData(size, size, quadrants));
+    }
+
+    template <typename T>
+    void ExpectZero(const wgpu::Texture& texture, uint32_t level) {
+        uint32_t size = kSize >> level;
+        ExpectLevel(texture, level, std::vector<T>(size * size, T()));
+    }
+
+    // Generates all the levels but the last from level 0, which requires a barrier between the
+    // blits on Vulkan, and checks the last level is left untouched.
+    template <typename T>
+    void TestGenerateFromLevelZero(wgpu::TextureFormat format, const std::array<T, 4>& quadrants) {
+        wgpu::Texture texture = CreateTexture(format);
+        UploadQuadrants(texture, 0, quadrants);
+
+        GenerateMipmaps(texture, 0, kMipLevelCount - 1);
+
+        for (uint32_t level = 0; level < kMipLevelCount - 1; ++level) {
+            ExpectQuadrants(texture, level, quadrants);
+        }
+        ExpectZero<T>(texture, kMipLevelCount - 1);
+    }
+
+    // Generates levels from a base level that isn't the first one of the texture, which uses a
+    // view of the levels on Metal and restricts the base and max levels on OpenGL. The levels
+    // outside of the range must stay untouched and be readable afterwards.
+    template <typename T>
+    void TestGenerateFromNonZeroBaseLevel(wgpu::TextureFormat format,
+                                          const std::array<T, 4>& quadrants) {
+        wgpu::Texture texture = CreateTexture(format);
+        UploadQuadrants(texture, 1, quadrants);
+
+        GenerateMipmaps(texture, 1, 2);
+
+        ExpectZero<T>(texture, 0);
+        ExpectQuadrants(texture, 1, quadrants);
+        ExpectQuadrants(texture, 2, quadrants);
+        ExpectZero<T>(texture, 3);
+    }
+
+    const std::array<RGBA8, 4> kRGBA8Quadrants = {{
+        RGBA8(255, 0, 0, 255),
+        RGBA8(0, 255, 0, 255),
+        RGBA8(0, 0, 255, 255),
+        RGBA8(255, 255, 0, 255),
+    }};
+    const std::array<float, 4> kFloatQuadrants = {{1.0f, 2.0f, 3.0f, 4.0f}};
+};
+
+// Test generating mipmaps of an RGBA8Unorm texture, which supports linear filtering everywhere.
+TEST_P(GenerateMipmapsTest, RGBA8UnormFromLevelZero) {
+    TestGenerateFromLevelZero(wgpu::TextureFormat::RGBA8Unorm, kRGBA8Quadrants);
+}
+
+// Test generating mipmaps of an R32Float texture, which doesn't support linear filtering on some
+// devices so that the Vulkan backend falls back to nearest filtering.
+TEST_P(GenerateMipmapsTest, R32FloatFromLevelZero) {
+    TestGenerateFromLevelZero(wgpu::TextureFormat::R32Float, kFloatQuadrants);
+}
+
+// Test generating mipmaps from a base level that isn't the first level of the texture.
+TEST_P(GenerateMipmapsTest, RGBA8UnormFromNonZeroBaseLevel) {
+    TestGenerateFromNonZeroBaseLevel(wgpu::TextureFormat::RGBA8Unorm, kRGBA8Quadrants);
+}
+
+// Test generating mipmaps of an R32Float texture from a base level that isn't the first level.
+TEST_P(GenerateMipmapsTest, R32FloatFromNonZeroBaseLevel) {
+    TestGenerateFromNonZeroBaseLevel(wgpu::TextureFormat::R32Float, kFloatQuadrants);
+}
+
+// Test generating a single level is a no-op that keeps the other levels untouched.
+TEST_P(GenerateMipmapsTest, SingleLevelIsNoOp) {
+    wgpu::Texture texture = CreateTexture(wgpu::TextureFormat::RGBA8Unorm);
+    UploadQuadrants(texture, 0, kRGBA8Quadrants);
+
+    GenerateMipmaps(texture, 0, 1);
+
+    ExpectQuadrants(texture, 0, kRGBA8Quadrants);
+    ExpectZero<RGBA8>(texture, 1);
+}
+
+DAWN_INSTANTIATE_TEST(GenerateMipmapsTest,
+                      D3D12Backend,
+                      MetalBackend,
+                      OpenGLBackend,
+                      VulkanBackend);
@@ -0,0 +1,146 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/DawnTest.h"
+
+#include "common/Constants.h"
+#include "dawn_native/DawnNative.h"
+#include "utils/WGPUHelpers.h"
+
+class HeadlessSwapChainTests : public DawnTest {
+  protected:
+    struct ReceivedFrame {
+        uint64_t frameIndex;
+        uint64_t dataLength;
+        uint32_t bytesPerRow;
+        RGBA8 firstTexel;
+    };
+
+    static void OnFrame(uint64_t frameIndex,
+                        const void* data,
+                        uint64_t dataLength,
+                        uint32_t bytesPerRow,
+                        void* userdata) {
+        auto* self = static_cast<HeadlessSwapChainTests*>(userdata);
+        self->mReceivedFrames.push_back(
+            {frameIndex, dataLength, bytesPerRow, *static_cast<const RGBA8*>(data)});
+    }
+
+    wgpu::SwapChain CreateHeadlessSwapChain(uint32_t frameCount) {
+        dawn_native::HeadlessSwapChainDescriptor descriptor;
+        descriptor.frameCount = frameCount;
+        descriptor.callback = OnFrame;
+        descriptor.userdata = this;
+        return wgpu::SwapChain::Acquire(
+            dawn_native::CreateHeadlessSwapChain(device.Get(), &descriptor));
+    }
+
+    void ClearAndPresent(const wgpu::SwapChain& swapChain, const wgpu::Color& color) {
+        utils::ComboRenderPassDescriptor renderPass({swapChain.GetCurrentTextureView()});
+        renderPass.cColorAttachments[0].clearColor = color;
+
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        encoder.BeginRenderPass(&renderPass).EndPass();
+        wgpu::CommandBuffer commands = encoder.Finish();
+        queue.Submit(1, &commands);
+
+        swapChain.Present();
+    }
+
+    void WaitForFrames(size_t count) {
+        while (mReceivedFrames.size() < count) {
+            WaitABit();
+        }
+    }
+
+    std::vector<ReceivedFrame> mReceivedFrames;
+};
+
+// Test that presented frames are read back in order with their content.
+TEST_P(HeadlessSwapChainTests, FramesAreReadBack) {
+    // The headless swap chain is only available in dawn_native.
+    DAWN_SKIP_TEST_IF(UsesWire());
+
+    wgpu::SwapChain swapChain = CreateHeadlessSwapChain(3);
+    swapChain.Configure(wgpu::TextureFormat::RGBA8Unorm, wgpu::TextureUsage::OutputAttachment, 4,
+                        4);
+
+    ClearAndPresent(swapChain, {1.0f, 0.0f, 0.0f, 1.0f});
+    ClearAndPresent(swapChain, {0.0f, 1.0f, 0.0f, 1.0f});
+    ClearAndPresent(swapChain, {0.0f, 0.0f, 1.0f, 1.0f});
+    WaitForFrames(3);
+
+    ASSERT_EQ(3u, mReceivedFrames.size());
+    EXPECT_EQ(RGBA8(255, 0, 0, 255), mReceivedFrames[0].firstTexel);
+    EXPECT_EQ(RGBA8(0, 255, 0, 255), mReceivedFrames[1].firstTexel);
+    EXPECT_EQ(RGBA8(0, 0, 255, 255), mReceivedFrames[2].firstTexel);
+    for (uint64_t i = 0; i < mReceivedFrames.size(); ++i) {
+        EXPECT_EQ(i, mReceivedFrames[i].frameIndex);
+        EXPECT_EQ(kTextureRowPitchAlignment, mReceivedFrames[i].bytesPerRow);
+        EXPECT_EQ(4u * kTextureRowPitchAlignment, mReceivedFrames[i].dataLength);
+    }
+}
+
+// Test that reconfiguring the swap chain changes the size of the frames read back.
+TEST_P(HeadlessSwapChainTests, Reconfigure) {
+    DAWN_SKIP_TEST_IF(UsesWire());
+
+    wgpu::SwapChain swapChain = CreateHeadlessSwapChain(1);
+    swapChain.Configure(wgpu::TextureFormat::RGBA8Unorm, wgpu::TextureUsage::OutputAttachment, 4,
+                        4);
+    ClearAndPresent(swapChain, {1.0f, 0.0f, 0.0f, 1.0f});
+    WaitForFrames(1);
+
+    swapChain.Configure(wgpu::TextureFormat::RGBA8Unorm, wgpu::TextureUsage::OutputAttachment, 100,
+                        2);
+    ClearAndPresent(swapChain, {0.0f, 1.0f, 0.0f, 1.0f});
+    WaitForFrames(2);
+
+    EXPECT_EQ(kTextureRowPitchAlignment, mReceivedFrames[0].bytesPerRow);
+    EXPECT_EQ(2u * kTextureRowPitchAlignment * 2u, mReceivedFrames[1].dataLength);
+    EXPECT_EQ(RGBA8(0, 255, 0, 255), mReceivedFrames[1].firstTexel);
+}
+
+// Test that limiting the frame latency makes acquiring a frame wait for the previous ones and that
+// their timings are reported.
+TEST_P(HeadlessSwapChainTests, MaxFrameLatency) {
+    DAWN_SKIP_TEST_IF(UsesWire());
+
+    wgpu::SwapChain swapChain = CreateHeadlessSwapChain(3);
+    swapChain.Configure(wgpu::TextureFormat::RGBA8Unorm, wgpu::TextureUsage::OutputAttachment, 4,
+                        4);
+    dawn_native::SetSwapChainMaxFrameLatency(swapChain.Get(), 1);
+
+    dawn_native::SwapChainFrameStatistics statistics;
+    EXPECT_FALSE(dawn_native::GetSwapChainFrameStatistics(swapChain.Get(), &statistics));
+
+    ClearAndPresent(swapChain, {1.0f, 0.0f, 0.0f, 1.0f});
+    ClearAndPresent(swapChain, {0.0f, 1.0f, 0.0f, 1.0f});
+
+    // Acquiring the second frame waited for the first one to complete.
+    ASSERT_TRUE(dawn_native::GetSwapChainFrameStatistics(swapChain.Get(), &statistics));
+    EXPECT_LE(statistics.acquireTime, statistics.presentTime);
+    EXPECT_LE(statistics.presentTime, statistics.gpuCompleteTime);
+
+    // The third frame waits for the second one.
+    swapChain.GetCurrentTextureView();
+    ASSERT_TRUE(dawn_native::GetSwapChainFrameStatistics(swapChain.Get(), &statistics));
+    EXPECT_EQ(1u, statistics.frameIndex);
+}
+
+DAWN_INSTANTIATE_TEST(HeadlessSwapChainTests,
+                      D3D12Backend,
+                      MetalBackend,
+                      OpenGLBackend,
+                      VulkanBackend);
@@ -0,0 +1,123 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/DawnTest.h"
+
+#include "common/Constants.h"
+#include "utils/WGPUHelpers.h"
+
+namespace {
+
+    constexpr uint64_t kHeapSize = 1 << 20;
+    constexpr uint32_t kSize = 8;
+
+}  // anonymous namespace
+
+// Backends that don't alias placed resources give them their own memory, so these tests check
+// that aliasing is invisible: a resource placed over memory used by another one reads zeros.
+class HeapTests : public DawnTest {
+  protected:
+    wgpu::Heap CreateHeap() {
+        wgpu::HeapDescriptor descriptor;
+        descriptor.size = kHeapSize;
+        return device.CreateHeap(&descriptor);
+    }
+
+    wgpu::Texture CreatePlacedTexture(const wgpu::PlacedResourceDescriptor* placement) {
+        wgpu::TextureDescriptor descriptor;
+        descriptor.nextInChain = placement;
+        descriptor.dimension = wgpu::TextureDimension::e2D;
+        descriptor.size = {kSize, kSize, 1};
+        descriptor.format = wgpu::TextureFormat::RGBA8Unorm;
+        descriptor.usage = wgpu::TextureUsage::CopySrc | wgpu::TextureUsage::CopyDst;
+        return device.CreateTexture(&descriptor);
+    }
+
+    wgpu::Buffer CreatePlacedBuffer(const wgpu::PlacedResourceDescriptor* placement,
+                                    uint64_t size) {
+        wgpu::BufferDescriptor descriptor;
+        descriptor.nextInChain = placement;
+        descriptor.size = size;
+        descriptor.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::CopyDst;
+        return device.CreateBuffer(&descriptor);
+    }
+
+    void FillTexture(const wgpu::Texture& texture, RGBA8 color) {
+        uint32_t texelsPerRow = kTextureRowPitchAlignment / sizeof(RGBA8);
+        std::vector<RGBA8> data(texelsPerRow * kSize, color);
+        wgpu::Buffer buffer = utils::CreateBufferFromData(
+            device, data.data(), data.size() * sizeof(RGBA8), wgpu::BufferUsage::CopySrc);
+
+        wgpu::BufferCopyView bufferCopyView =
+            utils::CreateBufferCopyView(buffer, 0, kTextureRowPitchAlignment, 0);
+        wgpu::TextureCopyView textureCopyView =
+            utils::CreateTextureCopyView(texture, 0, 0, {0, 0, 0});
+        wgpu::Extent3D copySize = {kSize, kSize, 1};
+
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        encoder.CopyBufferToTexture(&bufferCopyView, &textureCopyView, &copySize);
+        wgpu::CommandBuffer commands = encoder.Finish();
+        queue.Submit(1, &commands);
+    }
+};
+
+// Test that a texture placed over the memory of another texture is cleared before it is read.
+TEST_P(HeapTests, AliasedTextureReadsZeros) {
+    wgpu::PlacedResourceDescriptor placement;
+    placement.heap = CreateHeap();
+
+    wgpu::Texture first = CreatePlacedTexture(&placement);
+    FillTexture(first, RGBA8(255, 0, 0, 255));
+    std::vector<RGBA8> expectedFirst(kSize * kSize, RGBA8(255, 0, 0, 255));
+    EXPECT_TEXTURE_RGBA8_EQ(expectedFirst.data(), first, 0, 0, kSize, kSize, 0, 0);
+
+    wgpu::Texture second = CreatePlacedTexture(&placement);
+    std::vector<RGBA8> expectedSecond(kSize * kSize, RGBA8(0, 0, 0, 0));
+    EXPECT_TEXTURE_RGBA8_EQ(expectedSecond.data(), second, 0, 0, kSize, kSize, 0, 0);
+}
+
+// Test that a texture placed over the memory of a buffer is cleared before it is read.
+TEST_P(HeapTests, TextureAliasingBufferReadsZeros) {
+    wgpu::PlacedResourceDescriptor placement;
+    placement.heap = CreateHeap();
+
+    constexpr uint32_t kBufferValueCount = kSize * kSize;
+    wgpu::Buffer buffer = CreatePlacedBuffer(&placement, kBufferValueCount * sizeof(uint32_t));
+    std::vector<uint32_t> data(kBufferValueCount, 0xFFFFFFFF);
+    buffer.SetSubData(0, data.size() * sizeof(uint32_t), data.data());
+    EXPECT_BUFFER_U32_RANGE_EQ(data.data(), buffer, 0, kBufferValueCount);
+
+    wgpu::Texture texture = CreatePlacedTexture(&placement);
+    std::vector<RGBA8> expected(kSize * kSize, RGBA8(0, 0, 0, 0));
+    EXPECT_TEXTURE_RGBA8_EQ(expected.data(), texture, 0, 0, kSize, kSize, 0, 0);
+}
+
+// Test that a resource that used the memory first keeps working after another resource aliased
+// it, once it overwrites its content.
+TEST_P(HeapTests, ReacquiredTextureCanBeReused) {
+    wgpu::PlacedResourceDescriptor placement;
+    placement.heap = CreateHeap();
+
+    wgpu::Texture first = CreatePlacedTexture(&placement);
+    wgpu::Texture second = CreatePlacedTexture(&placement);
+
+    FillTexture(first, RGBA8(255, 0, 0, 255));
+    FillTexture(second, RGBA8(0, 255, 0, 255));
+    FillTexture(first, RGBA8(0, 0, 255, 255));
+
+    std::vector<RGBA8> expected(kSize * kSize, RGBA8(0, 0, 255, 255));
+    EXPECT_TEXTURE_RGBA8_EQ(expected.data(), first, 0, 0, kSize, kSize, 0, 0);
+}
+
+DAWN_INSTANTIATE_TEST(HeapTests, D3D12Backend, MetalBackend, OpenGLBackend, VulkanBackend);
@@ -244,6 +244,42 @@ TEST_P(MultisampledRenderingTest, ResolveInto2DTexture) {
     VerifyResolveTarget(kGreen, mResolveTexture);
 }
 
+// Test that a transient multisampled color attachment that is discarded at the end of the pass
+// is still resolved correctly.
+TEST_P(MultisampledRenderingTest, ResolveTransientAttachment) {
+    constexpr bool kTestDepth = false;
+    wgpu::CommandEncoder commandEncoder = device.CreateCommandEncoder();
+    wgpu::RenderPipeline pipeline = CreateRenderPipelineWithOneOutputForTest(kTestDepth);
+
+    wgpu::TextureDescriptor descriptor;
+    descriptor.dimension = wgpu::TextureDimension::e2D;
+    descriptor.size = {kWidth, kHeight, 1};
+    descriptor.sampleCount = kSampleCount;
+    descriptor.format = kColorFormat;
+    descriptor.usage =
+        wgpu::TextureUsage::OutputAttachment | wgpu::TextureUsage::TransientAttachment;
+    wgpu::TextureView transientColorView = device.CreateTexture(&descriptor).CreateView();
+
+    constexpr wgpu::Color kGreen = {0.0f, 0.8f, 0.0f, 0.8f};
+    constexpr uint32_t kSize = sizeof(kGreen);
+
+    // Draw a green triangle.
+    {
+        utils::ComboRenderPassDescriptor renderPass = CreateComboRenderPassDescriptorForTest(
+            {transientColorView}, {mResolveView}, wgpu::LoadOp::Clear, wgpu::LoadOp::Clear,
+            kTestDepth);
+        renderPass.cColorAttachments[0].storeOp = wgpu::StoreOp::Clear;
+
+        EncodeRenderPassForTest(commandEncoder, renderPass, pipeline, &kGreen.r, kSize);
+    }
+
+    wgpu::CommandBuffer commandBuffer = commandEncoder.Finish();
+    wgpu::Queue queue = device.CreateQueue();
+    queue.Submit(1, &commandBuffer);
+
+    VerifyResolveTarget(kGreen, mResolveTexture);
+}
+
 // Test multisampled rendering with depth test works correctly.
 TEST_P(MultisampledRenderingTest, MultisampledRenderingWithDepthTest) {
     constexpr bool kTestDepth = true;
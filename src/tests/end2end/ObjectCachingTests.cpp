@@ -215,6 +215,44 @@ TEST_P(ObjectCachingTest, ComputePipelineDeduplicationOnLayout) {
     EXPECT_EQ(pipeline.Get() == samePipeline.Get(), !UsesWire());
 }
 
+// Test that ComputePipelines are correctly deduplicated wrt. their specialization constants
+TEST_P(ObjectCachingTest, ComputePipelineDeduplicationOnSpecializationConstants) {
+    wgpu::ComputePipelineDescriptor desc;
+    desc.computeStage.entryPoint = "main";
+    desc.computeStage.module =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Compute, R"(
+            #version 450
+            layout(constant_id = 0) const uint kValue = 0;
+            layout(constant_id = 1) const float kOtherValue = 0.0;
+            shared float i;
+            void main() {
+                i = kValue + kOtherValue;
+            })");
+    desc.layout = utils::MakeBasicPipelineLayout(device, nullptr);
+
+    // The order of the constants doesn't matter.
+    wgpu::SpecializationConstant constants[2] = {{0, 1.0}, {1, 2.0}};
+    wgpu::SpecializationConstant sameConstants[2] = {{1, 2.0}, {0, 1.0}};
+    wgpu::SpecializationConstant otherConstants[2] = {{0, 1.0}, {1, 3.0}};
+
+    desc.computeStage.constantCount = 2;
+    desc.computeStage.constants = constants;
+    wgpu::ComputePipeline pipeline = device.CreateComputePipeline(&desc);
+
+    desc.computeStage.constants = sameConstants;
+    wgpu::ComputePipeline samePipeline = device.CreateComputePipeline(&desc);
+
+    desc.computeStage.constants = otherConstants;
+    wgpu::ComputePipeline otherPipeline = device.CreateComputePipeline(&desc);
+
+    desc.computeStage.constantCount = 0;
+    wgpu::ComputePipeline defaultPipeline = device.CreateComputePipeline(&desc);
+
+    EXPECT_NE(pipeline.Get(), otherPipeline.Get());
+    EXPECT_NE(pipeline.Get(), defaultPipeline.Get());
+    EXPECT_EQ(pipeline.Get() == samePipeline.Get(), !UsesWire());
+}
+
 // Test that RenderPipelines are correctly deduplicated wrt. their layout
 TEST_P(ObjectCachingTest, RenderPipelineDeduplicationOnLayout) {
     wgpu::BindGroupLayout bgl = utils::MakeBindGroupLayout(
@@ -0,0 +1,213 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/DawnTest.h"
+
+#include "utils/ComboRenderPipelineDescriptor.h"
+#include "utils/WGPUHelpers.h"
+
+#include <string>
+
+constexpr uint32_t kRTSize = 16;
+constexpr wgpu::TextureFormat kColorFormat = wgpu::TextureFormat::RGBA8Unorm;
+constexpr wgpu::TextureFormat kDepthFormat = wgpu::TextureFormat::Depth32Float;
+
+// Tests consecutive render passes on the same attachments that load what the previous pass
+// stored. Backends that merge them, like Vulkan with the merge_render_passes toggle, must give the
+// same results as when the passes are recorded separately.
+class RenderPassMergingTest : public DawnTest {
+  protected:
+    enum class Triangle {
+        TopLeft,
+        BottomRight,
+        FullScreen,
+    };
+
+    wgpu::Texture CreateAttachment(wgpu::TextureFormat format) {
+        wgpu::TextureDescriptor descriptor;
+        descriptor.dimension = wgpu::TextureDimension::e2D;
+        descriptor.size = {kRTSize, kRTSize, 1};
+        descriptor.format = format;
+        descriptor.usage = wgpu::TextureUsage::OutputAttachment | wgpu::TextureUsage::CopySrc;
+        return device.CreateTexture(&descriptor);
+    }
+
+    // Creates a pipeline drawing `triangle` in `color` at `depth`. When `depthCompare` isn't
+    // Always, the pipeline has a depth attachment that it tests and writes.
+    wgpu::RenderPipeline CreatePipeline(Triangle triangle,
+                                        RGBA8 color,
+                                        float depth,
+                                        wgpu::CompareFunction depthCompare) {
+        const char* positions = "";
+        switch (triangle) {
+            case Triangle::TopLeft:
+                positions = "vec2(-1.f, 1.f), vec2(1.f, 1.f), vec2(-1.f, -1.f)";
+                break;
+            case Triangle::BottomRight:
+                positions = "vec2(1.f, 1.f), vec2(1.f, -1.f), vec2(-1.f, -1.f)";
+                break;
+            case Triangle::FullScreen:
+                positions = "vec2(-1.f, -1.f), vec2(3.f, -1.f), vec2(-1.f, 3.f)";
+                break;
+        }
+
+        std::string vertexSource = R"(
+            #version 450
+            void main() {
+                const vec2 pos[3] = vec2[3]()" +
+                                   std::string(positions) + R"();
+                gl_Position = vec4(pos[gl_VertexIndex], )" +
+                                   std::to_string(depth) + R"(, 1.f);
+            })";
+        std::string fragmentSource = R"(
+            #version 450
+            layout(location = 0) out vec4 fragColor;
+            void main() {
+                fragColor = vec4()" + std::to_string(color.r / 255.f) +
+                                     ", " + std::to_string(color.g / 255.f) + ", " +
+                                     std::to_string(color.b / 255.f) + ", " +
+                                     std::to_string(color.a / 255.f) + R"();
+            })";
+
+        utils::ComboRenderPipelineDescriptor descriptor(device);
+        descriptor.vertexStage.module = utils::CreateShaderModule(
+            device, utils::SingleShaderStage::Vertex, vertexSource.c_str());
+        descriptor.cFragmentStage.module = utils::CreateShaderModule(
+            device, utils::SingleShaderStage::Fragment, fragmentSource.c_str());
+        descriptor.cColorStates[0].format = kColorFormat;
+
+        if (depthCompare != wgpu::CompareFunction::Always) {
+            descriptor.cDepthStencilState.format = kDepthFormat;
+            descriptor.cDepthStencilState.depthWriteEnabled = true;
+            descriptor.cDepthStencilState.depthCompare = depthCompare;
+            descriptor.depthStencilState = &descriptor.cDepthStencilState;
+        }
+
+        return device.CreateRenderPipeline(&descriptor);
+    }
+
+    void LoadAll(utils::ComboRenderPassDescriptor* renderPass) {
+        renderPass->cColorAttachments[0].loadOp = wgpu::LoadOp::Load;
+        renderPass->cDepthStencilAttachmentInfo.depthLoadOp = wgpu::LoadOp::Load;
+        renderPass->cDepthStencilAttachmentInfo.stencilLoadOp = wgpu::LoadOp::Load;
+    }
+};
+
+// Test that drawing in a pass that continues the previous one keeps what the previous pass drew.
+TEST_P(RenderPassMergingTest, ColorIsKept) {
+    wgpu::Texture color = CreateAttachment(kColorFormat);
+    wgpu::RenderPipeline topLeftGreen =
+        CreatePipeline(Triangle::TopLeft, RGBA8::kGreen, 0.f, wgpu::CompareFunction::Always);
+    wgpu::RenderPipeline bottomRightBlue =
+        CreatePipeline(Triangle::BottomRight, RGBA8::kBlue, 0.f, wgpu::CompareFunction::Always);
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    {
+        utils::ComboRenderPassDescriptor renderPass({color.CreateView()});
+        renderPass.cColorAttachments[0].clearColor = {1.0f, 0.0f, 0.0f, 1.0f};
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass);
+        pass.SetPipeline(topLeftGreen);
+        pass.Draw(3, 1, 0, 0);
+        pass.EndPass();
+    }
+    {
+        utils::ComboRenderPassDescriptor renderPass({color.CreateView()});
+        LoadAll(&renderPass);
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass);
+        pass.SetPipeline(bottomRightBlue);
+        pass.Draw(3, 1, 0, 0);
+        pass.EndPass();
+    }
+    {
+        // A pass that doesn't draw must keep the content too.
+        utils::ComboRenderPassDescriptor renderPass({color.CreateView()});
+        LoadAll(&renderPass);
+        encoder.BeginRenderPass(&renderPass).EndPass();
+    }
+    wgpu::CommandBuffer commands = encoder.Finish();
+    queue.Submit(1, &commands);
+
+    EXPECT_PIXEL_RGBA8_EQ(RGBA8::kGreen, color, 1, 1);
+    EXPECT_PIXEL_RGBA8_EQ(RGBA8::kBlue, color, kRTSize - 2, kRTSize - 2);
+}
+
+// Test that the depth a pass writes is used by the depth test of the pass continuing it.
+TEST_P(RenderPassMergingTest, DepthIsKept) {
+    wgpu::Texture color = CreateAttachment(kColorFormat);
+    wgpu::Texture depth = CreateAttachment(kDepthFormat);
+    wgpu::RenderPipeline fullScreenRed =
+        CreatePipeline(Triangle::FullScreen, RGBA8::kRed, 0.5f, wgpu::CompareFunction::Less);
+    wgpu::RenderPipeline fullScreenGreenBehind =
+        CreatePipeline(Triangle::FullScreen, RGBA8::kGreen, 0.7f, wgpu::CompareFunction::Less);
+    wgpu::RenderPipeline bottomRightBlueInFront =
+        CreatePipeline(Triangle::BottomRight, RGBA8::kBlue, 0.3f, wgpu::CompareFunction::Less);
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    {
+        utils::ComboRenderPassDescriptor renderPass({color.CreateView()}, depth.CreateView());
+        renderPass.cDepthStencilAttachmentInfo.clearDepth = 1.0f;
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass);
+        pass.SetPipeline(fullScreenRed);
+        pass.Draw(3, 1, 0, 0);
+        pass.EndPass();
+    }
+    {
+        utils::ComboRenderPassDescriptor renderPass({color.CreateView()}, depth.CreateView());
+        LoadAll(&renderPass);
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass);
+        pass.SetPipeline(fullScreenGreenBehind);
+        pass.Draw(3, 1, 0, 0);
+        pass.SetPipeline(bottomRightBlueInFront);
+        pass.Draw(3, 1, 0, 0);
+        pass.EndPass();
+    }
+    wgpu::CommandBuffer commands = encoder.Finish();
+    queue.Submit(1, &commands);
+
+    EXPECT_PIXEL_RGBA8_EQ(RGBA8::kRed, color, 1, 1);
+    EXPECT_PIXEL_RGBA8_EQ(RGBA8::kBlue, color, kRTSize - 2, kRTSize - 2);
+}
+
+// Test that a pass that clears its attachments, which can't be merged, still clears them.
+TEST_P(RenderPassMergingTest, ClearingPassOverwrites) {
+    wgpu::Texture color = CreateAttachment(kColorFormat);
+    wgpu::RenderPipeline topLeftGreen =
+        CreatePipeline(Triangle::TopLeft, RGBA8::kGreen, 0.f, wgpu::CompareFunction::Always);
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    {
+        utils::ComboRenderPassDescriptor renderPass({color.CreateView()});
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass);
+        pass.SetPipeline(topLeftGreen);
+        pass.Draw(3, 1, 0, 0);
+        pass.EndPass();
+    }
+    {
+        utils::ComboRenderPassDescriptor renderPass({color.CreateView()});
+        renderPass.cColorAttachments[0].clearColor = {0.0f, 0.0f, 1.0f, 1.0f};
+        encoder.BeginRenderPass(&renderPass).EndPass();
+    }
+    wgpu::CommandBuffer commands = encoder.Finish();
+    queue.Submit(1, &commands);
+
+    EXPECT_PIXEL_RGBA8_EQ(RGBA8::kBlue, color, 1, 1);
+    EXPECT_PIXEL_RGBA8_EQ(RGBA8::kBlue, color, kRTSize - 2, kRTSize - 2);
+}
+
+DAWN_INSTANTIATE_TEST(RenderPassMergingTest,
+                      D3D12Backend,
+                      MetalBackend,
+                      OpenGLBackend,
+                      VulkanBackend,
+                      ForceToggles(VulkanBackend, {"merge_render_passes"}, {}));
@@ -0,0 +1,154 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/DawnTest.h"
+
+#include "utils/WGPUHelpers.h"
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace {
+
+    constexpr uint32_t kConstantCount = 4;
+
+    uint32_t FloatBits(float value) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+}  // anonymous namespace
+
+// Backends give the values to the driver as raw bits (Vulkan, Metal) or as literals in the
+// translated source (D3D12, OpenGL). The shader writes the bits of its constants to a storage
+// buffer so that the tests check the exact values on every backend.
+class SpecializationConstantTests : public DawnTest {
+  protected:
+    void TestSetUp() override {
+        DawnTest::TestSetUp();
+
+        mModule = utils::CreateShaderModule(device, utils::SingleShaderStage::Compute, R"(
+            #version 450
+            layout(constant_id = 0) const bool kBool = true;
+            layout(constant_id = 1) const int kInt = -5;
+            layout(constant_id = 2) const uint kUint = 7;
+            layout(constant_id = 3) const float kFloat = 1.5;
+            layout(std430, set = 0, binding = 0) buffer Result {
+                uint values[4];
+            } result;
+            void main() {
+                result.values[0] = kBool ? 1u : 0u;
+                result.values[1] = uint(kInt);
+                result.values[2] = kUint;
+                result.values[3] = floatBitsToUint(kFloat);
+            })");
+    }
+
+    // Runs the shader with `constants` and checks the bits of the bool, int32, uint32 and f32
+    // constants it writes.
+    void TestConstants(const std::vector<wgpu::SpecializationConstant>& constants,
+                       const std::array<uint32_t, kConstantCount>& expected) {
+        wgpu::ComputePipelineDescriptor descriptor;
+        descriptor.computeStage.module = mModule;
+        descriptor.computeStage.entryPoint = "main";
+        descriptor.computeStage.constantCount = static_cast<uint32_t>(constants.size());
+        descriptor.computeStage.constants = constants.data();
+        wgpu::ComputePipeline pipeline = device.CreateComputePipeline(&descriptor);
+
+        wgpu::BufferDescriptor bufferDescriptor;
+        bufferDescriptor.size = kConstantCount * sizeof(uint32_t);
+        bufferDescriptor.usage = wgpu::BufferUsage::Storage | wgpu::BufferUsage::CopySrc;
+        wgpu::Buffer buffer = device.CreateBuffer(&bufferDescriptor);
+
+        wgpu::BindGroup bindGroup =
+            utils::MakeBindGroup(device, pipeline.GetBindGroupLayout(0),
+                                 {{0, buffer, 0, kConstantCount * sizeof(uint32_t)}});
+
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::ComputePassEncoder pass = encoder.BeginComputePass();
+        pass.SetPipeline(pipeline);
+        pass.SetBindGroup(0, bindGroup);
+        pass.Dispatch(1, 1, 1);
+        pass.EndPass();
+        wgpu::CommandBuffer commands = encoder.Finish();
+        queue.Submit(1, &commands);
+
+        EXPECT_BUFFER_U32_RANGE_EQ(expected.data(), buffer, 0, kConstantCount);
+    }
+
+    wgpu::ShaderModule mModule;
+};
+
+// Test that the default values of the module are used when no constant is given.
+TEST_P(SpecializationConstantTests, DefaultValues) {
+    TestConstants({}, {1u, static_cast<uint32_t>(-5), 7u, FloatBits(1.5f)});
+}
+
+// Test overriding all the constants.
+TEST_P(SpecializationConstantTests, AllOverridden) {
+    TestConstants({{0, 0.0}, {1, 42.0}, {2, 3.0}, {3, -0.25}},
+                  {0u, 42u, 3u, FloatBits(-0.25f)});
+}
+
+// Test that constants that aren't overridden keep their default value.
+TEST_P(SpecializationConstantTests, PartiallyOverridden) {
+    TestConstants({{2, 11.0}}, {1u, static_cast<uint32_t>(-5), 11u, FloatBits(1.5f)});
+}
+
+// Test the limits of the integer types, including INT32_MIN that can't be written as a single
+// negative literal in the translated source.
+TEST_P(SpecializationConstantTests, IntegerLimits) {
+    constexpr int32_t kInt32Min = std::numeric_limits<int32_t>::min();
+    constexpr int32_t kInt32Max = std::numeric_limits<int32_t>::max();
+    constexpr uint32_t kUint32Max = std::numeric_limits<uint32_t>::max();
+
+    TestConstants({{1, double(kInt32Min)}, {2, double(kUint32Max)}},
+                  {1u, static_cast<uint32_t>(kInt32Min), kUint32Max, FloatBits(1.5f)});
+    TestConstants({{1, double(kInt32Max)}, {2, 0.0}},
+                  {1u, static_cast<uint32_t>(kInt32Max), 0u, FloatBits(1.5f)});
+}
+
+// Test that float constants are rounded to the nearest f32 and that values that need all the
+// significant digits of a float round-trip exactly through the literals of the translated source.
+TEST_P(SpecializationConstantTests, FloatPrecision) {
+    float afterOne = std::nextafter(1.0f, 2.0f);
+    TestConstants({{3, double(afterOne)}},
+                  {1u, static_cast<uint32_t>(-5), 7u, FloatBits(afterOne)});
+
+    TestConstants({{3, 0.1}}, {1u, static_cast<uint32_t>(-5), 7u, FloatBits(0.1f)});
+
+    float largest = std::numeric_limits<float>::max();
+    TestConstants({{3, double(largest)}},
+                  {1u, static_cast<uint32_t>(-5), 7u, FloatBits(largest)});
+
+    float smallestNormal = std::numeric_limits<float>::min();
+    TestConstants({{3, double(smallestNormal)}},
+                  {1u, static_cast<uint32_t>(-5), 7u, FloatBits(smallestNormal)});
+}
+
+// Test that any non-zero value is true for bool constants.
+TEST_P(SpecializationConstantTests, BoolFromNonZero) {
+    TestConstants({{0, 0.0}}, {0u, static_cast<uint32_t>(-5), 7u, FloatBits(1.5f)});
+    TestConstants({{0, 2.0}}, {1u, static_cast<uint32_t>(-5), 7u, FloatBits(1.5f)});
+}
+
+DAWN_INSTANTIATE_TEST(SpecializationConstantTests,
+                      D3D12Backend,
+                      MetalBackend,
+                      OpenGLBackend,
+                      VulkanBackend);
@@ -20,8 +20,11 @@
 #include "tests/perf_tests/DawnPerfTestPlatform.h"
 #include "utils/Timer.h"
 
+#include <algorithm>
+#include <cstdio>
 #include <fstream>
 #include <limits>
+#include <sstream>
 
 namespace {
 
@@ -67,6 +70,47 @@ namespace {
         outFile.close();
     }
 
+    void WriteJSONString(std::ostream& out, const std::string& value) {
+        out << "\"";
+        for (char c : value) {
+            switch (c) {
+                case '"':
+                case '\\':
+                    out << '\\' << c;
+                    break;
+                case '\n':
+                    out << "\\n";
+                    break;
+                case '\t':
+                    out << "\\t";
+                    break;
+                default:
+                    // Other control characters, that can come from driver names or --commit, have
+                    // to be escaped for the JSON to stay valid.
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        char escaped[7];
+                        snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                        out << escaped;
+                    } else {
+                        out << c;
+                    }
+                    break;
+            }
+        }
+        out << "\"";
+    }
+
+    void WriteJSONStringArray(std::ostream& out, const std::vector<std::string>& values) {
+        out << "[";
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (i != 0) {
+                out << ", ";
+            }
+            WriteJSONString(out, values[i]);
+        }
+        out << "]";
+    }
+
 }  // namespace
 
 void InitDawnPerfTestEnvironment(int argc, char** argv) {
@@ -92,6 +136,30 @@ DawnPerfTestEnvironment::DawnPerfTestEnvironment(int argc, char** argv)
             continue;
         }
 
+        constexpr const char kTrialsArg[] = "--trials=";
+        if (strstr(argv[i], kTrialsArg) == argv[i]) {
+            const char* trials = argv[i] + strlen(kTrialsArg);
+            if (trials[0] != '\0' && strtoul(trials, nullptr, 0) > 0) {
+                mNumTrials = strtoul(trials, nullptr, 0);
+            }
+            continue;
+        }
+
+        constexpr const char kResultsFileArg[] = "--results-file=";
+        if (strstr(argv[i], kResultsFileArg) == argv[i]) {
+            const char* resultsFile = argv[i] + strlen(kResultsFileArg);
+            if (resultsFile[0] != '\0') {
+                mResultsFile = resultsFile;
+            }
+            continue;
+        }
+
+        constexpr const char kCommitArg[] = "--commit=";
+        if (strstr(argv[i], kCommitArg) == argv[i]) {
+            mCommit = argv[i] + strlen(kCommitArg);
+            continue;
+        }
+
         constexpr const char kTraceFileArg[] = "--trace-file=";
         if (strstr(argv[i], kTraceFileArg) == argv[i]) {
             const char* traceFile = argv[i] + strlen(kTraceFileArg);
@@ -104,11 +172,16 @@ DawnPerfTestEnvironment::DawnPerfTestEnvironment(int argc, char** argv)
         if (strcmp("-h", argv[i]) == 0 || strcmp("--help", argv[i]) == 0) {
             dawn::InfoLog()
                 << "Additional flags:"
-                << " [--calibration] [--override-steps=x] [--trace-file=file]\n"
+                << " [--calibration] [--override-steps=x] [--trials=x] [--trace-file=file]"
+                   " [--results-file=file] [--commit=hash]\n"
                 << "  --calibration: Only run calibration. Calibration allows the perf test"
                    " runner script to save some time.\n"
                 << " --override-steps: Set a fixed number of steps to run for each test\n"
-                << " --trace-file: The file to dump trace results.\n";
+                << " --trials: The number of times each test is measured (defaults to 3)\n"
+                << " --trace-file: The file to dump trace results.\n"
+                << " --results-file: The file to write the results to as JSON, for"
+                   " scripts/perf_compare.py.\n"
+                << " --commit: The commit being tested, recorded in the results file.\n";
             continue;
         }
     }
@@ -119,6 +192,12 @@ DawnPerfTestEnvironment::~DawnPerfTestEnvironment() = default;
 void DawnPerfTestEnvironment::SetUp() {
     DawnTestEnvironment::SetUp();
 
+#if defined(DAWN_PERF_TESTS_USE_DIRECT_PROCS)
+    // The wgpu* functions are implemented directly by dawn_native in this configuration, they
+    // can't be routed through the wire client.
+    ASSERT_FALSE(UsesWire()) << "The wire can't be used with dawn_perf_tests_use_direct_procs";
+#endif
+
     mPlatform = std::make_unique<DawnPerfTestPlatform>();
     mInstance->SetPlatform(mPlatform.get());
 
@@ -149,6 +228,43 @@ void DawnPerfTestEnvironment::TearDown() {
         outFile.close();
     }
 
+    if (mResultsFile != nullptr) {
+        std::ofstream outFile;
+        outFile.open(mResultsFile);
+        outFile.precision(10);
+
+        outFile << "{\n  \"metadata\": {\"commit\": ";
+        WriteJSONString(outFile, mCommit);
+        outFile << ", \"trials\": " << mNumTrials
+                << ", \"use_wire\": " << (UsesWire() ? "true" : "false")
+                << ", \"backend_validation\": "
+                << (IsBackendValidationEnabled() ? "true" : "false") << "},\n";
+
+        outFile << "  \"results\": [";
+        for (size_t i = 0; i < mResults.size(); ++i) {
+            const DawnPerfTestResult& result = mResults[i];
+            outFile << (i == 0 ? "\n" : ",\n") << "    {\"test_suite\": ";
+            WriteJSONString(outFile, result.testSuite);
+            outFile << ", \"story\": ";
+            WriteJSONString(outFile, result.story);
+            outFile << ", \"metric\": ";
+            WriteJSONString(outFile, result.metric);
+            outFile << ", \"value\": " << result.value << ", \"units\": ";
+            WriteJSONString(outFile, result.units);
+            outFile << ", \"trial\": " << result.trial << ", \"backend\": ";
+            WriteJSONString(outFile, result.backend);
+            outFile << ", \"adapter\": ";
+            WriteJSONString(outFile, result.adapterName);
+            outFile << ", \"enabled_toggles\": ";
+            WriteJSONStringArray(outFile, result.enabledToggles);
+            outFile << ", \"disabled_toggles\": ";
+            WriteJSONStringArray(outFile, result.disabledToggles);
+            outFile << "}";
+        }
+        outFile << "\n  ]\n}" << std::endl;
+        outFile.close();
+    }
+
     DawnTestEnvironment::TearDown();
 }
 
@@ -160,10 +276,22 @@ unsigned int DawnPerfTestEnvironment::OverrideStepsToRun() const {
     return mOverrideStepsToRun;
 }
 
+unsigned int DawnPerfTestEnvironment::GetNumTrials() const {
+    return mNumTrials;
+}
+
 const char* DawnPerfTestEnvironment::GetTraceFile() const {
     return mTraceFile;
 }
 
+const char* DawnPerfTestEnvironment::GetResultsFile() const {
+    return mResultsFile;
+}
+
+void DawnPerfTestEnvironment::AddResult(DawnPerfTestResult result) {
+    mResults.push_back(std::move(result));
+}
+
 DawnPerfTestPlatform* DawnPerfTestEnvironment::GetPlatform() const {
     return mPlatform.get();
 }
@@ -217,7 +345,7 @@ void DawnPerfTestBase::RunTest() {
     platform->EnableTraceEventRecording(true);
     {
         TRACE_EVENT0(platform, General, testName);
-        for (unsigned int trial = 0; trial < kNumTrials; ++trial) {
+        for (mTrial = 0; mTrial < gTestEnv->GetNumTrials(); ++mTrial) {
             TRACE_EVENT0(platform, General, "Trial");
             DoRunLoop(kMaximumRunTimeSeconds);
             OutputResults();
@@ -371,6 +499,7 @@ void DawnPerfTestBase::PrintResult(const std::string& trace,
                                    const std::string& units,
                                    bool important) const {
     PrintResultImpl(trace, std::to_string(value), units, important);
+    RecordResult(trace, value, units);
 }
 
 void DawnPerfTestBase::PrintResult(const std::string& trace,
@@ -378,6 +507,7 @@ void DawnPerfTestBase::PrintResult(const std::string& trace,
                                    const std::string& units,
                                    bool important) const {
     PrintResultImpl(trace, std::to_string(value), units, important);
+    RecordResult(trace, value, units);
 }
 
 void DawnPerfTestBase::PrintResultImpl(const std::string& trace,
@@ -397,3 +527,39 @@ void DawnPerfTestBase::PrintResultImpl(const std::string& trace,
     dawn::InfoLog() << (important ? "*" : "") << "RESULT " << metric << ": " << story << "= "
                     << value << " " << units;
 }
+
+void DawnPerfTestBase::RecordResult(const std::string& trace,
+                                    double value,
+                                    const std::string& units) const {
+    // The step counts printed during calibration aren't measurements.
+    if (gTestEnv->GetResultsFile() == nullptr || gTestEnv->IsCalibrating()) {
+        return;
+    }
+
+    const ::testing::TestInfo* const testInfo =
+        ::testing::UnitTest::GetInstance()->current_test_info();
+
+    DawnPerfTestResult result;
+    result.testSuite = testInfo->test_suite_name();
+    result.story = testInfo->name();
+    std::replace(result.story.begin(), result.story.end(), '/', '_');
+    result.metric = trace;
+    result.value = value;
+    result.units = units;
+    result.trial = mTrial;
+
+    std::ostringstream backend;
+    backend << DawnTestParam(mTest->mParam.backendType);
+    result.backend = backend.str();
+    if (mTest->mAdapterProperties.name != nullptr) {
+        result.adapterName = mTest->mAdapterProperties.name;
+    }
+    for (const char* toggle : mTest->mParam.forceEnabledWorkarounds) {
+        result.enabledToggles.push_back(toggle);
+    }
+    for (const char* toggle : mTest->mParam.forceDisabledWorkarounds) {
+        result.disabledToggles.push_back(toggle);
+    }
+
+    gTestEnv->AddResult(std::move(result));
+}
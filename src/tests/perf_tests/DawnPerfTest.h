@@ -25,6 +25,20 @@ class DawnPerfTestPlatform;
 
 void InitDawnPerfTestEnvironment(int argc, char** argv);
 
+// A single measurement of a perf test, with the configuration it was measured in.
+struct DawnPerfTestResult {
+    std::string testSuite;
+    std::string story;
+    std::string metric;
+    double value;
+    std::string units;
+    unsigned int trial;
+    std::string backend;
+    std::string adapterName;
+    std::vector<std::string> enabledToggles;
+    std::vector<std::string> disabledToggles;
+};
+
 class DawnPerfTestEnvironment : public DawnTestEnvironment {
   public:
     DawnPerfTestEnvironment(int argc, char** argv);
@@ -35,11 +49,16 @@ class DawnPerfTestEnvironment : public DawnTestEnvironment {
 
     bool IsCalibrating() const;
     unsigned int OverrideStepsToRun() const;
+    unsigned int GetNumTrials() const;
 
     // Returns the path to the trace file, or nullptr if traces should
     // not be written to a json file.
     const char* GetTraceFile() const;
 
+    // Returns the path to the results file, or nullptr if results should only be printed.
+    const char* GetResultsFile() const;
+    void AddResult(DawnPerfTestResult result);
+
     DawnPerfTestPlatform* GetPlatform() const;
 
   private:
@@ -49,15 +68,23 @@ class DawnPerfTestEnvironment : public DawnTestEnvironment {
     // If non-zero, overrides the number of steps.
     unsigned int mOverrideStepsToRun = 0;
 
+    // The number of times each test is measured after the warmup.
+    unsigned int mNumTrials = 3;
+
     const char* mTraceFile = nullptr;
 
+    // The results are gathered and written to the results file with the metadata when all the
+    // tests have run. The commit is only recorded in the metadata, it is given by the caller.
+    const char* mResultsFile = nullptr;
+    std::string mCommit;
+    std::vector<DawnPerfTestResult> mResults;
+
     std::unique_ptr<DawnPerfTestPlatform> mPlatform;
 };
 
 class DawnPerfTestBase {
     static constexpr double kCalibrationRunTimeSeconds = 1.0;
     static constexpr double kMaximumRunTimeSeconds = 10.0;
-    static constexpr unsigned int kNumTrials = 3;
 
   public:
     // Perf test results are reported as the amortized time of |mStepsToRun| * |mIterationsPerStep|.
@@ -95,6 +122,7 @@ class DawnPerfTestBase {
                          const std::string& value,
                          const std::string& units,
                          bool important) const;
+    void RecordResult(const std::string& trace, double value, const std::string& units) const;
 
     virtual void Step() = 0;
 
@@ -104,6 +132,7 @@ class DawnPerfTestBase {
     const unsigned int mMaxStepsInFlight;
     unsigned int mStepsToRun = 0;
     unsigned int mNumStepsPerformed = 0;
+    unsigned int mTrial = 0;
     double cpuTime;
     std::unique_ptr<utils::Timer> mTimer;
 };
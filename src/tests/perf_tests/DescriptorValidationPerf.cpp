@@ -0,0 +1,123 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/perf_tests/DawnPerfTest.h"
+
+#include "tests/ParamGenerator.h"
+
+namespace {
+
+    constexpr unsigned int kNumIterations = 10000;
+
+    enum class Descriptor {
+        Sampler,
+        TextureView,
+    };
+
+    struct DescriptorValidationParams : DawnTestParam {
+        DescriptorValidationParams(const DawnTestParam& param, Descriptor descriptor)
+            : DawnTestParam(param), descriptor(descriptor) {
+        }
+
+        Descriptor descriptor;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const DescriptorValidationParams& param) {
+        ostream << static_cast<const DawnTestParam&>(param);
+        switch (param.descriptor) {
+            case Descriptor::Sampler:
+                ostream << "_Sampler";
+                break;
+            case Descriptor::TextureView:
+                ostream << "_TextureView";
+                break;
+        }
+        return ostream;
+    }
+
+}  // namespace
+
+// Creates objects from the same descriptor over and over so that the cost of validating their
+// descriptors shows up. Comparing with the skip_validation variant gives the cost of validation.
+// Samplers are deduplicated by the device so creating one is mostly validation and a cache lookup.
+class DescriptorValidationPerf : public DawnPerfTestWithParams<DescriptorValidationParams> {
+  public:
+    DescriptorValidationPerf() : DawnPerfTestWithParams(kNumIterations, 1) {
+    }
+    ~DescriptorValidationPerf() override = default;
+
+    void TestSetUp() override;
+
+  private:
+    void Step() override;
+
+    wgpu::SamplerDescriptor mSamplerDescriptor;
+    wgpu::Sampler mSampler;
+
+    wgpu::Texture mTexture;
+    wgpu::TextureViewDescriptor mTextureViewDescriptor;
+};
+
+void DescriptorValidationPerf::TestSetUp() {
+    DawnPerfTestWithParams<DescriptorValidationParams>::TestSetUp();
+
+    mSamplerDescriptor.addressModeU = wgpu::AddressMode::Repeat;
+    mSamplerDescriptor.addressModeV = wgpu::AddressMode::MirrorRepeat;
+    mSamplerDescriptor.addressModeW = wgpu::AddressMode::ClampToEdge;
+    mSamplerDescriptor.magFilter = wgpu::FilterMode::Linear;
+    mSamplerDescriptor.minFilter = wgpu::FilterMode::Linear;
+    mSamplerDescriptor.mipmapFilter = wgpu::FilterMode::Nearest;
+    mSamplerDescriptor.lodMinClamp = 0.0f;
+    mSamplerDescriptor.lodMaxClamp = 1000.0f;
+    mSamplerDescriptor.compare = wgpu::CompareFunction::Never;
+
+    // Keep a reference to the sampler so that it stays in the device's cache.
+    mSampler = device.CreateSampler(&mSamplerDescriptor);
+
+    wgpu::TextureDescriptor textureDescriptor;
+    textureDescriptor.dimension = wgpu::TextureDimension::e2D;
+    textureDescriptor.size = {4, 4, 1};
+    textureDescriptor.format = wgpu::TextureFormat::RGBA8Unorm;
+    textureDescriptor.usage = wgpu::TextureUsage::Sampled;
+    mTexture = device.CreateTexture(&textureDescriptor);
+
+    mTextureViewDescriptor.format = wgpu::TextureFormat::RGBA8Unorm;
+    mTextureViewDescriptor.dimension = wgpu::TextureViewDimension::e2D;
+    mTextureViewDescriptor.aspect = wgpu::TextureAspect::All;
+}
+
+void DescriptorValidationPerf::Step() {
+    switch (GetParam().descriptor) {
+        case Descriptor::Sampler:
+            for (unsigned int i = 0; i < kNumIterations; ++i) {
+                device.CreateSampler(&mSamplerDescriptor);
+            }
+            break;
+
+        case Descriptor::TextureView:
+            for (unsigned int i = 0; i < kNumIterations; ++i) {
+                mTexture.CreateView(&mTextureViewDescriptor);
+            }
+            break;
+    }
+}
+
+TEST_P(DescriptorValidationPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_PERF_TEST_SUITE_P(DescriptorValidationPerf,
+                                   {D3D12Backend, MetalBackend, OpenGLBackend, VulkanBackend,
+                                    ForceToggles(VulkanBackend, {"skip_validation"})},
+                                   {Descriptor::Sampler, Descriptor::TextureView});
@@ -0,0 +1,81 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "common/Log.h"
+#include "common/SerialQueue.h"
+#include "utils/Timer.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+namespace {
+
+    // Each iteration enqueues the values for one serial and retires the ones of the serial that
+    // completed |kSerialsInFlight| serials ago, like the FencedDeleter does once per tick.
+    constexpr unsigned int kNumIterations = 100000;
+    constexpr Serial kSerialsInFlight = 3;
+
+}  // namespace
+
+// Microbenchmark of the enqueue / iterate / clear pattern that the backends use to release
+// objects once the GPU is done with them. The queue doesn't use a device so this is a plain test
+// parameterized by the number of values per serial instead of a DawnPerfTest that would run once
+// per backend.
+class SerialQueuePerf : public ::testing::TestWithParam<uint32_t> {};
+
+TEST_P(SerialQueuePerf, Run) {
+    const uint32_t valuesPerSerial = GetParam();
+
+    SerialQueue<uint64_t> queue;
+    Serial serial = 0;
+    uint64_t sum = 0;
+
+    std::unique_ptr<utils::Timer> timer(utils::CreateTimer());
+    timer->Start();
+    for (unsigned int i = 0; i < kNumIterations; ++i) {
+        serial++;
+        for (uint32_t j = 0; j < valuesPerSerial; ++j) {
+            queue.Enqueue(j, serial);
+        }
+
+        if (serial > kSerialsInFlight) {
+            Serial completedSerial = serial - kSerialsInFlight;
+            for (uint64_t value : queue.IterateUpTo(completedSerial)) {
+                sum += value;
+            }
+            queue.ClearUpTo(completedSerial);
+        }
+    }
+    timer->Stop();
+
+    // Every serial but the last ones in flight retired the values 0 .. valuesPerSerial - 1.
+    uint64_t valuesSum = uint64_t(valuesPerSerial) * (valuesPerSerial - 1) / 2;
+    ASSERT_EQ(sum, (kNumIterations - kSerialsInFlight) * valuesSum);
+
+    // The results are printed in the same format as the DawnPerfTest results.
+    const ::testing::TestInfo* const testInfo =
+        ::testing::UnitTest::GetInstance()->current_test_info();
+    std::string story = testInfo->name();
+    std::replace(story.begin(), story.end(), '/', '_');
+    dawn::InfoLog() << "*RESULT " << testInfo->test_suite_name() << ".wall_time: " << story
+                    << "= " << timer->GetElapsedTime() * 1e9 / kNumIterations << " ns";
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         SerialQueuePerf,
+                         ::testing::Values(1u, 16u, 256u),
+                         ::testing::PrintToStringParamName());
@@ -0,0 +1,176 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/perf_tests/DawnPerfTest.h"
+
+#include "tests/ParamGenerator.h"
+#include "utils/WGPUHelpers.h"
+
+namespace {
+
+    constexpr unsigned int kNumIterations = 50;
+
+    // The shader uses this value as a constant, it is replaced in the SPIR-V so that each module
+    // has different code and isn't found in the device's cache of shader modules.
+    constexpr uint32_t kSeedPlaceholder = 0x12345678;
+
+    // Unoptimized SPIR-V from glslang has many loads and stores of function variables, calls of
+    // small functions, and branches on constants that the optimizer removes.
+    constexpr char kComputeShader[] = R"(
+        #version 450
+        layout(local_size_x = 64) in;
+        layout(std430, set = 0, binding = 0) buffer Data {
+            uint values[];
+        } data;
+
+        const uint kSeed = 0x12345678u;
+        const bool kUseHash = true;
+
+        uint Hash(uint x) {
+            x ^= x >> 16;
+            x *= 0x7feb352du;
+            x ^= x >> 15;
+            x *= 0x846ca68bu;
+            x ^= x >> 16;
+            return x;
+        }
+
+        uint Mix(uint a, uint b) {
+            uint result = a;
+            for (uint i = 0; i < 4; ++i) {
+                if (kUseHash) {
+                    result = Hash(result + b * i);
+                } else {
+                    result = result + b;
+                }
+            }
+            return result;
+        }
+
+        void main() {
+            uint index = gl_GlobalInvocationID.x;
+            uint value = data.values[index];
+            value = Mix(value, kSeed);
+            value = Mix(value, index);
+            data.values[index] = value;
+        })";
+
+    enum class ShaderCode {
+        // Each module has code that was never seen by the device.
+        Unique,
+        // The same codes are used in each step, so the results of the optimizer are cached. The
+        // modules are released each iteration so they still miss the cache of shader modules.
+        Repeated,
+    };
+
+    struct ShaderModuleOptimizationParams : DawnTestParam {
+        ShaderModuleOptimizationParams(const DawnTestParam& param, ShaderCode code)
+            : DawnTestParam(param), code(code) {
+        }
+
+        ShaderCode code;
+    };
+
+    std::ostream& operator<<(std::ostream& ostream, const ShaderModuleOptimizationParams& param) {
+        ostream << static_cast<const DawnTestParam&>(param);
+        switch (param.code) {
+            case ShaderCode::Unique:
+                ostream << "_Unique";
+                break;
+            case ShaderCode::Repeated:
+                ostream << "_Repeated";
+                break;
+        }
+        return ostream;
+    }
+
+}  // namespace
+
+// Measures the latency from creating a shader module to having a compute pipeline using it.
+// Comparing with the optimize_shader_modules variant gives the cost of running the optimizer
+// against what it saves in translation and driver compilation.
+class ShaderModuleOptimizationPerf
+    : public DawnPerfTestWithParams<ShaderModuleOptimizationParams> {
+  public:
+    ShaderModuleOptimizationPerf() : DawnPerfTestWithParams(kNumIterations, 1) {
+    }
+    ~ShaderModuleOptimizationPerf() override = default;
+
+    void TestSetUp() override;
+
+  private:
+    void Step() override;
+
+    std::vector<uint32_t> mCode;
+    size_t mSeedOffset = 0;
+    uint32_t mNextSeed = 0;
+
+    wgpu::PipelineLayout mPipelineLayout;
+};
+
+void ShaderModuleOptimizationPerf::TestSetUp() {
+    DawnPerfTestWithParams<ShaderModuleOptimizationParams>::TestSetUp();
+
+    mCode = utils::CompileGLSLToSpirv(utils::SingleShaderStage::Compute, kComputeShader);
+    ASSERT_FALSE(mCode.empty());
+
+    // Find the OpConstant defining kSeed: its first word is the word count and opcode, then come
+    // the result type, the result id and the value.
+    constexpr uint32_t kOpConstantFirstWord = (4 << 16) | 43;
+    constexpr size_t kSpirvHeaderSize = 5;
+    for (size_t i = kSpirvHeaderSize; i + 3 < mCode.size(); ++i) {
+        if (mCode[i] == kOpConstantFirstWord && mCode[i + 3] == kSeedPlaceholder) {
+            mSeedOffset = i + 3;
+            break;
+        }
+    }
+    ASSERT_NE(mSeedOffset, 0u);
+
+    wgpu::BindGroupLayout bindGroupLayout = utils::MakeBindGroupLayout(
+        device, {{0, wgpu::ShaderStage::Compute, wgpu::BindingType::StorageBuffer}});
+    mPipelineLayout = utils::MakeBasicPipelineLayout(device, &bindGroupLayout);
+}
+
+void ShaderModuleOptimizationPerf::Step() {
+    if (GetParam().code == ShaderCode::Repeated) {
+        mNextSeed = 0;
+    }
+
+    for (unsigned int i = 0; i < kNumIterations; ++i) {
+        mCode[mSeedOffset] = mNextSeed++;
+
+        wgpu::ShaderModuleDescriptor moduleDescriptor;
+        moduleDescriptor.codeSize = static_cast<uint32_t>(mCode.size());
+        moduleDescriptor.code = mCode.data();
+        wgpu::ShaderModule module = device.CreateShaderModule(&moduleDescriptor);
+
+        wgpu::ComputePipelineDescriptor pipelineDescriptor;
+        pipelineDescriptor.layout = mPipelineLayout;
+        pipelineDescriptor.computeStage.module = module;
+        pipelineDescriptor.computeStage.entryPoint = "main";
+        device.CreateComputePipeline(&pipelineDescriptor);
+    }
+}
+
+TEST_P(ShaderModuleOptimizationPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_PERF_TEST_SUITE_P(ShaderModuleOptimizationPerf,
+                                   {D3D12Backend, MetalBackend, OpenGLBackend, VulkanBackend,
+                                    ForceToggles(D3D12Backend, {"optimize_shader_modules"}),
+                                    ForceToggles(MetalBackend, {"optimize_shader_modules"}),
+                                    ForceToggles(OpenGLBackend, {"optimize_shader_modules"}),
+                                    ForceToggles(VulkanBackend, {"optimize_shader_modules"})},
+                                   {ShaderCode::Unique, ShaderCode::Repeated});
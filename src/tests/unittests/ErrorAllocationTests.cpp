@@ -0,0 +1,138 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "dawn_native/Error.h"
+#include "dawn_native/ErrorData.h"
+
+#include <cstdlib>
+#include <new>
+
+// This file is built in its own test binary because it replaces the global allocation functions
+// to count the allocations done while a test enables it. Only the allocations of the thread that
+// enabled counting are counted so that other threads can't make the tests flaky.
+namespace {
+    thread_local bool tCountAllocations = false;
+    thread_local size_t tAllocationCount = 0;
+}  // anonymous namespace
+
+void* operator new(size_t size) {
+    if (tCountAllocations) {
+        tAllocationCount++;
+    }
+    void* pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+using namespace dawn_native;
+
+namespace {
+
+    int dummySuccess = 0xbeef;
+
+    // Counts the allocations of the current thread while it is alive.
+    class ScopedAllocationCounter {
+      public:
+        ScopedAllocationCounter() {
+            ASSERT(!tCountAllocations);
+            tAllocationCount = 0;
+            tCountAllocations = true;
+        }
+        ~ScopedAllocationCounter() {
+            tCountAllocations = false;
+        }
+
+        size_t GetCount() const {
+            return tAllocationCount;
+        }
+    };
+
+    // Returns the number of allocations done while running f.
+    template <typename F>
+    size_t CountAllocations(F f) {
+        ScopedAllocationCounter counter;
+        f();
+        return counter.GetCount();
+    }
+
+    // Check that successes never allocate, even when propagated through DAWN_TRY.
+    TEST(ErrorAllocationTests, SuccessDoesNotAllocate) {
+        auto ReturnSuccess = []() -> MaybeError {
+            return {};
+        };
+        auto ReturnPointer = []() -> ResultOrError<int*> {
+            return &dummySuccess;
+        };
+        auto ReturnValue = []() -> ResultOrError<int> {
+            return 42;
+        };
+        auto Try = [&]() -> ResultOrError<int> {
+            DAWN_TRY(ReturnSuccess());
+            int* pointer = nullptr;
+            DAWN_TRY_ASSIGN(pointer, ReturnPointer());
+            int value = 0;
+            DAWN_TRY_ASSIGN(value, ReturnValue());
+            return *pointer + value;
+        };
+
+        int result = 0;
+        size_t allocationCount = CountAllocations([&]() { result = Try().AcquireSuccess(); });
+        EXPECT_EQ(0u, allocationCount);
+        EXPECT_EQ(dummySuccess + 42, result);
+    }
+
+    // Check that errors created from a literal don't copy the message, and that propagating them
+    // through a few DAWN_TRY doesn't reallocate their backtrace.
+    TEST(ErrorAllocationTests, ErrorAllocationsAreBounded) {
+        auto ReturnError = []() -> MaybeError {
+            return DAWN_VALIDATION_ERROR("A long error message that doesn't fit in small strings");
+        };
+        auto SingleTry = [ReturnError]() -> MaybeError {
+            DAWN_TRY(ReturnError());
+            return {};
+        };
+        auto DoubleTry = [SingleTry]() -> ResultOrError<int*> {
+            DAWN_TRY(SingleTry());
+            return &dummySuccess;
+        };
+
+        // At most the ErrorData and its backtrace storage. The standard library may allocate
+        // differently so only the bound is checked.
+        size_t allocationCount = CountAllocations([&]() { ReturnError().AcquireError(); });
+        EXPECT_LE(allocationCount, 2u);
+
+        std::unique_ptr<ErrorData> errorData;
+        size_t propagatedAllocationCount =
+            CountAllocations([&]() { errorData = DoubleTry().AcquireError(); });
+        EXPECT_LE(propagatedAllocationCount, allocationCount);
+
+        // The message is only copied when it is queried.
+        EXPECT_EQ("A long error message that doesn't fit in small strings",
+                  errorData->GetMessage());
+        EXPECT_EQ(3u, errorData->GetBacktrace().size());
+    }
+
+}  // anonymous namespace
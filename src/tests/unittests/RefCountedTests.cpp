@@ -64,6 +64,8 @@ TEST(RefCounted, AddingRefKeepsAlive) {
     ASSERT_TRUE(deleted);
 }
 
+// The non-atomic policy makes this test a data race, it is only valid with atomic refcounts.
+#if !defined(DAWN_NON_ATOMIC_REFCOUNT)
 // Test that Reference and Release atomically change the refcount.
 TEST(RefCounted, RaceOnReferenceRelease) {
     bool deleted = false;
@@ -93,6 +95,23 @@ TEST(RefCounted, RaceOnReferenceRelease) {
     t4.join();
     ASSERT_EQ(test->GetRefCountForTesting(), 1u);
 }
+#endif  // !defined(DAWN_NON_ATOMIC_REFCOUNT)
+
+// Test that the non-atomic policy increments and decrements the count, and returns the value of
+// the count before each decrement.
+TEST(RefCounted, NonAtomicRefCountPolicy) {
+    NonAtomicRefCountPolicy::Storage count = 4;
+    ASSERT_EQ(NonAtomicRefCountPolicy::Load(count), 4u);
+
+    NonAtomicRefCountPolicy::Increment(&count, 4);
+    ASSERT_EQ(NonAtomicRefCountPolicy::Load(count), 8u);
+
+    ASSERT_EQ(NonAtomicRefCountPolicy::Decrement(&count, 4), 8u);
+    ASSERT_EQ(NonAtomicRefCountPolicy::Decrement(&count, 4), 4u);
+    ASSERT_EQ(NonAtomicRefCountPolicy::Load(count), 0u);
+
+    NonAtomicRefCountPolicy::SynchronizeBeforeDelete();
+}
 
 // Test Ref remove reference when going out of scope
 TEST(Ref, EndOfScopeRemovesRef) {
@@ -16,6 +16,8 @@
 
 #include "common/SerialQueue.h"
 
+#include <memory>
+
 using TestSerialQueue = SerialQueue<int>;
 
 // A number of basic tests for SerialQueue that are difficult to split from one another
@@ -153,4 +155,51 @@ TEST(SerialQueue, LastSerial) {
 
     queue.Enqueue({2}, 1);
     EXPECT_EQ(queue.LastSerial(), 1u);
-}
\ No newline at end of file
+}
+
+// Test that interleaving enqueues and clears, which makes the storage wrap around and grow, keeps
+// the values in order.
+TEST(SerialQueue, WrapAroundAndGrow) {
+    TestSerialQueue queue;
+
+    int nextValue = 0;
+    int nextExpectedValue = 0;
+    for (Serial serial = 0; serial < 100; ++serial) {
+        // Enqueue a varying number of values for each serial so that the number of values in
+        // flight grows over time.
+        for (Serial i = 0; i < serial % 7 + 1; ++i) {
+            queue.Enqueue(nextValue++, serial);
+        }
+
+        if (serial >= 3) {
+            for (int value : queue.IterateUpTo(serial - 3)) {
+                EXPECT_EQ(nextExpectedValue++, value);
+            }
+            queue.ClearUpTo(serial - 3);
+            EXPECT_EQ(queue.FirstSerial(), serial - 2);
+        }
+    }
+
+    for (int value : queue.IterateAll()) {
+        EXPECT_EQ(nextExpectedValue++, value);
+    }
+    EXPECT_EQ(nextValue, nextExpectedValue);
+}
+
+// Test that values that can only be moved are supported and destroyed when cleared.
+TEST(SerialQueue, MoveOnlyValues) {
+    SerialQueue<std::unique_ptr<int>> queue;
+
+    for (int i = 0; i < 20; ++i) {
+        queue.Enqueue(std::make_unique<int>(i), i / 4);
+    }
+
+    queue.ClearUpTo(2);
+    EXPECT_EQ(queue.FirstSerial(), 3u);
+
+    int expectedValue = 12;
+    for (const std::unique_ptr<int>& value : queue.IterateAll()) {
+        EXPECT_EQ(expectedValue++, *value);
+    }
+    EXPECT_EQ(expectedValue, 20);
+}
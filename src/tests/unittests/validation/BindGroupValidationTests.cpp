@@ -463,6 +463,51 @@ TEST_F(BindGroupValidationTest, ErrorLayout) {
     ASSERT_DEVICE_ERROR(utils::MakeBindGroup(device, errorLayout, {{0, mUBO, 0, 256}}));
 }
 
+// Test the validation of the bindings replaced when deriving a bind group.
+TEST_F(BindGroupValidationTest, DerivedBindGroup) {
+    wgpu::BindGroupLayout layout = utils::MakeBindGroupLayout(
+        device, {
+                    {0, wgpu::ShaderStage::Fragment, wgpu::BindingType::UniformBuffer},
+                    {1, wgpu::ShaderStage::Fragment, wgpu::BindingType::Sampler},
+                });
+    wgpu::BindGroup parent =
+        utils::MakeBindGroup(device, layout, {{0, mUBO, 0, 256}, {1, mSampler}});
+
+    // Control case, replacing a subset of the bindings works, and so does deriving again.
+    wgpu::BindGroupBinding binding = utils::BindingInitializationHelper(0, mUBO, 256, 256)
+                                         .GetAsBinding();
+    wgpu::BindGroup derived = parent.CreateDerived(1, &binding);
+    derived.CreateDerived(1, &binding);
+
+    // Replacing no binding is valid.
+    parent.CreateDerived(0, nullptr);
+
+    // Error case, the binding doesn't exist in the layout.
+    binding = utils::BindingInitializationHelper(2, mUBO, 0, 256).GetAsBinding();
+    ASSERT_DEVICE_ERROR(parent.CreateDerived(1, &binding));
+
+    // Error case, the replaced binding has the wrong type.
+    binding = utils::BindingInitializationHelper(1, mUBO, 0, 256).GetAsBinding();
+    ASSERT_DEVICE_ERROR(parent.CreateDerived(1, &binding));
+
+    // Error case, the replaced binding is validated like in CreateBindGroup.
+    binding = utils::BindingInitializationHelper(0, mSSBO, 0, 256).GetAsBinding();
+    ASSERT_DEVICE_ERROR(parent.CreateDerived(1, &binding));
+
+    // Error case, the same binding is replaced twice.
+    std::array<wgpu::BindGroupBinding, 2> bindings = {
+        utils::BindingInitializationHelper(0, mUBO, 0, 256).GetAsBinding(),
+        utils::BindingInitializationHelper(0, mUBO, 256, 256).GetAsBinding(),
+    };
+    ASSERT_DEVICE_ERROR(parent.CreateDerived(2, bindings.data()));
+
+    // Error case, deriving from an error bind group.
+    wgpu::BindGroup errorGroup;
+    ASSERT_DEVICE_ERROR(errorGroup = utils::MakeBindGroup(device, layout, {{0, mUBO, 0, 256}}));
+    binding = utils::BindingInitializationHelper(0, mUBO, 0, 256).GetAsBinding();
+    ASSERT_DEVICE_ERROR(errorGroup.CreateDerived(1, &binding));
+}
+
 class BindGroupLayoutValidationTest : public ValidationTest {
   public:
     void TestCreateBindGroupLayout(wgpu::BindGroupLayoutBinding* binding,
@@ -1257,3 +1302,195 @@ TEST_F(BindGroupLayoutCompatibilityTest, ROStorageInBGLWithRWStorageInShader) {
 
     ASSERT_DEVICE_ERROR(CreateComputePipeline(&bindGroupLayout));
 }
+
+class BindingArrayValidationTest : public ValidationTest {
+  public:
+    BindingArrayValidationTest() : ValidationTest() {
+        device = CreateDeviceFromAdapter(adapter, {"descriptor_indexing"});
+    }
+
+    void SetUp() override {
+        wgpu::TextureDescriptor descriptor;
+        descriptor.dimension = wgpu::TextureDimension::e2D;
+        descriptor.size = {16, 16, 1};
+        descriptor.arrayLayerCount = 1;
+        descriptor.sampleCount = 1;
+        descriptor.format = wgpu::TextureFormat::RGBA8Unorm;
+        descriptor.mipLevelCount = 1;
+        descriptor.usage = wgpu::TextureUsage::Sampled;
+        mSampledTextureView = device.CreateTexture(&descriptor).CreateView();
+    }
+
+  protected:
+    wgpu::BindGroupLayoutBinding MakeArrayBinding(uint32_t binding,
+                                                  wgpu::BindingType type,
+                                                  uint32_t arrayLength) {
+        wgpu::BindGroupLayoutBinding layoutBinding = {binding, wgpu::ShaderStage::Fragment, type};
+        layoutBinding.arrayLength = arrayLength;
+        return layoutBinding;
+    }
+
+    wgpu::BindGroupLayout MakeLayout(std::vector<wgpu::BindGroupLayoutBinding> bindings) {
+        wgpu::BindGroupLayoutDescriptor descriptor;
+        descriptor.bindingCount = static_cast<uint32_t>(bindings.size());
+        descriptor.bindings = bindings.data();
+        return device.CreateBindGroupLayout(&descriptor);
+    }
+
+    wgpu::BindGroupBinding MakeTextureElement(uint32_t binding, uint32_t arrayElement) {
+        wgpu::BindGroupBinding groupBinding;
+        groupBinding.binding = binding;
+        groupBinding.textureView = mSampledTextureView;
+        groupBinding.arrayElement = arrayElement;
+        return groupBinding;
+    }
+
+    wgpu::BindGroup MakeBindGroup(const wgpu::BindGroupLayout& layout,
+                                  std::vector<wgpu::BindGroupBinding> bindings) {
+        wgpu::BindGroupDescriptor descriptor;
+        descriptor.layout = layout;
+        descriptor.bindingCount = static_cast<uint32_t>(bindings.size());
+        descriptor.bindings = bindings.data();
+        return device.CreateBindGroup(&descriptor);
+    }
+
+    wgpu::TextureView mSampledTextureView;
+};
+
+// Test that binding arrays can only be used when the descriptor_indexing extension is enabled.
+TEST_F(BindingArrayValidationTest, RequiresExtension) {
+    wgpu::BindGroupLayoutBinding binding =
+        MakeArrayBinding(0, wgpu::BindingType::SampledTexture, 4);
+    wgpu::BindGroupLayoutDescriptor descriptor;
+    descriptor.bindingCount = 1;
+    descriptor.bindings = &binding;
+
+    const std::vector<const char*> kEmptyVector;
+    wgpu::Device deviceWithoutExtension = CreateDeviceFromAdapter(adapter, kEmptyVector);
+    ASSERT_DEVICE_ERROR(deviceWithoutExtension.CreateBindGroupLayout(&descriptor));
+
+    device.CreateBindGroupLayout(&descriptor);
+}
+
+// Test the validation of the binding array length and type in bind group layouts.
+TEST_F(BindingArrayValidationTest, LayoutArrayLength) {
+    MakeLayout({MakeArrayBinding(0, wgpu::BindingType::SampledTexture, kMaxBindingArrayLength)});
+    MakeLayout({MakeArrayBinding(0, wgpu::BindingType::StorageBuffer, 8)});
+    MakeLayout({MakeArrayBinding(0, wgpu::BindingType::ReadonlyStorageBuffer, 8)});
+
+    // Array length is limited.
+    ASSERT_DEVICE_ERROR(MakeLayout(
+        {MakeArrayBinding(0, wgpu::BindingType::SampledTexture, kMaxBindingArrayLength + 1)}));
+
+    // Only sampled textures and storage buffers can be arrays.
+    ASSERT_DEVICE_ERROR(MakeLayout({MakeArrayBinding(0, wgpu::BindingType::Sampler, 8)}));
+    ASSERT_DEVICE_ERROR(MakeLayout({MakeArrayBinding(0, wgpu::BindingType::UniformBuffer, 8)}));
+
+    // Binding arrays can't be dynamic, and can't be mixed with dynamic bindings.
+    {
+        wgpu::BindGroupLayoutBinding binding =
+            MakeArrayBinding(0, wgpu::BindingType::StorageBuffer, 8);
+        binding.hasDynamicOffset = true;
+        ASSERT_DEVICE_ERROR(MakeLayout({binding}));
+    }
+    {
+        wgpu::BindGroupLayoutBinding dynamicBinding = {1, wgpu::ShaderStage::Fragment,
+                                                       wgpu::BindingType::UniformBuffer, true};
+        ASSERT_DEVICE_ERROR(MakeLayout(
+            {MakeArrayBinding(0, wgpu::BindingType::SampledTexture, 8), dynamicBinding}));
+    }
+}
+
+// Test that binding arrays can be partially bound, but each element is set at most once and is in
+// bounds.
+TEST_F(BindingArrayValidationTest, PartiallyBoundBindGroup) {
+    wgpu::BindGroupLayout layout =
+        MakeLayout({MakeArrayBinding(0, wgpu::BindingType::SampledTexture, 4),
+                    {1, wgpu::ShaderStage::Fragment, wgpu::BindingType::SampledTexture}});
+
+    // Success cases: any subset of the array elements can be set.
+    MakeBindGroup(layout, {MakeTextureElement(1, 0)});
+    MakeBindGroup(layout, {MakeTextureElement(0, 3), MakeTextureElement(0, 0),
+                           MakeTextureElement(1, 0)});
+    MakeBindGroup(layout, {MakeTextureElement(0, 0), MakeTextureElement(0, 1),
+                           MakeTextureElement(0, 2), MakeTextureElement(0, 3),
+                           MakeTextureElement(1, 0)});
+
+    // Array element out of bounds.
+    ASSERT_DEVICE_ERROR(
+        MakeBindGroup(layout, {MakeTextureElement(0, 4), MakeTextureElement(1, 0)}));
+
+    // Array element set twice.
+    ASSERT_DEVICE_ERROR(MakeBindGroup(
+        layout, {MakeTextureElement(0, 1), MakeTextureElement(0, 1), MakeTextureElement(1, 0)}));
+
+    // Bindings that aren't arrays must still be set exactly once, at element 0.
+    ASSERT_DEVICE_ERROR(MakeBindGroup(layout, {MakeTextureElement(0, 0)}));
+    ASSERT_DEVICE_ERROR(MakeBindGroup(layout, {MakeTextureElement(1, 1)}));
+    ASSERT_DEVICE_ERROR(
+        MakeBindGroup(layout, {MakeTextureElement(1, 0), MakeTextureElement(1, 0)}));
+}
+
+// Test that binding arrays in shaders must match binding arrays in the layout that are at least
+// as large.
+TEST_F(BindingArrayValidationTest, ShaderCompatibility) {
+    wgpu::ShaderModule vsModule =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Vertex, R"(
+            #version 450
+            void main() {
+            })");
+
+    auto CreatePipeline = [&](const char* fragmentShader, wgpu::BindGroupLayout layout) {
+        utils::ComboRenderPipelineDescriptor descriptor(device);
+        descriptor.vertexStage.module = vsModule;
+        descriptor.cFragmentStage.module =
+            utils::CreateShaderModule(device, utils::SingleShaderStage::Fragment, fragmentShader);
+        if (layout) {
+            descriptor.layout = utils::MakeBasicPipelineLayout(device, &layout);
+        }
+        device.CreateRenderPipeline(&descriptor);
+    };
+
+    const char* kRuntimeSizedShader = R"(
+        #version 450
+        #extension GL_EXT_nonuniform_qualifier : require
+        layout(set = 0, binding = 0) uniform texture2D textures[];
+        layout(location = 0) out vec4 fragColor;
+        void main() {
+        })";
+    const char* kFixedSizeShader = R"(
+        #version 450
+        layout(set = 0, binding = 0) uniform texture2D textures[8];
+        layout(location = 0) out vec4 fragColor;
+        void main() {
+        })";
+    const char* kSingleTextureShader = R"(
+        #version 450
+        layout(set = 0, binding = 0) uniform texture2D tex;
+        layout(location = 0) out vec4 fragColor;
+        void main() {
+        })";
+
+    wgpu::BindGroupLayout smallArrayLayout =
+        MakeLayout({MakeArrayBinding(0, wgpu::BindingType::SampledTexture, 4)});
+    wgpu::BindGroupLayout largeArrayLayout =
+        MakeLayout({MakeArrayBinding(0, wgpu::BindingType::SampledTexture, 16)});
+    wgpu::BindGroupLayout singleLayout = MakeLayout(
+        {{0, wgpu::ShaderStage::Fragment, wgpu::BindingType::SampledTexture}});
+
+    // Runtime-sized arrays match binding arrays of any length.
+    CreatePipeline(kRuntimeSizedShader, smallArrayLayout);
+    CreatePipeline(kRuntimeSizedShader, largeArrayLayout);
+    ASSERT_DEVICE_ERROR(CreatePipeline(kRuntimeSizedShader, singleLayout));
+
+    // Fixed-size arrays need a binding array that is at least as large.
+    CreatePipeline(kFixedSizeShader, largeArrayLayout);
+    ASSERT_DEVICE_ERROR(CreatePipeline(kFixedSizeShader, smallArrayLayout));
+    ASSERT_DEVICE_ERROR(CreatePipeline(kFixedSizeShader, singleLayout));
+
+    // Binding arrays don't match single bindings in the shader.
+    ASSERT_DEVICE_ERROR(CreatePipeline(kSingleTextureShader, largeArrayLayout));
+
+    // Default pipeline layouts can't be created for shaders using binding arrays.
+    ASSERT_DEVICE_ERROR(CreatePipeline(kRuntimeSizedShader, nullptr));
+}
@@ -14,6 +14,9 @@
 
 #include "tests/unittests/validation/ValidationTest.h"
 
+#include "dawn_native/BindGroup.h"
+#include "dawn_native/Buffer.h"
+
 #include "utils/WGPUHelpers.h"
 
 class CommandBufferValidationTest : public ValidationTest {
@@ -247,6 +250,55 @@ TEST_F(CommandBufferValidationTest, BufferWithMultipleReadAndReadOnlyStorageUsag
     encoder.Finish();
 }
 
+// Test that the objects used by commands are kept alive by the command buffer even when the
+// application releases them before finishing and submitting it.
+TEST_F(CommandBufferValidationTest, CommandsKeepObjectsAlive) {
+    wgpu::BufferDescriptor bufferDescriptor;
+    bufferDescriptor.usage = wgpu::BufferUsage::Storage | wgpu::BufferUsage::Index;
+    bufferDescriptor.size = 4;
+    wgpu::Buffer buffer = device.CreateBuffer(&bufferDescriptor);
+
+    wgpu::BindGroupLayout bgl = utils::MakeBindGroupLayout(
+        device, {{0, wgpu::ShaderStage::Vertex, wgpu::BindingType::ReadonlyStorageBuffer}});
+    wgpu::BindGroup bg = utils::MakeBindGroup(device, bgl, {{0, buffer, 0, 4}});
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    DummyRenderPass dummyRenderPass(device);
+    wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&dummyRenderPass);
+    pass.SetIndexBuffer(buffer);
+    for (uint32_t i = 0; i < 4; ++i) {
+        pass.SetBindGroup(0, bg);
+    }
+    pass.EndPass();
+
+    // The native objects stay valid to look at their reference counts as long as the commands
+    // keep them alive.
+    dawn_native::RefCounted* nativeBuffer =
+        reinterpret_cast<dawn_native::BufferBase*>(buffer.Get());
+    dawn_native::RefCounted* nativeBindGroup =
+        reinterpret_cast<dawn_native::BindGroupBase*>(bg.Get());
+    uint64_t bufferRefCount = nativeBuffer->GetRefCountForTesting();
+
+    bg = nullptr;
+    bgl = nullptr;
+    buffer = nullptr;
+
+    // Setting the same bind group repeatedly only keeps one reference to it in the commands.
+    EXPECT_EQ(nativeBindGroup->GetRefCountForTesting(), 1u);
+    EXPECT_EQ(nativeBuffer->GetRefCountForTesting(), bufferRefCount - 1);
+    EXPECT_GE(nativeBuffer->GetRefCountForTesting(), 1u);
+
+    wgpu::CommandBuffer commands = encoder.Finish();
+    encoder = nullptr;
+    pass = nullptr;
+
+    // The references are moved from the encoder to the command buffer.
+    EXPECT_EQ(nativeBindGroup->GetRefCountForTesting(), 1u);
+    EXPECT_EQ(nativeBuffer->GetRefCountForTesting(), bufferRefCount - 1);
+
+    device.CreateQueue().Submit(1, &commands);
+}
+
 // Test that using the same storage buffer as both readable and writable in the same pass is
 // disallowed
 TEST_F(CommandBufferValidationTest, BufferWithReadAndWriteStorageBufferUsage) {
@@ -0,0 +1,113 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/unittests/validation/ValidationTest.h"
+
+namespace {
+
+    constexpr wgpu::TextureUsage kMipmapUsage =
+        wgpu::TextureUsage::CopySrc | wgpu::TextureUsage::CopyDst;
+
+    class GenerateMipmapsValidationTest : public ValidationTest {
+      protected:
+        wgpu::Texture CreateTexture(uint32_t mipLevelCount,
+                                    wgpu::TextureFormat format = wgpu::TextureFormat::RGBA8Unorm,
+                                    wgpu::TextureUsage usage = kMipmapUsage,
+                                    uint32_t sampleCount = 1) {
+            wgpu::TextureDescriptor descriptor;
+            descriptor.size = {16, 16, 1};
+            descriptor.mipLevelCount = mipLevelCount;
+            descriptor.sampleCount = sampleCount;
+            descriptor.format = format;
+            descriptor.usage = usage;
+            return device.CreateTexture(&descriptor);
+        }
+
+        void TestGenerateMipmaps(bool success,
+                                 const wgpu::Texture& texture,
+                                 uint32_t baseLevel,
+                                 uint32_t levelCount) {
+            wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+            encoder.GenerateMipmaps(texture, baseLevel, levelCount);
+            if (success) {
+                encoder.Finish();
+            } else {
+                ASSERT_DEVICE_ERROR(encoder.Finish());
+            }
+        }
+    };
+
+    // Test generating all or part of the mip chain.
+    TEST_F(GenerateMipmapsValidationTest, Success) {
+        wgpu::Texture texture = CreateTexture(5);
+        TestGenerateMipmaps(true, texture, 0, 5);
+        TestGenerateMipmaps(true, texture, 1, 3);
+        TestGenerateMipmaps(true, texture, 4, 1);
+    }
+
+    // Test that the levels must be inside the texture and that there is at least one.
+    TEST_F(GenerateMipmapsValidationTest, LevelRange) {
+        wgpu::Texture texture = CreateTexture(5);
+        TestGenerateMipmaps(false, texture, 0, 0);
+        TestGenerateMipmaps(false, texture, 0, 6);
+        TestGenerateMipmaps(false, texture, 5, 1);
+        TestGenerateMipmaps(false, texture, 1, 0xFFFFFFFF);
+    }
+
+    // Test that the texture must have both the CopySrc and CopyDst usages.
+    TEST_F(GenerateMipmapsValidationTest, Usage) {
+        TestGenerateMipmaps(false, CreateTexture(5, wgpu::TextureFormat::RGBA8Unorm,
+                                                 wgpu::TextureUsage::CopySrc),
+                            0, 5);
+        TestGenerateMipmaps(false, CreateTexture(5, wgpu::TextureFormat::RGBA8Unorm,
+                                                 wgpu::TextureUsage::CopyDst),
+                            0, 5);
+    }
+
+    // Test that only renderable float color formats are supported.
+    TEST_F(GenerateMipmapsValidationTest, Format) {
+        TestGenerateMipmaps(true, CreateTexture(5, wgpu::TextureFormat::RGBA16Float), 0, 5);
+        TestGenerateMipmaps(false, CreateTexture(5, wgpu::TextureFormat::RGBA8Uint), 0, 5);
+        TestGenerateMipmaps(false, CreateTexture(5, wgpu::TextureFormat::RGBA8Snorm), 0, 5);
+        TestGenerateMipmaps(false, CreateTexture(5, wgpu::TextureFormat::Depth32Float), 0, 5);
+    }
+
+    // Test that multisampled textures can't have mipmaps generated.
+    TEST_F(GenerateMipmapsValidationTest, Multisampled) {
+        wgpu::Texture texture =
+            CreateTexture(1, wgpu::TextureFormat::RGBA8Unorm,
+                          kMipmapUsage | wgpu::TextureUsage::OutputAttachment, 4);
+        TestGenerateMipmaps(false, texture, 0, 1);
+    }
+
+    // Test that an error texture makes the command an error.
+    TEST_F(GenerateMipmapsValidationTest, ErrorTexture) {
+        wgpu::Texture texture;
+        ASSERT_DEVICE_ERROR(texture = CreateTexture(0));
+        TestGenerateMipmaps(false, texture, 0, 1);
+    }
+
+    // Test that a destroyed texture can't be used.
+    TEST_F(GenerateMipmapsValidationTest, DestroyedTexture) {
+        wgpu::Texture texture = CreateTexture(5);
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        encoder.GenerateMipmaps(texture, 0, 5);
+        wgpu::CommandBuffer commands = encoder.Finish();
+
+        texture.Destroy();
+        wgpu::Queue queue = device.CreateQueue();
+        ASSERT_DEVICE_ERROR(queue.Submit(1, &commands));
+    }
+
+}  // anonymous namespace
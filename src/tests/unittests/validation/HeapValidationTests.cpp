@@ -0,0 +1,123 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/unittests/validation/ValidationTest.h"
+
+namespace {
+
+    constexpr uint64_t kHeapSize = 1 << 20;
+
+    class HeapValidationTest : public ValidationTest {
+      protected:
+        wgpu::Heap CreateHeap(uint64_t size) {
+            wgpu::HeapDescriptor descriptor;
+            descriptor.size = size;
+            return device.CreateHeap(&descriptor);
+        }
+
+        wgpu::TextureDescriptor CreateTextureDescriptor(const wgpu::ChainedStruct* chain) {
+            wgpu::TextureDescriptor descriptor;
+            descriptor.nextInChain = chain;
+            descriptor.size = {16, 16, 1};
+            descriptor.format = wgpu::TextureFormat::RGBA8Unorm;
+            descriptor.usage = wgpu::TextureUsage::OutputAttachment | wgpu::TextureUsage::Sampled;
+            return descriptor;
+        }
+
+        wgpu::BufferDescriptor CreateBufferDescriptor(const wgpu::ChainedStruct* chain) {
+            wgpu::BufferDescriptor descriptor;
+            descriptor.nextInChain = chain;
+            descriptor.size = 256;
+            descriptor.usage = wgpu::BufferUsage::Vertex | wgpu::BufferUsage::CopyDst;
+            return descriptor;
+        }
+    };
+
+    // Test that heaps can't be empty.
+    TEST_F(HeapValidationTest, HeapSize) {
+        CreateHeap(kHeapSize);
+        ASSERT_DEVICE_ERROR(CreateHeap(0));
+    }
+
+    // Test that textures and buffers can be placed in a heap, including at overlapping offsets.
+    TEST_F(HeapValidationTest, PlacedResourcesSuccess) {
+        wgpu::PlacedResourceDescriptor placement;
+        placement.heap = CreateHeap(kHeapSize);
+
+        wgpu::TextureDescriptor textureDescriptor = CreateTextureDescriptor(&placement);
+        device.CreateTexture(&textureDescriptor);
+        device.CreateTexture(&textureDescriptor);
+
+        wgpu::BufferDescriptor bufferDescriptor = CreateBufferDescriptor(&placement);
+        device.CreateBuffer(&bufferDescriptor);
+
+        placement.offset = kHeapSize / 2;
+        device.CreateBuffer(&bufferDescriptor);
+    }
+
+    // Test that placing a resource in an error heap is an error.
+    TEST_F(HeapValidationTest, ErrorHeap) {
+        wgpu::PlacedResourceDescriptor placement;
+        ASSERT_DEVICE_ERROR(placement.heap = CreateHeap(0));
+
+        wgpu::TextureDescriptor textureDescriptor = CreateTextureDescriptor(&placement);
+        ASSERT_DEVICE_ERROR(device.CreateTexture(&textureDescriptor));
+
+        wgpu::BufferDescriptor bufferDescriptor = CreateBufferDescriptor(&placement);
+        ASSERT_DEVICE_ERROR(device.CreateBuffer(&bufferDescriptor));
+    }
+
+    // Test that resources must be placed inside the heap.
+    TEST_F(HeapValidationTest, OffsetOutsideOfHeap) {
+        wgpu::PlacedResourceDescriptor placement;
+        placement.heap = CreateHeap(kHeapSize);
+        placement.offset = kHeapSize;
+
+        wgpu::TextureDescriptor textureDescriptor = CreateTextureDescriptor(&placement);
+        ASSERT_DEVICE_ERROR(device.CreateTexture(&textureDescriptor));
+
+        wgpu::BufferDescriptor bufferDescriptor = CreateBufferDescriptor(&placement);
+        ASSERT_DEVICE_ERROR(device.CreateBuffer(&bufferDescriptor));
+    }
+
+    // Test that mappable buffers and transient attachments can't be placed in a heap.
+    TEST_F(HeapValidationTest, UnplaceableUsages) {
+        wgpu::PlacedResourceDescriptor placement;
+        placement.heap = CreateHeap(kHeapSize);
+
+        wgpu::BufferDescriptor bufferDescriptor = CreateBufferDescriptor(&placement);
+        bufferDescriptor.usage = wgpu::BufferUsage::MapRead | wgpu::BufferUsage::CopyDst;
+        ASSERT_DEVICE_ERROR(device.CreateBuffer(&bufferDescriptor));
+
+        bufferDescriptor.usage = wgpu::BufferUsage::MapWrite | wgpu::BufferUsage::CopySrc;
+        ASSERT_DEVICE_ERROR(device.CreateBuffer(&bufferDescriptor));
+
+        wgpu::TextureDescriptor textureDescriptor = CreateTextureDescriptor(&placement);
+        textureDescriptor.usage =
+            wgpu::TextureUsage::OutputAttachment | wgpu::TextureUsage::TransientAttachment;
+        ASSERT_DEVICE_ERROR(device.CreateTexture(&textureDescriptor));
+    }
+
+    // Test that only placed resource descriptors can be chained to resource descriptors.
+    TEST_F(HeapValidationTest, InvalidChainedStruct) {
+        wgpu::SurfaceDescriptorFromXlib xlibDescriptor;
+
+        wgpu::TextureDescriptor textureDescriptor = CreateTextureDescriptor(&xlibDescriptor);
+        ASSERT_DEVICE_ERROR(device.CreateTexture(&textureDescriptor));
+
+        wgpu::BufferDescriptor bufferDescriptor = CreateBufferDescriptor(&xlibDescriptor);
+        ASSERT_DEVICE_ERROR(device.CreateBuffer(&bufferDescriptor));
+    }
+
+}  // anonymous namespace
@@ -0,0 +1,199 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/unittests/validation/ValidationTest.h"
+
+#include "utils/ComboRenderPipelineDescriptor.h"
+#include "utils/WGPUHelpers.h"
+
+namespace {
+
+    class PipelineManifestTest : public ValidationTest {
+      protected:
+        void SetUp() override {
+            ValidationTest::SetUp();
+            recordingDevice = CreateRecordingDevice();
+        }
+
+        wgpu::Device CreateRecordingDevice(bool optimizeShaderModules = false) {
+            dawn_native::DeviceDescriptor descriptor;
+            descriptor.forceEnabledToggles.push_back("record_pipeline_manifest");
+            if (optimizeShaderModules) {
+                descriptor.forceEnabledToggles.push_back("optimize_shader_modules");
+            }
+            return wgpu::Device::Acquire(adapter.CreateDevice(&descriptor));
+        }
+
+        // The helper function is inlined and removed by the optimizer.
+        wgpu::ComputePipeline CreateOptimizableComputePipeline(const wgpu::Device& targetDevice) {
+            wgpu::ComputePipelineDescriptor descriptor;
+            descriptor.computeStage.module =
+                utils::CreateShaderModule(targetDevice, utils::SingleShaderStage::Compute, R"(
+                    #version 450
+                    layout(std430, set = 0, binding = 0) buffer Data {
+                        uint values[];
+                    } data;
+                    uint Value() {
+                        return 2;
+                    }
+                    void main() {
+                        data.values[0] = Value();
+                    })");
+            descriptor.computeStage.entryPoint = "main";
+            return targetDevice.CreateComputePipeline(&descriptor);
+        }
+
+        wgpu::ComputePipeline CreateComputePipeline(const wgpu::Device& targetDevice) {
+            wgpu::ComputePipelineDescriptor descriptor;
+            descriptor.computeStage.module =
+                utils::CreateShaderModule(targetDevice, utils::SingleShaderStage::Compute, R"(
+                    #version 450
+                    layout(std430, set = 0, binding = 0) buffer Data {
+                        uint values[];
+                    } data;
+                    void main() {
+                        data.values[0] = 1;
+                    })");
+            descriptor.computeStage.entryPoint = "main";
+            return targetDevice.CreateComputePipeline(&descriptor);
+        }
+
+        wgpu::RenderPipeline CreateRenderPipeline(const wgpu::Device& targetDevice) {
+            utils::ComboRenderPipelineDescriptor descriptor(targetDevice);
+            descriptor.vertexStage.module =
+                utils::CreateShaderModule(targetDevice, utils::SingleShaderStage::Vertex, R"(
+                    #version 450
+                    layout(location = 0) in vec4 position;
+                    void main() {
+                        gl_Position = position;
+                    })");
+            descriptor.cFragmentStage.module =
+                utils::CreateShaderModule(targetDevice, utils::SingleShaderStage::Fragment, R"(
+                    #version 450
+                    layout(location = 0) out vec4 fragColor;
+                    void main() {
+                        fragColor = vec4(1.0);
+                    })");
+            descriptor.cVertexState.vertexBufferCount = 1;
+            descriptor.cVertexState.cVertexBuffers[0].arrayStride = 16;
+            descriptor.cVertexState.cVertexBuffers[0].attributeCount = 1;
+            descriptor.cVertexState.cAttributes[0].format = wgpu::VertexFormat::Float4;
+            descriptor.cDepthStencilState.format = wgpu::TextureFormat::Depth24PlusStencil8;
+            descriptor.depthStencilState = &descriptor.cDepthStencilState;
+            return targetDevice.CreateRenderPipeline(&descriptor);
+        }
+
+        wgpu::Device recordingDevice;
+    };
+
+    // Test that replaying a manifest creates the same pipelines, which are then recorded in the
+    // same order by the device replaying it.
+    TEST_F(PipelineManifestTest, ReplayRecreatesPipelines) {
+        CreateComputePipeline(recordingDevice);
+        CreateRenderPipeline(recordingDevice);
+        std::vector<uint8_t> manifest = dawn_native::GetPipelineManifest(recordingDevice.Get());
+
+        wgpu::Device replayingDevice = CreateRecordingDevice();
+        EXPECT_TRUE(
+            dawn_native::WarmUpPipelines(replayingDevice.Get(), manifest.data(), manifest.size()));
+        EXPECT_EQ(manifest, dawn_native::GetPipelineManifest(replayingDevice.Get()));
+
+        // The warmed up pipelines are found in the caches so creating them again doesn't change
+        // the manifest.
+        CreateComputePipeline(replayingDevice);
+        CreateRenderPipeline(replayingDevice);
+        EXPECT_EQ(manifest, dawn_native::GetPipelineManifest(replayingDevice.Get()));
+    }
+
+    // Test that manifests recorded with optimize_shader_modules contain the code the application
+    // gave, so that they are the same as without the optimization and can be replayed on fresh
+    // devices with or without it.
+    TEST_F(PipelineManifestTest, OptimizedModulesRecordOriginalCode) {
+        wgpu::Device optimizingDevice = CreateRecordingDevice(true);
+        CreateOptimizableComputePipeline(optimizingDevice);
+        CreateRenderPipeline(optimizingDevice);
+        std::vector<uint8_t> manifest = dawn_native::GetPipelineManifest(optimizingDevice.Get());
+
+        CreateOptimizableComputePipeline(recordingDevice);
+        CreateRenderPipeline(recordingDevice);
+        EXPECT_EQ(manifest, dawn_native::GetPipelineManifest(recordingDevice.Get()));
+
+        // Replaying on a fresh optimizing device creates the same modules and pipelines as the
+        // application does, so creating them again is a cache hit that isn't recorded again.
+        wgpu::Device replayingDevice = CreateRecordingDevice(true);
+        EXPECT_TRUE(
+            dawn_native::WarmUpPipelines(replayingDevice.Get(), manifest.data(), manifest.size()));
+        EXPECT_EQ(manifest, dawn_native::GetPipelineManifest(replayingDevice.Get()));
+
+        CreateOptimizableComputePipeline(replayingDevice);
+        CreateRenderPipeline(replayingDevice);
+        EXPECT_EQ(manifest, dawn_native::GetPipelineManifest(replayingDevice.Get()));
+
+        // The manifest can also be replayed without the optimization.
+        wgpu::Device nonOptimizingDevice = CreateRecordingDevice();
+        EXPECT_TRUE(dawn_native::WarmUpPipelines(nonOptimizingDevice.Get(), manifest.data(),
+                                                 manifest.size()));
+        EXPECT_EQ(manifest, dawn_native::GetPipelineManifest(nonOptimizingDevice.Get()));
+    }
+
+    // Test that a pipeline created again after being released is only recorded once, and that
+    // shader modules used by several pipelines don't make the manifest grow.
+    TEST_F(PipelineManifestTest, PipelinesAreRecordedOnce) {
+        CreateComputePipeline(recordingDevice);
+        std::vector<uint8_t> manifest = dawn_native::GetPipelineManifest(recordingDevice.Get());
+
+        CreateComputePipeline(recordingDevice);
+        EXPECT_EQ(manifest, dawn_native::GetPipelineManifest(recordingDevice.Get()));
+    }
+
+    // Test that pipelines aren't recorded without the toggle.
+    TEST_F(PipelineManifestTest, NotRecordedWithoutToggle) {
+        std::vector<uint8_t> emptyManifest =
+            dawn_native::GetPipelineManifest(recordingDevice.Get());
+
+        CreateComputePipeline(device);
+        CreateRenderPipeline(device);
+        EXPECT_EQ(emptyManifest, dawn_native::GetPipelineManifest(device.Get()));
+    }
+
+    // Test that invalid manifests are rejected.
+    TEST_F(PipelineManifestTest, InvalidManifest) {
+        CreateComputePipeline(recordingDevice);
+        CreateRenderPipeline(recordingDevice);
+        std::vector<uint8_t> manifest = dawn_native::GetPipelineManifest(recordingDevice.Get());
+
+        // Control case: the manifest is valid.
+        EXPECT_TRUE(dawn_native::WarmUpPipelines(device.Get(), manifest.data(), manifest.size()));
+
+        // Empty data.
+        ASSERT_DEVICE_ERROR(EXPECT_FALSE(dawn_native::WarmUpPipelines(device.Get(), nullptr, 0)));
+
+        // Truncated data.
+        ASSERT_DEVICE_ERROR(EXPECT_FALSE(
+            dawn_native::WarmUpPipelines(device.Get(), manifest.data(), manifest.size() - 1)));
+
+        // Trailing data.
+        std::vector<uint8_t> longerManifest = manifest;
+        longerManifest.push_back(0);
+        ASSERT_DEVICE_ERROR(EXPECT_FALSE(dawn_native::WarmUpPipelines(
+            device.Get(), longerManifest.data(), longerManifest.size())));
+
+        // Data that isn't a manifest.
+        std::vector<uint8_t> otherData = manifest;
+        otherData[0] ^= 0xFF;
+        ASSERT_DEVICE_ERROR(EXPECT_FALSE(
+            dawn_native::WarmUpPipelines(device.Get(), otherData.data(), otherData.size())));
+    }
+
+}  // anonymous namespace
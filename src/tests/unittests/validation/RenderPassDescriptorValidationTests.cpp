@@ -737,6 +737,86 @@ TEST_F(RenderPassDescriptorValidationTest, UseNaNOrINFINITYAsColorOrDepthClearVa
     }
 }
 
+// Test that transient attachments must be cleared at the start and at the end of the render pass.
+TEST_F(RenderPassDescriptorValidationTest, TransientAttachmentLoadAndStoreOps) {
+    constexpr wgpu::TextureUsage kTransientUsage =
+        wgpu::TextureUsage::OutputAttachment | wgpu::TextureUsage::TransientAttachment;
+    wgpu::TextureView color =
+        CreateTexture(device, wgpu::TextureDimension::e2D, wgpu::TextureFormat::RGBA8Unorm, 1, 1,
+                      1, 1, 1, kTransientUsage)
+            .CreateView();
+    wgpu::TextureView depthStencil =
+        CreateTexture(device, wgpu::TextureDimension::e2D, wgpu::TextureFormat::Depth24PlusStencil8,
+                      1, 1, 1, 1, 1, kTransientUsage)
+            .CreateView();
+
+    // Success when everything is cleared and discarded.
+    {
+        utils::ComboRenderPassDescriptor renderPass({color}, depthStencil);
+        renderPass.cColorAttachments[0].storeOp = wgpu::StoreOp::Clear;
+        renderPass.cDepthStencilAttachmentInfo.depthStoreOp = wgpu::StoreOp::Clear;
+        renderPass.cDepthStencilAttachmentInfo.stencilStoreOp = wgpu::StoreOp::Clear;
+        AssertBeginRenderPassSuccess(&renderPass);
+    }
+
+    // Error when a transient color attachment is loaded or stored.
+    {
+        utils::ComboRenderPassDescriptor renderPass({color});
+        renderPass.cColorAttachments[0].loadOp = wgpu::LoadOp::Load;
+        renderPass.cColorAttachments[0].storeOp = wgpu::StoreOp::Clear;
+        AssertBeginRenderPassError(&renderPass);
+    }
+    {
+        utils::ComboRenderPassDescriptor renderPass({color});
+        renderPass.cColorAttachments[0].storeOp = wgpu::StoreOp::Store;
+        AssertBeginRenderPassError(&renderPass);
+    }
+
+    // Error when a transient depth stencil attachment is loaded or stored.
+    {
+        utils::ComboRenderPassDescriptor renderPass({}, depthStencil);
+        renderPass.cDepthStencilAttachmentInfo.stencilLoadOp = wgpu::LoadOp::Load;
+        renderPass.cDepthStencilAttachmentInfo.depthStoreOp = wgpu::StoreOp::Clear;
+        renderPass.cDepthStencilAttachmentInfo.stencilStoreOp = wgpu::StoreOp::Clear;
+        AssertBeginRenderPassError(&renderPass);
+    }
+    {
+        utils::ComboRenderPassDescriptor renderPass({}, depthStencil);
+        AssertBeginRenderPassError(&renderPass);
+    }
+}
+
+// Test that a transient multisampled attachment can be resolved but can't be a resolve target.
+TEST_F(MultisampledRenderPassDescriptorValidationTest, TransientAttachments) {
+    constexpr wgpu::TextureUsage kTransientUsage =
+        wgpu::TextureUsage::OutputAttachment | wgpu::TextureUsage::TransientAttachment;
+
+    // It is allowed to resolve a transient multisampled color attachment.
+    {
+        wgpu::TextureView transientColor =
+            CreateTexture(device, wgpu::TextureDimension::e2D, kColorFormat, kSize, kSize,
+                          kArrayLayers, kLevelCount, kSampleCount, kTransientUsage)
+                .CreateView();
+
+        utils::ComboRenderPassDescriptor renderPass({transientColor});
+        renderPass.cColorAttachments[0].resolveTarget = CreateNonMultisampledColorTextureView();
+        renderPass.cColorAttachments[0].storeOp = wgpu::StoreOp::Clear;
+        AssertBeginRenderPassSuccess(&renderPass);
+    }
+
+    // It is not allowed to use a transient texture as resolve target.
+    {
+        wgpu::TextureView transientResolveTarget =
+            CreateTexture(device, wgpu::TextureDimension::e2D, kColorFormat, kSize, kSize,
+                          kArrayLayers, kLevelCount, 1, kTransientUsage)
+                .CreateView();
+
+        utils::ComboRenderPassDescriptor renderPass = CreateMultisampledRenderPass();
+        renderPass.cColorAttachments[0].resolveTarget = transientResolveTarget;
+        AssertBeginRenderPassError(&renderPass);
+    }
+}
+
 // TODO(cwallez@chromium.org): Constraints on attachment aliasing?
 
 } // anonymous namespace
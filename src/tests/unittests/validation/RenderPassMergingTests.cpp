@@ -0,0 +1,212 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/unittests/validation/ValidationTest.h"
+
+#include "dawn_native/CommandBuffer.h"
+#include "utils/WGPUHelpers.h"
+
+namespace {
+
+    class RenderPassMergingTest : public ValidationTest {
+      protected:
+        void SetUp() override {
+            ValidationTest::SetUp();
+
+            dawn_native::DeviceDescriptor descriptor;
+            descriptor.forceEnabledToggles.push_back("merge_render_passes");
+            mergingDevice = wgpu::Device::Acquire(adapter.CreateDevice(&descriptor));
+        }
+
+        wgpu::TextureView CreateAttachmentView(const wgpu::Device& targetDevice,
+                                               wgpu::TextureFormat format) {
+            wgpu::TextureDescriptor descriptor;
+            descriptor.dimension = wgpu::TextureDimension::e2D;
+            descriptor.size = {16, 16, 1};
+            descriptor.format = format;
+            descriptor.usage = wgpu::TextureUsage::OutputAttachment;
+            return targetDevice.CreateTexture(&descriptor).CreateView();
+        }
+
+        wgpu::TextureView CreateColorView() {
+            return CreateAttachmentView(mergingDevice, wgpu::TextureFormat::RGBA8Unorm);
+        }
+
+        // Makes the render pass load all its attachments instead of clearing them.
+        void LoadAllAttachments(utils::ComboRenderPassDescriptor* descriptor) {
+            for (uint32_t i = 0; i < descriptor->colorAttachmentCount; ++i) {
+                descriptor->cColorAttachments[i].loadOp = wgpu::LoadOp::Load;
+            }
+            descriptor->cDepthStencilAttachmentInfo.depthLoadOp = wgpu::LoadOp::Load;
+            descriptor->cDepthStencilAttachmentInfo.stencilLoadOp = wgpu::LoadOp::Load;
+        }
+
+        std::vector<bool> GetMerges(const wgpu::CommandBuffer& commands, size_t renderPassCount) {
+            const dawn_native::CommandBufferBase* commandBuffer =
+                reinterpret_cast<const dawn_native::CommandBufferBase*>(commands.Get());
+            std::vector<bool> merges;
+            for (size_t i = 0; i < renderPassCount; ++i) {
+                merges.push_back(commandBuffer->IsRenderPassMergedWithPrevious(i));
+            }
+            return merges;
+        }
+
+        wgpu::Device mergingDevice;
+    };
+
+    // Test that a render pass loading what the previous pass stored in the same attachments is
+    // merged with it, including a chain of several passes.
+    TEST_F(RenderPassMergingTest, SameAttachmentsAreMerged) {
+        wgpu::TextureView color = CreateColorView();
+        wgpu::TextureView depthStencil =
+            CreateAttachmentView(mergingDevice, wgpu::TextureFormat::Depth24PlusStencil8);
+
+        utils::ComboRenderPassDescriptor first({color}, depthStencil);
+        utils::ComboRenderPassDescriptor next({color}, depthStencil);
+        LoadAllAttachments(&next);
+
+        wgpu::CommandEncoder encoder = mergingDevice.CreateCommandEncoder();
+        encoder.BeginRenderPass(&first).EndPass();
+        encoder.BeginRenderPass(&next).EndPass();
+        encoder.BeginRenderPass(&next).EndPass();
+        wgpu::CommandBuffer commands = encoder.Finish();
+
+        EXPECT_EQ(std::vector<bool>({false, true, true}), GetMerges(commands, 3));
+    }
+
+    // Test that passes aren't merged when the toggle is disabled.
+    TEST_F(RenderPassMergingTest, DisabledWithoutToggle) {
+        wgpu::TextureView color = CreateAttachmentView(device, wgpu::TextureFormat::RGBA8Unorm);
+
+        utils::ComboRenderPassDescriptor first({color});
+        utils::ComboRenderPassDescriptor next({color});
+        LoadAllAttachments(&next);
+
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        encoder.BeginRenderPass(&first).EndPass();
+        encoder.BeginRenderPass(&next).EndPass();
+        wgpu::CommandBuffer commands = encoder.Finish();
+
+        EXPECT_EQ(std::vector<bool>({false, false}), GetMerges(commands, 2));
+    }
+
+    // Test that passes with different attachments aren't merged.
+    TEST_F(RenderPassMergingTest, DifferentAttachmentsAreNotMerged) {
+        wgpu::TextureView color1 = CreateColorView();
+        wgpu::TextureView color2 = CreateColorView();
+
+        utils::ComboRenderPassDescriptor first({color1});
+        utils::ComboRenderPassDescriptor otherView({color2});
+        LoadAllAttachments(&otherView);
+        utils::ComboRenderPassDescriptor moreAttachments({color2, color1});
+        LoadAllAttachments(&moreAttachments);
+
+        wgpu::CommandEncoder encoder = mergingDevice.CreateCommandEncoder();
+        encoder.BeginRenderPass(&first).EndPass();
+        encoder.BeginRenderPass(&otherView).EndPass();
+        encoder.BeginRenderPass(&moreAttachments).EndPass();
+        wgpu::CommandBuffer commands = encoder.Finish();
+
+        EXPECT_EQ(std::vector<bool>({false, false, false}), GetMerges(commands, 3));
+    }
+
+    // Test that the attachments must be stored by the previous pass and loaded by the next one.
+    TEST_F(RenderPassMergingTest, LoadAndStoreOps) {
+        wgpu::TextureView color = CreateColorView();
+
+        // The next pass clears the attachment.
+        {
+            utils::ComboRenderPassDescriptor first({color});
+            utils::ComboRenderPassDescriptor next({color});
+
+            wgpu::CommandEncoder encoder = mergingDevice.CreateCommandEncoder();
+            encoder.BeginRenderPass(&first).EndPass();
+            encoder.BeginRenderPass(&next).EndPass();
+            wgpu::CommandBuffer commands = encoder.Finish();
+
+            EXPECT_EQ(std::vector<bool>({false, false}), GetMerges(commands, 2));
+        }
+
+        // The previous pass discards the attachment.
+        {
+            utils::ComboRenderPassDescriptor first({color});
+            first.cColorAttachments[0].storeOp = wgpu::StoreOp::Clear;
+            utils::ComboRenderPassDescriptor next({color});
+            LoadAllAttachments(&next);
+
+            wgpu::CommandEncoder encoder = mergingDevice.CreateCommandEncoder();
+            encoder.BeginRenderPass(&first).EndPass();
+            encoder.BeginRenderPass(&next).EndPass();
+            wgpu::CommandBuffer commands = encoder.Finish();
+
+            EXPECT_EQ(std::vector<bool>({false, false}), GetMerges(commands, 2));
+        }
+    }
+
+    // Test that passes separated by other commands aren't merged.
+    TEST_F(RenderPassMergingTest, CommandsBetweenPasses) {
+        wgpu::TextureView color = CreateColorView();
+        utils::ComboRenderPassDescriptor first({color});
+        utils::ComboRenderPassDescriptor next({color});
+        LoadAllAttachments(&next);
+
+        wgpu::BufferDescriptor bufferDescriptor;
+        bufferDescriptor.size = 4;
+        bufferDescriptor.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::CopyDst;
+        wgpu::Buffer source = mergingDevice.CreateBuffer(&bufferDescriptor);
+        wgpu::Buffer destination = mergingDevice.CreateBuffer(&bufferDescriptor);
+
+        wgpu::CommandEncoder encoder = mergingDevice.CreateCommandEncoder();
+        encoder.BeginRenderPass(&first).EndPass();
+        encoder.CopyBufferToBuffer(source, 0, destination, 0, 4);
+        encoder.BeginRenderPass(&next).EndPass();
+        encoder.BeginComputePass().EndPass();
+        encoder.BeginRenderPass(&next).EndPass();
+        wgpu::CommandBuffer commands = encoder.Finish();
+
+        EXPECT_EQ(std::vector<bool>({false, false, false}), GetMerges(commands, 3));
+    }
+
+    // Test that a pass using resources that the previous pass didn't use the same way isn't
+    // merged since it could need barriers.
+    TEST_F(RenderPassMergingTest, ResourceUsages) {
+        wgpu::TextureView color = CreateColorView();
+        utils::ComboRenderPassDescriptor first({color});
+        utils::ComboRenderPassDescriptor next({color});
+        LoadAllAttachments(&next);
+
+        wgpu::BufferDescriptor bufferDescriptor;
+        bufferDescriptor.size = 16;
+        bufferDescriptor.usage = wgpu::BufferUsage::Vertex;
+        wgpu::Buffer vertexBuffer = mergingDevice.CreateBuffer(&bufferDescriptor);
+
+        wgpu::CommandEncoder encoder = mergingDevice.CreateCommandEncoder();
+        encoder.BeginRenderPass(&first).EndPass();
+
+        // Uses a buffer that the previous pass didn't use.
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&next);
+        pass.SetVertexBuffer(0, vertexBuffer);
+        pass.EndPass();
+
+        // Uses the same buffer with the same usage.
+        pass = encoder.BeginRenderPass(&next);
+        pass.SetVertexBuffer(0, vertexBuffer);
+        pass.EndPass();
+
+        wgpu::CommandBuffer commands = encoder.Finish();
+
+        EXPECT_EQ(std::vector<bool>({false, false, true}), GetMerges(commands, 3));
+    }
+
+}  // anonymous namespace
@@ -0,0 +1,71 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/unittests/validation/ValidationTest.h"
+
+namespace {
+
+    class ResetDeviceForTestingTest : public ValidationTest {
+      protected:
+        void SetUp() override {
+            ValidationTest::SetUp();
+            // The device of the fixture keeps its callbacks, reset another one.
+            resetDevice = wgpu::Device::Acquire(adapter.CreateDevice());
+        }
+
+        wgpu::Buffer CreateBuffer() {
+            wgpu::BufferDescriptor descriptor;
+            descriptor.size = 4;
+            descriptor.usage = wgpu::BufferUsage::MapRead;
+            return resetDevice.CreateBuffer(&descriptor);
+        }
+
+        bool Reset() {
+            return dawn_native::ResetDeviceForTesting(resetDevice.Get());
+        }
+
+        wgpu::Device resetDevice;
+    };
+
+    // Test that a device can be reset once all its objects are released.
+    TEST_F(ResetDeviceForTestingTest, ReleasedObjects) {
+        EXPECT_TRUE(Reset());
+
+        CreateBuffer();
+        EXPECT_TRUE(Reset());
+    }
+
+    // Test that a device can't be reset while objects are alive, including objects kept alive
+    // until GPU work completes.
+    TEST_F(ResetDeviceForTestingTest, LiveObjects) {
+        wgpu::Buffer buffer = CreateBuffer();
+        EXPECT_FALSE(Reset());
+
+        buffer.MapReadAsync(
+            [](WGPUBufferMapAsyncStatus, const void*, uint64_t, void*) {}, nullptr);
+        buffer = wgpu::Buffer();
+        EXPECT_TRUE(Reset());
+    }
+
+    // Test that the error scopes that weren't popped are cleared.
+    TEST_F(ResetDeviceForTestingTest, ErrorScopes) {
+        resetDevice.PushErrorScope(wgpu::ErrorFilter::Validation);
+        resetDevice.PushErrorScope(wgpu::ErrorFilter::OutOfMemory);
+        EXPECT_TRUE(Reset());
+
+        EXPECT_FALSE(resetDevice.PopErrorScope(
+            [](WGPUErrorType, const char*, void*) {}, nullptr));
+    }
+
+}  // anonymous namespace
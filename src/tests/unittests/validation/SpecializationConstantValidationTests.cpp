@@ -0,0 +1,136 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/unittests/validation/ValidationTest.h"
+
+#include "utils/ComboRenderPipelineDescriptor.h"
+#include "utils/WGPUHelpers.h"
+
+#include <limits>
+
+class SpecializationConstantValidationTest : public ValidationTest {
+  protected:
+    void SetUp() override {
+        ValidationTest::SetUp();
+
+        computeModule = utils::CreateShaderModule(device, utils::SingleShaderStage::Compute, R"(
+            #version 450
+            layout(constant_id = 0) const bool kBool = false;
+            layout(constant_id = 1) const int kInt = 0;
+            layout(constant_id = 2) const uint kUint = 0;
+            layout(constant_id = 3) const float kFloat = 0.0;
+            layout(constant_id = 4) const double kDouble = 0.0;
+            layout(std430, set = 0, binding = 0) buffer Result {
+                float result;
+            };
+            void main() {
+                result = float(kBool) + float(kInt) + float(kUint) + kFloat + float(kDouble);
+            })");
+
+        wgpu::BindGroupLayout bgl = utils::MakeBindGroupLayout(
+            device, {{0, wgpu::ShaderStage::Compute, wgpu::BindingType::StorageBuffer}});
+        computeLayout = utils::MakeBasicPipelineLayout(device, &bgl);
+    }
+
+    void TestCompute(bool success, std::vector<wgpu::SpecializationConstant> constants) {
+        wgpu::ComputePipelineDescriptor descriptor;
+        descriptor.layout = computeLayout;
+        descriptor.computeStage.module = computeModule;
+        descriptor.computeStage.entryPoint = "main";
+        descriptor.computeStage.constantCount = static_cast<uint32_t>(constants.size());
+        descriptor.computeStage.constants = constants.data();
+
+        if (success) {
+            device.CreateComputePipeline(&descriptor);
+        } else {
+            ASSERT_DEVICE_ERROR(device.CreateComputePipeline(&descriptor));
+        }
+    }
+
+    wgpu::ShaderModule computeModule;
+    wgpu::PipelineLayout computeLayout;
+};
+
+// Test setting constants of all the supported types.
+TEST_F(SpecializationConstantValidationTest, Success) {
+    TestCompute(true, {});
+    TestCompute(true, {{0, 1.0}, {1, -4.0}, {2, 7.0}, {3, 0.5}});
+    TestCompute(true, {{3, -1.5}, {0, 0.0}});
+}
+
+// Test that only the scalar 32-bit constants of the module can be set, and only once.
+TEST_F(SpecializationConstantValidationTest, ConstantIds) {
+    // 5 isn't a constant of the module.
+    TestCompute(false, {{5, 1.0}});
+    // 64-bit constants can't be set.
+    TestCompute(false, {{4, 1.0}});
+    // Constants can't be set twice, even to the same value.
+    TestCompute(false, {{1, 1.0}, {1, 1.0}});
+}
+
+// Test that the values must be representable in the type of the constant.
+TEST_F(SpecializationConstantValidationTest, Values) {
+    // Bools must be 0 or 1.
+    TestCompute(false, {{0, 2.0}});
+
+    // Integers must be integral and in range.
+    TestCompute(true, {{1, double(std::numeric_limits<int32_t>::min())}});
+    TestCompute(true, {{1, double(std::numeric_limits<int32_t>::max())}});
+    TestCompute(false, {{1, 0.5}});
+    TestCompute(false, {{1, double(std::numeric_limits<int32_t>::max()) + 1.0}});
+    TestCompute(true, {{2, double(std::numeric_limits<uint32_t>::max())}});
+    TestCompute(false, {{2, -1.0}});
+    TestCompute(false, {{2, double(std::numeric_limits<uint32_t>::max()) + 1.0}});
+
+    // Floats must be finite and in range.
+    TestCompute(false, {{3, std::numeric_limits<double>::infinity()}});
+    TestCompute(false, {{3, std::numeric_limits<double>::quiet_NaN()}});
+    TestCompute(false, {{3, 1e39}});
+}
+
+// Test that the constants of each stage of a render pipeline are validated against its module.
+TEST_F(SpecializationConstantValidationTest, RenderPipelineStages) {
+    wgpu::ShaderModule vsModule =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Vertex, R"(
+            #version 450
+            layout(constant_id = 0) const float kScale = 1.0;
+            void main() {
+                gl_Position = vec4(kScale);
+            })");
+    wgpu::ShaderModule fsModule =
+        utils::CreateShaderModule(device, utils::SingleShaderStage::Fragment, R"(
+            #version 450
+            layout(constant_id = 1) const float kAlpha = 1.0;
+            layout(location = 0) out vec4 fragColor;
+            void main() {
+                fragColor = vec4(kAlpha);
+            })");
+
+    utils::ComboRenderPipelineDescriptor descriptor(device);
+    descriptor.vertexStage.module = vsModule;
+    descriptor.cFragmentStage.module = fsModule;
+
+    wgpu::SpecializationConstant vertexConstant = {0, 2.0};
+    wgpu::SpecializationConstant fragmentConstant = {1, 0.5};
+
+    descriptor.vertexStage.constantCount = 1;
+    descriptor.vertexStage.constants = &vertexConstant;
+    descriptor.cFragmentStage.constantCount = 1;
+    descriptor.cFragmentStage.constants = &fragmentConstant;
+    device.CreateRenderPipeline(&descriptor);
+
+    // Constant 1 isn't in the vertex module.
+    descriptor.vertexStage.constants = &fragmentConstant;
+    ASSERT_DEVICE_ERROR(device.CreateRenderPipeline(&descriptor));
+}
@@ -379,6 +379,34 @@ TEST_F(TextureValidationTest, TextureFormatNotSupportTextureUsageStorage) {
     }
 }
 
+// Test that TransientAttachment can only be combined with OutputAttachment.
+TEST_F(TextureValidationTest, TransientAttachmentUsage) {
+    wgpu::TextureDescriptor descriptor = CreateDefaultTextureDescriptor();
+
+    descriptor.usage = wgpu::TextureUsage::OutputAttachment | wgpu::TextureUsage::TransientAttachment;
+    device.CreateTexture(&descriptor);
+
+    descriptor.sampleCount = 4;
+    device.CreateTexture(&descriptor);
+    descriptor.sampleCount = 1;
+
+    // Fails without OutputAttachment
+    descriptor.usage = wgpu::TextureUsage::TransientAttachment;
+    ASSERT_DEVICE_ERROR(device.CreateTexture(&descriptor));
+
+    // Fails with any other usage since the content can't leave the render pass
+    wgpu::TextureUsage kOtherUsages[] = {
+        wgpu::TextureUsage::CopySrc,
+        wgpu::TextureUsage::CopyDst,
+        wgpu::TextureUsage::Sampled,
+    };
+    for (wgpu::TextureUsage usage : kOtherUsages) {
+        descriptor.usage = wgpu::TextureUsage::OutputAttachment |
+                           wgpu::TextureUsage::TransientAttachment | usage;
+        ASSERT_DEVICE_ERROR(device.CreateTexture(&descriptor));
+    }
+}
+
 // Test it is an error to create a texture with format "Undefined".
 TEST_F(TextureValidationTest, TextureFormatUndefined) {
     wgpu::TextureDescriptor descriptor = CreateDefaultTextureDescriptor();
@@ -0,0 +1,107 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/unittests/validation/ValidationTest.h"
+
+#include "common/Platform.h"
+
+#if defined(DAWN_PLATFORM_LINUX)
+#    include <poll.h>
+#endif
+
+namespace {
+
+    class WaitForIdleTest : public ValidationTest {
+      protected:
+        static void MapReadCallback(WGPUBufferMapAsyncStatus status,
+                                    const void*,
+                                    uint64_t,
+                                    void* userdata) {
+            EXPECT_EQ(WGPUBufferMapAsyncStatus_Success, status);
+            *static_cast<bool*>(userdata) = true;
+        }
+
+        static void FenceCallback(WGPUFenceCompletionStatus status, void* userdata) {
+            EXPECT_EQ(WGPUFenceCompletionStatus_Success, status);
+            *static_cast<bool*>(userdata) = true;
+        }
+
+        wgpu::Buffer CreateMapReadBuffer() {
+            wgpu::BufferDescriptor descriptor;
+            descriptor.size = 4;
+            descriptor.usage = wgpu::BufferUsage::MapRead;
+            return device.CreateBuffer(&descriptor);
+        }
+    };
+
+    // Test that waiting for the device to be idle calls the map callbacks.
+    TEST_F(WaitForIdleTest, MapCallbacks) {
+        wgpu::Buffer buffer = CreateMapReadBuffer();
+
+        bool called = false;
+        buffer.MapReadAsync(MapReadCallback, &called);
+        EXPECT_TRUE(dawn_native::WaitForIdle(device.Get(), UINT64_MAX));
+        EXPECT_TRUE(called);
+    }
+
+    // Test that waiting for the device to be idle completes the signaled fences.
+    TEST_F(WaitForIdleTest, FenceCallbacks) {
+        wgpu::Queue queue = device.CreateQueue();
+        wgpu::FenceDescriptor descriptor;
+        wgpu::Fence fence = queue.CreateFence(&descriptor);
+        queue.Signal(fence, 1);
+
+        bool called = false;
+        fence.OnCompletion(1, FenceCallback, &called);
+        EXPECT_TRUE(dawn_native::WaitForIdle(device.Get(), 0));
+        EXPECT_TRUE(called);
+        EXPECT_EQ(1u, fence.GetCompletedValue());
+    }
+
+#if defined(DAWN_PLATFORM_LINUX)
+    // Test that the completion fd is readable when the device has callbacks to call, until it is
+    // ticked.
+    TEST_F(WaitForIdleTest, CompletionFd) {
+        int fd = dawn_native::GetCompletionFd(device.Get());
+        ASSERT_NE(-1, fd);
+        EXPECT_EQ(fd, dawn_native::GetCompletionFd(device.Get()));
+
+        auto IsReadable = [fd]() {
+            pollfd pollFd = {fd, POLLIN, 0};
+            return poll(&pollFd, 1, 0) == 1 && (pollFd.revents & POLLIN) != 0;
+        };
+        EXPECT_FALSE(IsReadable());
+
+        wgpu::Buffer buffer = CreateMapReadBuffer();
+        bool called = false;
+        buffer.MapReadAsync(MapReadCallback, &called);
+        EXPECT_TRUE(IsReadable());
+        EXPECT_FALSE(called);
+
+        device.Tick();
+        EXPECT_FALSE(IsReadable());
+        EXPECT_TRUE(called);
+
+        // Submits also signal it.
+        device.CreateQueue().Submit(0, nullptr);
+        EXPECT_TRUE(IsReadable());
+    }
+#else
+    // Test that the completion fd isn't supported on other platforms.
+    TEST_F(WaitForIdleTest, CompletionFdUnsupported) {
+        EXPECT_EQ(-1, dawn_native::GetCompletionFd(device.Get()));
+    }
+#endif
+
+}  // anonymous namespace
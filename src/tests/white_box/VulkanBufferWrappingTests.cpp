@@ -0,0 +1,257 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/DawnTest.h"
+
+#include "common/vulkan_platform.h"
+#include "dawn_native/VulkanBackend.h"
+#include "dawn_native/vulkan/AdapterVk.h"
+#include "dawn_native/vulkan/DeviceVk.h"
+#include "dawn_native/vulkan/FencedDeleter.h"
+#include "dawn_native/vulkan/ResourceMemoryAllocatorVk.h"
+
+#include <unistd.h>
+
+namespace {
+
+    constexpr uint64_t kBufferSize = 256;
+
+    // Fixture creating a VkBuffer with exportable memory and wrapping that memory in Dawn
+    // buffers. These tests are skipped if the harness is using the wire.
+    class VulkanBufferWrappingTests : public DawnTest {
+      public:
+        void TestSetUp() override {
+            if (UsesWire()) {
+                return;
+            }
+
+            deviceVk = reinterpret_cast<dawn_native::vulkan::Device*>(device.Get());
+            CreateBindExportBuffer();
+
+            defaultDescriptor.size = kBufferSize;
+            defaultDescriptor.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::CopyDst;
+        }
+
+        void TearDown() override {
+            if (!UsesWire()) {
+                deviceVk->GetFencedDeleter()->DeleteWhenUnused(exportedBuffer);
+                deviceVk->GetFencedDeleter()->DeleteWhenUnused(exportedAllocation);
+            }
+            DawnTest::TearDown();
+        }
+
+      protected:
+        // Creates a VkBuffer, binds exportable memory to it and exports that memory as an FD
+        void CreateBindExportBuffer() {
+            VkExternalMemoryBufferCreateInfoKHR externalInfo;
+            externalInfo.sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO_KHR;
+            externalInfo.pNext = nullptr;
+            externalInfo.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT_KHR;
+
+            VkBufferCreateInfo createInfo;
+            createInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+            createInfo.pNext = &externalInfo;
+            createInfo.flags = 0;
+            createInfo.size = kBufferSize;
+            createInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+            createInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+            createInfo.queueFamilyIndexCount = 0;
+            createInfo.pQueueFamilyIndices = nullptr;
+
+            VkResult result = deviceVk->fn.CreateBuffer(deviceVk->GetVkDevice(), &createInfo,
+                                                        nullptr, &exportedBuffer);
+            EXPECT_EQ(result, VK_SUCCESS) << "Failed to create external buffer";
+
+            VkMemoryRequirements requirements;
+            deviceVk->fn.GetBufferMemoryRequirements(deviceVk->GetVkDevice(), exportedBuffer,
+                                                     &requirements);
+
+            VkExportMemoryAllocateInfoKHR exportInfo;
+            exportInfo.sType = VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_KHR;
+            exportInfo.pNext = nullptr;
+            exportInfo.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT_KHR;
+
+            int bestType = deviceVk->GetResourceMemoryAllocatorForTesting()->FindBestTypeIndex(
+                requirements, false);
+            VkMemoryAllocateInfo allocateInfo;
+            allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+            allocateInfo.pNext = &exportInfo;
+            allocateInfo.allocationSize = requirements.size;
+            allocateInfo.memoryTypeIndex = static_cast<uint32_t>(bestType);
+
+            allocationSize = allocateInfo.allocationSize;
+            memoryTypeIndex = allocateInfo.memoryTypeIndex;
+
+            result = deviceVk->fn.AllocateMemory(deviceVk->GetVkDevice(), &allocateInfo, nullptr,
+                                                 &exportedAllocation);
+            EXPECT_EQ(result, VK_SUCCESS) << "Failed to allocate external memory";
+
+            result = deviceVk->fn.BindBufferMemory(deviceVk->GetVkDevice(), exportedBuffer,
+                                                   exportedAllocation, 0);
+            EXPECT_EQ(result, VK_SUCCESS) << "Failed to bind buffer memory";
+        }
+
+        // Extracts a new file descriptor for the exported memory, importing consumes the FD.
+        int GetMemoryFd() {
+            VkMemoryGetFdInfoKHR getFdInfo;
+            getFdInfo.sType = VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR;
+            getFdInfo.pNext = nullptr;
+            getFdInfo.memory = exportedAllocation;
+            getFdInfo.handleType = VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT_KHR;
+
+            int memoryFd = -1;
+            deviceVk->fn.GetMemoryFdKHR(deviceVk->GetVkDevice(), &getFdInfo, &memoryFd);
+
+            EXPECT_GE(memoryFd, 0) << "Failed to get file descriptor for external memory";
+            return memoryFd;
+        }
+
+        // Wraps the exported memory in a Dawn buffer
+        wgpu::Buffer WrapVulkanBuffer(wgpu::Device device,
+                                      const wgpu::BufferDescriptor* bufferDescriptor,
+                                      std::vector<int> waitFDs,
+                                      bool expectValid = true) {
+            dawn_native::vulkan::ExternalBufferDescriptorOpaqueFD descriptor;
+            descriptor.cBufferDescriptor =
+                reinterpret_cast<const WGPUBufferDescriptor*>(bufferDescriptor);
+            descriptor.allocationSize = allocationSize;
+            descriptor.memoryTypeIndex = memoryTypeIndex;
+            descriptor.memoryFD = GetMemoryFd();
+            descriptor.waitFDs = waitFDs;
+
+            WGPUBuffer buffer = dawn_native::vulkan::WrapVulkanBuffer(device.Get(), &descriptor);
+
+            if (expectValid) {
+                EXPECT_NE(buffer, nullptr) << "Failed to wrap buffer, are external memory / "
+                                              "semaphore extensions supported?";
+            } else {
+                EXPECT_EQ(buffer, nullptr);
+                close(descriptor.memoryFD);
+            }
+
+            return wgpu::Buffer::Acquire(buffer);
+        }
+
+        // Exports the signal from a wrapped buffer and ignores it
+        void IgnoreSignalSemaphore(wgpu::Device device, wgpu::Buffer wrappedBuffer) {
+            int fd = dawn_native::vulkan::ExportBufferSignalSemaphoreOpaqueFD(device.Get(),
+                                                                              wrappedBuffer.Get());
+            ASSERT_NE(fd, -1);
+            close(fd);
+        }
+
+        dawn_native::vulkan::Device* deviceVk;
+
+        wgpu::BufferDescriptor defaultDescriptor;
+        VkBuffer exportedBuffer = VK_NULL_HANDLE;
+        VkDeviceMemory exportedAllocation = VK_NULL_HANDLE;
+        VkDeviceSize allocationSize = 0;
+        uint32_t memoryTypeIndex = 0;
+    };
+
+}  // anonymous namespace
+
+// Test no error occurs if the import is valid
+TEST_P(VulkanBufferWrappingTests, SuccessfulImport) {
+    DAWN_SKIP_TEST_IF(UsesWire());
+    wgpu::Buffer buffer = WrapVulkanBuffer(device, &defaultDescriptor, {});
+    EXPECT_NE(buffer.Get(), nullptr);
+    IgnoreSignalSemaphore(device, buffer);
+}
+
+// Test an error occurs if the buffer descriptor is missing
+TEST_P(VulkanBufferWrappingTests, MissingBufferDescriptor) {
+    DAWN_SKIP_TEST_IF(UsesWire());
+    ASSERT_DEVICE_ERROR(wgpu::Buffer buffer = WrapVulkanBuffer(device, nullptr, {}, false));
+    EXPECT_EQ(buffer.Get(), nullptr);
+}
+
+// Test an error occurs if the buffer descriptor is invalid
+TEST_P(VulkanBufferWrappingTests, InvalidBufferDescriptor) {
+    DAWN_SKIP_TEST_IF(UsesWire());
+    wgpu::ChainedStruct chainedDescriptor;
+    defaultDescriptor.nextInChain = &chainedDescriptor;
+
+    ASSERT_DEVICE_ERROR(wgpu::Buffer buffer =
+                            WrapVulkanBuffer(device, &defaultDescriptor, {}, false));
+    EXPECT_EQ(buffer.Get(), nullptr);
+}
+
+// Test an error occurs if the wrapped buffer would be mappable
+TEST_P(VulkanBufferWrappingTests, MapUsageIsInvalid) {
+    DAWN_SKIP_TEST_IF(UsesWire());
+    defaultDescriptor.usage = wgpu::BufferUsage::MapRead | wgpu::BufferUsage::CopyDst;
+
+    ASSERT_DEVICE_ERROR(wgpu::Buffer buffer =
+                            WrapVulkanBuffer(device, &defaultDescriptor, {}, false));
+    EXPECT_EQ(buffer.Get(), nullptr);
+}
+
+// Test an error occurs if we try to export the signal semaphore twice
+TEST_P(VulkanBufferWrappingTests, DoubleSignalSemaphoreExport) {
+    DAWN_SKIP_TEST_IF(UsesWire());
+    wgpu::Buffer buffer = WrapVulkanBuffer(device, &defaultDescriptor, {});
+    ASSERT_NE(buffer.Get(), nullptr);
+    IgnoreSignalSemaphore(device, buffer);
+    ASSERT_DEVICE_ERROR(int fd = dawn_native::vulkan::ExportBufferSignalSemaphoreOpaqueFD(
+                            device.Get(), buffer.Get()));
+    ASSERT_EQ(fd, -1);
+}
+
+// Test an error occurs if we try to export the signal semaphore from a normal buffer
+TEST_P(VulkanBufferWrappingTests, NormalBufferSignalSemaphoreExport) {
+    DAWN_SKIP_TEST_IF(UsesWire());
+    wgpu::Buffer buffer = device.CreateBuffer(&defaultDescriptor);
+    ASSERT_NE(buffer.Get(), nullptr);
+    ASSERT_DEVICE_ERROR(int fd = dawn_native::vulkan::ExportBufferSignalSemaphoreOpaqueFD(
+                            device.Get(), buffer.Get()));
+    ASSERT_EQ(fd, -1);
+}
+
+// Test that data written in a wrapped buffer on one device is visible to the next device wrapping
+// the same memory once it waited on the signal semaphore of the first.
+TEST_P(VulkanBufferWrappingTests, WriteOnSecondDeviceReadOnFirst) {
+    DAWN_SKIP_TEST_IF(UsesWire());
+
+    // Create another device based on the original
+    dawn_native::vulkan::Adapter* backendAdapter =
+        reinterpret_cast<dawn_native::vulkan::Adapter*>(deviceVk->GetAdapter());
+    dawn_native::DeviceDescriptor deviceDescriptor;
+    deviceDescriptor.forceEnabledToggles = GetParam().forceEnabledWorkarounds;
+    deviceDescriptor.forceDisabledToggles = GetParam().forceDisabledWorkarounds;
+    wgpu::Device secondDevice = wgpu::Device::Acquire(
+        reinterpret_cast<WGPUDevice>(backendAdapter->CreateDevice(&deviceDescriptor)));
+
+    // Write the data on the second device and release the buffer
+    std::vector<uint32_t> expected(kBufferSize / sizeof(uint32_t));
+    for (size_t i = 0; i < expected.size(); ++i) {
+        expected[i] = static_cast<uint32_t>(i * 3 + 1);
+    }
+    wgpu::Buffer secondDeviceBuffer = WrapVulkanBuffer(secondDevice, &defaultDescriptor, {});
+    ASSERT_NE(secondDeviceBuffer.Get(), nullptr);
+    secondDeviceBuffer.SetSubData(0, kBufferSize, expected.data());
+
+    int signalFd = dawn_native::vulkan::ExportBufferSignalSemaphoreOpaqueFD(
+        secondDevice.Get(), secondDeviceBuffer.Get());
+    ASSERT_NE(signalFd, -1);
+
+    // Import the buffer on the first device, waiting on the second device's writes
+    wgpu::Buffer buffer = WrapVulkanBuffer(device, &defaultDescriptor, {signalFd});
+    ASSERT_NE(buffer.Get(), nullptr);
+    EXPECT_BUFFER_U32_RANGE_EQ(expected.data(), buffer, 0, expected.size());
+
+    IgnoreSignalSemaphore(device, buffer);
+}
+
+DAWN_INSTANTIATE_TEST(VulkanBufferWrappingTests, VulkanBackend);
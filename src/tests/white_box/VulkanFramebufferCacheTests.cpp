@@ -0,0 +1,131 @@
+// Copyright 2020 The Dawn Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tests/DawnTest.h"
+
+#include "dawn_native/vulkan/DeviceVk.h"
+#include "dawn_native/vulkan/FramebufferCache.h"
+#include "utils/WGPUHelpers.h"
+
+namespace {
+
+    class VulkanFramebufferCacheTests : public DawnTest {
+      protected:
+        void TestSetUp() override {
+            DAWN_SKIP_TEST_IF(UsesWire());
+
+            mDeviceVk = reinterpret_cast<dawn_native::vulkan::Device*>(device.Get());
+        }
+
+        uint64_t GetCreationCount() const {
+            return mDeviceVk->GetFramebufferCache()->GetCreationCount();
+        }
+
+        size_t GetCachedFramebufferCount() const {
+            return mDeviceVk->GetFramebufferCache()->GetCachedFramebufferCountForTesting();
+        }
+
+        size_t GetTrackedQueryCount() const {
+            return mDeviceVk->GetFramebufferCache()->GetTrackedQueryCountForTesting();
+        }
+
+        wgpu::Texture CreateAttachment() {
+            wgpu::TextureDescriptor descriptor;
+            descriptor.dimension = wgpu::TextureDimension::e2D;
+            descriptor.size = {4, 4, 1};
+            descriptor.format = wgpu::TextureFormat::RGBA8Unorm;
+            descriptor.usage = wgpu::TextureUsage::OutputAttachment;
+            return device.CreateTexture(&descriptor);
+        }
+
+        void ClearView(const wgpu::TextureView& view) {
+            ClearViews({view});
+        }
+
+        void ClearViews(std::initializer_list<wgpu::TextureView> views) {
+            utils::ComboRenderPassDescriptor renderPass(views);
+            wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+            encoder.BeginRenderPass(&renderPass).EndPass();
+            wgpu::CommandBuffer commands = encoder.Finish();
+            queue.Submit(1, &commands);
+        }
+
+        dawn_native::vulkan::Device* mDeviceVk;
+    };
+
+}  // anonymous namespace
+
+// Test that render passes with the same attachments reuse the same framebuffer.
+TEST_P(VulkanFramebufferCacheTests, SameAttachmentsReuseFramebuffer) {
+    wgpu::TextureView view = CreateAttachment().CreateView();
+
+    ClearView(view);
+    uint64_t creationCount = GetCreationCount();
+
+    for (uint32_t i = 0; i < 10; ++i) {
+        ClearView(view);
+    }
+    EXPECT_EQ(creationCount, GetCreationCount());
+}
+
+// Test that different attachments get different framebuffers.
+TEST_P(VulkanFramebufferCacheTests, DifferentAttachmentsCreateFramebuffers) {
+    wgpu::TextureView view1 = CreateAttachment().CreateView();
+    wgpu::TextureView view2 = CreateAttachment().CreateView();
+
+    uint64_t creationCount = GetCreationCount();
+    ClearView(view1);
+    ClearView(view2);
+    EXPECT_EQ(creationCount + 2, GetCreationCount());
+}
+
+// Test that destroying a view evicts its framebuffers so a new view can't use a stale framebuffer
+// even if it gets the same VkImageView handle.
+TEST_P(VulkanFramebufferCacheTests, DestroyedViewEvictsFramebuffer) {
+    wgpu::Texture texture = CreateAttachment();
+    size_t cachedCount = GetCachedFramebufferCount();
+
+    {
+        wgpu::TextureView view = texture.CreateView();
+        ClearView(view);
+        EXPECT_EQ(cachedCount + 1, GetCachedFramebufferCount());
+    }
+    EXPECT_EQ(cachedCount, GetCachedFramebufferCount());
+
+    uint64_t creationCount = GetCreationCount();
+    ClearView(texture.CreateView());
+    EXPECT_EQ(creationCount + 1, GetCreationCount());
+}
+
+// Test that evicting a framebuffer forgets it for all of its attachments, so that rendering to
+// transient views along with a long-lived view doesn't grow the cache's bookkeeping.
+TEST_P(VulkanFramebufferCacheTests, EvictionKeepsBookkeepingBounded) {
+    wgpu::TextureView longLivedView = CreateAttachment().CreateView();
+    wgpu::Texture texture = CreateAttachment();
+
+    size_t cachedCount = GetCachedFramebufferCount();
+    size_t trackedCount = GetTrackedQueryCount();
+
+    for (uint32_t i = 0; i < 10; ++i) {
+        wgpu::TextureView transientView = texture.CreateView();
+        ClearViews({transientView, longLivedView});
+        EXPECT_EQ(cachedCount + 1, GetCachedFramebufferCount());
+        EXPECT_EQ(trackedCount + 2, GetTrackedQueryCount());
+    }
+
+    EXPECT_EQ(cachedCount, GetCachedFramebufferCount());
+    EXPECT_EQ(trackedCount, GetTrackedQueryCount());
+}
+
+DAWN_INSTANTIATE_TEST(VulkanFramebufferCacheTests, VulkanBackend);
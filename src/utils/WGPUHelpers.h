@@ -19,6 +19,7 @@
 
 #include <array>
 #include <initializer_list>
+#include <vector>
 
 #include "common/Constants.h"
 
@@ -41,6 +42,10 @@ namespace utils {
                                           const char* source);
     wgpu::ShaderModule CreateShaderModuleFromASM(const wgpu::Device& device, const char* source);
 
+    // Returns the SPIR-V for the GLSL source, or an empty vector if the compilation failed. Used
+    // by tests that need to modify the code before creating shader modules.
+    std::vector<uint32_t> CompileGLSLToSpirv(SingleShaderStage stage, const char* source);
+
     wgpu::Buffer CreateBufferFromData(const wgpu::Device& device,
                                       const void* data,
                                       uint64_t size,